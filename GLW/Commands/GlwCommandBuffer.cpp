@@ -0,0 +1,106 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwCommandBuffer::GlwCommandBuffer( )
+	: m_data{ },
+	m_count{ 0 }
+{ }
+
+void GlwCommandBuffer::Reset( ) {
+	m_data.clear( );
+
+	m_count = 0;
+}
+
+void GlwCommandBuffer::RecordUniform(
+	const int32_t location,
+	const uint32_t type,
+	const uint32_t length,
+	const void* value
+) {
+	auto header_length = (uint32_t)sizeof( GlwCommandSetUniform );
+	auto* data		   = Allocate( GlwCommandTypes::Set_Uniform, header_length + length );
+	auto* command	   = (GlwCommandSetUniform*)data;
+
+	command->Location = location;
+	command->Type	  = type;
+	command->Length   = length;
+
+	memcpy( data + header_length, value, length );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint8_t* GlwCommandBuffer::Allocate( const GlwCommandTypes type, const uint32_t length ) {
+	auto size   = ( length + Alignment - 1 ) & ~( Alignment - 1 );
+	auto offset = (uint32_t)m_data.size( );
+
+	m_data.resize( (size_t)offset + size );
+
+	auto* data   = m_data.data( ) + offset;
+	auto* header = (GlwCommandHeader*)data;
+
+	header->Type = type;
+	header->Size = size;
+
+	m_count += 1;
+
+	return data;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwCommandBuffer::GetIsEmpty( ) const {
+	return m_count == 0;
+}
+
+uint32_t GlwCommandBuffer::GetCount( ) const {
+	return m_count;
+}
+
+uint32_t GlwCommandBuffer::GetSize( ) const {
+	return (uint32_t)m_data.size( );
+}
+
+uint32_t GlwCommandBuffer::GetCapacity( ) const {
+	return (uint32_t)m_data.capacity( );
+}
+
+const uint8_t* GlwCommandBuffer::GetData( ) const {
+	return m_data.data( );
+}
@@ -0,0 +1,187 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwCommands.h"
+
+/**
+ * GlwCommandBuffer class
+ * @note : Linear storage of recorded commands. Recording only copy plain
+ *		   data at the end of the buffer, reset keep the allocated memory so
+ *		   a buffer stop allocating once it reached its frame peak.
+ **/
+class GlwCommandBuffer final {
+
+public:
+	static const uint32_t Alignment = 8;
+
+private:
+	std::vector<uint8_t> m_data;
+	uint32_t m_count;
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwCommandBuffer( );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwCommandBuffer( ) = default;
+
+	/**
+	 * Reset method
+	 * @note : Drop recorded commands without releasing memory.
+	 **/
+	void Reset( );
+
+	/**
+	 * RecordUniform method
+	 * @note : Record uniform value for current material.
+	 * @param location : Query uniform location.
+	 * @param type : Query OpenGL uniform type.
+	 * @param length : Query uniform value length in bytes.
+	 * @param value : Query pointer to uniform value.
+	 **/
+	void RecordUniform( 
+		const int32_t location,
+		const uint32_t type,
+		const uint32_t length,
+		const void* value
+	);
+
+private:
+	/**
+	 * Allocate function
+	 * @note : Reserve aligned space for a command at the end of the buffer.
+	 * @param type : Query command type.
+	 * @param length : Query command length in bytes.
+	 * @return : Return pointer to command memory.
+	 **/
+	uint8_t* Allocate( const GlwCommandTypes type, const uint32_t length );
+
+public:
+	/**
+	 * Record template method
+	 * @note : Record command, its header is filled by the buffer.
+	 * @template CommandType : Query command structure type.
+	 * @param type : Query command type.
+	 * @param command : Query command value.
+	 **/
+	template<typename CommandType>
+		requires ( std::is_trivially_copyable<CommandType>::value )
+	void Record( const GlwCommandTypes type, const CommandType& command ) {
+		auto length = (uint32_t)sizeof( CommandType );
+		auto* data  = Allocate( type, length );
+
+		memcpy( data + sizeof( GlwCommandHeader ), (const uint8_t*)&command + sizeof( GlwCommandHeader ), length - sizeof( GlwCommandHeader ) );
+	};
+
+	/**
+	 * RecordUniform template method
+	 * @note : Record uniform value for current material.
+	 * @template Type : Query uniform value type.
+	 * @param location : Query uniform location.
+	 * @param value : Query uniform value.
+	 **/
+	template<typename Type>
+	void RecordUniform( const int32_t location, const Type& value ) {
+		auto type = GetUniformType<Type>( );
+
+		RecordUniform( location, type, (uint32_t)sizeof( Type ), &value );
+	};
+
+	/**
+	 * GetUniformType template function
+	 * @note : Get OpenGL uniform type of a value type.
+	 * @template Type : Query uniform value type.
+	 * @return : Return OpenGL uniform type value.
+	 **/
+	template<typename Type>
+	static constexpr uint32_t GetUniformType( ) {
+		if constexpr ( std::is_same<Type, int32_t>::value )
+			return GL_INT;
+		else if constexpr ( std::is_same<Type, float>::value )
+			return GL_FLOAT;
+		else if constexpr ( std::is_same<Type, glm::vec2>::value )
+			return GL_FLOAT_VEC2;
+		else if constexpr ( std::is_same<Type, glm::vec3>::value )
+			return GL_FLOAT_VEC3;
+		else if constexpr ( std::is_same<Type, glm::vec4>::value )
+			return GL_FLOAT_VEC4;
+		else if constexpr ( std::is_same<Type, glm::mat3>::value )
+			return GL_FLOAT_MAT3;
+		else {
+			static_assert( std::is_same<Type, glm::mat4>::value, "Unsupported uniform type" );
+
+			return GL_FLOAT_MAT4;
+		}
+	};
+
+public:
+	/**
+	 * GetIsEmpty const function
+	 * @note : Get if command buffer is empty.
+	 * @return : True when no command is recorded.
+	 **/
+	bool GetIsEmpty( ) const;
+
+	/**
+	 * GetCount const function
+	 * @note : Get recorded command count.
+	 * @return : Return command count value.
+	 **/
+	uint32_t GetCount( ) const;
+
+	/**
+	 * GetSize const function
+	 * @note : Get recorded commands size in bytes.
+	 * @return : Return size value.
+	 **/
+	uint32_t GetSize( ) const;
+
+	/**
+	 * GetCapacity const function
+	 * @note : Get allocated memory size in bytes.
+	 * @return : Return capacity value.
+	 **/
+	uint32_t GetCapacity( ) const;
+
+	/**
+	 * GetData const function
+	 * @note : Get recorded commands data.
+	 * @return : Return pointer to first command.
+	 **/
+	const uint8_t* GetData( ) const;
+
+};
@@ -0,0 +1,70 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "../Display/GlwSwapchain.h"
+
+enum class GlwCommandTypes : uint32_t {
+
+	Use_Render_Pass = 0,
+	Use_Swapchain,
+	Toggle,
+	Set_Viewport,
+	Set_Scissor,
+	Toggle_Color_Writes,
+	Toggle_Stencil_Write,
+	Clear_Color,
+	Clear_Depth,
+	Clear_Stencil,
+	Blit_Render_Target,
+	Use_Material,
+	Set_Uniform,
+	Set_Uniform_Buffer,
+	Use_Mesh,
+	Use_Geometry_Pool,
+	Use_Stream_Geometry,
+	Use_Texture,
+	Bind_Stream_Buffer,
+	Bind_Uniform_Buffer,
+	Bind_Storage_Buffer,
+	Bind_Image,
+	Draw,
+	Draw_Base_Vertex,
+	Draw_Geometry,
+	Draw_Instanced,
+	Multi_Draw_Indirect,
+	Multi_Draw_Indirect_Count,
+	Dispatch,
+	Dispatch_Indirect,
+	Memory_Barrier
+
+};
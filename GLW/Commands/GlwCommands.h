@@ -0,0 +1,310 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwCommandTypes.h"
+
+/**
+ * Commands
+ * @note : Recorded commands are plain data copied as is in command buffers,
+ *		   each one start with a header storing its type and aligned size so
+ *		   the buffer can be walked linearly at submission.
+ **/
+struct GlwCommandHeader {
+
+	GlwCommandTypes Type;
+	uint32_t Size;
+
+};
+
+struct GlwCommandUseRenderPass {
+
+	GlwCommandHeader Header;
+	GlwRenderPass* RenderPass;
+
+};
+
+struct GlwCommandUseSwapchain {
+
+	GlwCommandHeader Header;
+	bool UseDimensions;
+	glm::ivec2 Dimensions;
+
+};
+
+struct GlwCommandToggle {
+
+	GlwCommandHeader Header;
+	uint32_t Target;
+	GlwStates State;
+
+};
+
+struct GlwCommandBounds {
+
+	GlwCommandHeader Header;
+	glm::ivec4 Bounds;
+
+};
+
+struct GlwCommandClearColor {
+
+	GlwCommandHeader Header;
+	uint32_t Attachement;
+	glm::vec4 Color;
+
+};
+
+struct GlwCommandClearDepthStencil {
+
+	GlwCommandHeader Header;
+	float Depth;
+	int32_t Stencil;
+
+};
+
+struct GlwCommandBlit {
+
+	GlwCommandHeader Header;
+	GlwBlitSpecification Specification;
+
+};
+
+struct GlwCommandUseMaterial {
+
+	GlwCommandHeader Header;
+	GlwMaterial* Material;
+
+};
+
+/**
+ * GlwCommandSetUniform
+ * @note : Uniform value of Length bytes follow the command in the buffer.
+ **/
+struct GlwCommandSetUniform {
+
+	GlwCommandHeader Header;
+	int32_t Location;
+	uint32_t Type;
+	uint32_t Length;
+
+};
+
+/**
+ * GlwCommandSetUniformBuffer
+ * @note : Location is the block index of current material, used as binding point.
+ **/
+struct GlwCommandSetUniformBuffer {
+
+	GlwCommandHeader Header;
+	int32_t Location;
+	glBuffer Buffer;
+
+};
+
+struct GlwCommandUseMesh {
+
+	GlwCommandHeader Header;
+	GlwMesh* Mesh;
+
+};
+
+struct GlwCommandUseGeometryPool {
+
+	GlwCommandHeader Header;
+	GlwGeometryPool* GeometryPool;
+
+};
+
+/**
+ * GlwCommandUseStreamGeometry
+ * @note : Stream buffers are attached at offset 0 to the shared vertex format,
+ *		   draws select their allocation with base vertex and first index.
+ **/
+struct GlwCommandUseStreamGeometry {
+
+	GlwCommandHeader Header;
+	GlwVertexFormat* Format;
+	glBuffer Vertex;
+	uint32_t Stride;
+	glBuffer Index;
+
+};
+
+struct GlwCommandUseTexture {
+
+	GlwCommandHeader Header;
+	uint32_t Slot;
+	glTexture Texture;
+
+};
+
+struct GlwCommandBindStreamBuffer {
+
+	GlwCommandHeader Header;
+	GlwStreamBuffer* StreamBuffer;
+	uint32_t Binding;
+	uint32_t Offset;
+	uint32_t Length;
+
+};
+
+/**
+ * GlwCommandBindUniformBuffer
+ * @note : Length of 0 bind the whole buffer.
+ **/
+struct GlwCommandBindUniformBuffer {
+
+	GlwCommandHeader Header;
+	glBuffer Buffer;
+	uint32_t Binding;
+	uint32_t Offset;
+	uint32_t Length;
+
+};
+
+/**
+ * GlwCommandBindStorageBuffer
+ * @note : Length of 0 bind the whole buffer.
+ **/
+struct GlwCommandBindStorageBuffer {
+
+	GlwCommandHeader Header;
+	glBuffer Buffer;
+	uint32_t Binding;
+	uint32_t Offset;
+	uint32_t Length;
+	GlwAccessModes Access;
+
+};
+
+struct GlwCommandBindImage {
+
+	GlwCommandHeader Header;
+	uint32_t Unit;
+	glTexture Texture;
+	int32_t Level;
+	bool Layered;
+	int32_t Layer;
+	GlwAccessModes Access;
+	uint32_t Format;
+
+};
+
+struct GlwCommandDraw {
+
+	GlwCommandHeader Header;
+	uint32_t VerticeCount;
+	bool UseIndex;
+
+};
+
+struct GlwCommandDrawBaseVertex {
+
+	GlwCommandHeader Header;
+	uint32_t VerticeCount;
+	uint32_t FirstIndex;
+	int32_t BaseVertex;
+
+};
+
+/**
+ * GlwCommandDrawGeometry
+ * @note : Geometry ranges are read from the geometry pool at replay.
+ **/
+struct GlwCommandDrawGeometry {
+
+	GlwCommandHeader Header;
+	uint32_t Geometry;
+
+};
+
+struct GlwCommandDrawInstanced {
+
+	GlwCommandHeader Header;
+	uint32_t VerticeCount;
+	uint32_t InstanceCount;
+	uint32_t FirstVertice;
+	int32_t BaseVertex;
+	uint32_t BaseInstance;
+	bool UseIndex;
+
+};
+
+struct GlwCommandMultiDrawIndirect {
+
+	GlwCommandHeader Header;
+	glBuffer Indirect;
+	uint32_t Offset;
+	uint32_t DrawCount;
+	uint32_t Stride;
+
+};
+
+/**
+ * GlwCommandMultiDrawIndirectCount
+ * @note : Draw count is read from Parameter buffer at ParameterOffset and
+ *		   clamped to MaxDrawCount.
+ **/
+struct GlwCommandMultiDrawIndirectCount {
+
+	GlwCommandHeader Header;
+	glBuffer Indirect;
+	uint32_t Offset;
+	glBuffer Parameter;
+	uint32_t ParameterOffset;
+	uint32_t MaxDrawCount;
+	uint32_t Stride;
+
+};
+
+struct GlwCommandDispatch {
+
+	GlwCommandHeader Header;
+	glm::uvec3 GroupCount;
+
+};
+
+struct GlwCommandDispatchIndirect {
+
+	GlwCommandHeader Header;
+	glBuffer Indirect;
+	uint32_t Offset;
+
+};
+
+struct GlwCommandMemoryBarrier {
+
+	GlwCommandHeader Header;
+	uint32_t Barriers;
+
+};
@@ -0,0 +1,218 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwRenderQueue::GlwRenderQueue( )
+	: m_items{ },
+	m_keys{ },
+	m_order{ },
+	m_swap_keys{ },
+	m_swap_order{ },
+	m_unsorted{ },
+	m_sorted{ },
+	m_is_sorted{ true }
+{ }
+
+void GlwRenderQueue::Reserve( const uint32_t capacity ) {
+	m_items.reserve( capacity );
+	m_keys.reserve( capacity );
+	m_order.reserve( capacity );
+	m_swap_keys.reserve( capacity );
+	m_swap_order.reserve( capacity );
+}
+
+void GlwRenderQueue::Reset( ) {
+	m_items.clear( );
+	m_keys.clear( );
+	m_order.clear( );
+	m_unsorted.Reset( );
+	m_sorted.Reset( );
+
+	m_is_sorted = true;
+}
+
+void GlwRenderQueue::Push(
+	const uint32_t render_pass,
+	const bool is_translucent,
+	const float depth,
+	const GlwRenderQueueItem& item
+) {
+	auto key   = GetKey( render_pass, is_translucent, depth, item );
+	auto index = (uint32_t)m_items.size( );
+
+	if ( index > 0 )
+		CountSwitches( m_keys.back( ), m_items.back( ), key, item, m_unsorted );
+	else
+		m_unsorted.DrawCount = 1;
+
+	m_items.emplace_back( item );
+	m_keys.emplace_back( key );
+	m_order.emplace_back( index );
+
+	m_is_sorted = false;
+}
+
+void GlwRenderQueue::Sort( ) {
+	if ( m_is_sorted )
+		return;
+
+	auto count = (uint32_t)m_keys.size( );
+
+	uint32_t histogram[ RadixPassCount * RadixSize ] = { };
+
+	for ( auto key : m_keys ) {
+		for ( auto pass = 0u; pass < RadixPassCount; pass++ )
+			histogram[ pass * RadixSize + ( ( key >> ( pass * RadixBits ) ) & ( RadixSize - 1 ) ) ] += 1;
+	}
+
+	m_swap_keys.resize( count );
+	m_swap_order.resize( count );
+
+	for ( auto pass = 0u; pass < RadixPassCount; pass++ ) {
+		auto* buckets = histogram + pass * RadixSize;
+		auto shift    = pass * RadixBits;
+
+		if ( buckets[ ( m_keys[ 0 ] >> shift ) & ( RadixSize - 1 ) ] == count )
+			continue;
+
+		auto offset = (uint32_t)0;
+
+		for ( auto bucket = 0u; bucket < RadixSize; bucket++ ) {
+			auto bucket_count = buckets[ bucket ];
+
+			buckets[ bucket ] = offset;
+			offset           += bucket_count;
+		}
+
+		for ( auto index = 0u; index < count; index++ ) {
+			auto key    = m_keys[ index ];
+			auto target = buckets[ ( key >> shift ) & ( RadixSize - 1 ) ]++;
+
+			m_swap_keys[ target ]  = key;
+			m_swap_order[ target ] = m_order[ index ];
+		}
+
+		m_keys.swap( m_swap_keys );
+		m_order.swap( m_swap_order );
+	}
+
+	m_sorted.Reset( );
+	m_sorted.DrawCount = 1;
+
+	for ( auto index = 1u; index < count; index++ )
+		CountSwitches( m_keys[ index - 1 ], m_items[ m_order[ index - 1 ] ], m_keys[ index ], m_items[ m_order[ index ] ], m_sorted );
+
+	m_is_sorted = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void GlwRenderQueue::CountSwitches(
+	const uint64_t previous_key,
+	const GlwRenderQueueItem& previous,
+	const uint64_t key,
+	const GlwRenderQueueItem& item,
+	GlwRenderQueueStatistics& statistics
+) {
+	statistics.DrawCount += 1;
+
+	if ( GetKeyRenderPass( previous_key ) != GetKeyRenderPass( key ) )
+		statistics.RenderPassSwitches += 1;
+
+	if ( previous.Material != item.Material )
+		statistics.MaterialSwitches += 1;
+
+	if ( previous.Mesh != item.Mesh )
+		statistics.MeshSwitches += 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t GlwRenderQueue::GetKey(
+	const uint32_t render_pass,
+	const bool is_translucent,
+	const float depth,
+	const GlwRenderQueueItem& item
+) {
+	auto depth_max = (uint64_t)( ( 1u << DepthBits ) - 1 );
+	auto clamped   = std::clamp( depth, 0.f, 1.f );
+	auto quantized = (uint64_t)( clamped * depth_max );
+	auto material  = (uint64_t)GlwRessourcePool<GlwMaterial>::GetIndex( item.Material );
+	auto mesh      = (uint64_t)GlwRessourcePool<GlwMesh>::GetIndex( item.Mesh );
+	auto key       = (uint64_t)( render_pass & ( ( 1u << RenderPassBits ) - 1 ) ) << ( 64 - RenderPassBits );
+
+	if ( is_translucent ) {
+		key |= (uint64_t)1 << ( 63 - RenderPassBits );
+		key |= ( depth_max - quantized ) << ( 63 - RenderPassBits - DepthBits );
+		key |= material << ( 63 - RenderPassBits - DepthBits - RessourceBits );
+		key |= mesh << ( 63 - RenderPassBits - DepthBits - 2 * RessourceBits );
+	} else {
+		key |= material << ( 63 - RenderPassBits - RessourceBits );
+		key |= mesh << ( 63 - RenderPassBits - 2 * RessourceBits );
+		key |= quantized << ( 63 - RenderPassBits - 2 * RessourceBits - DepthBits );
+	}
+
+	return key;
+}
+
+uint32_t GlwRenderQueue::GetKeyRenderPass( const uint64_t key ) {
+	return (uint32_t)( key >> ( 64 - RenderPassBits ) );
+}
+
+bool GlwRenderQueue::GetIsSorted( ) const {
+	return m_is_sorted;
+}
+
+uint32_t GlwRenderQueue::GetCount( ) const {
+	return (uint32_t)m_items.size( );
+}
+
+uint32_t GlwRenderQueue::GetRenderPass( const uint32_t order ) const {
+	return GetKeyRenderPass( m_keys[ order ] );
+}
+
+const GlwRenderQueueItem& GlwRenderQueue::GetItem( const uint32_t order ) const {
+	return m_items[ m_order[ order ] ];
+}
+
+const GlwRenderQueueStatistics& GlwRenderQueue::GetUnsortedStatistics( ) const {
+	return m_unsorted;
+}
+
+const GlwRenderQueueStatistics& GlwRenderQueue::GetSortedStatistics( ) const {
+	return m_sorted;
+}
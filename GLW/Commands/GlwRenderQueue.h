@@ -0,0 +1,195 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwRenderQueueItem.h"
+
+/**
+ * GlwRenderQueue class
+ * @note : Draw queue sorted by 64 bits keys with a LSD radix sort. Opaque
+ *		   keys pack render pass, material, mesh then front to back depth,
+ *		   translucent keys pack render pass then back to front depth before
+ *		   material and mesh. Sorting only moves keys and item indexes.
+ **/
+class GlwRenderQueue final {
+
+public:
+	static const uint32_t RenderPassBits    = 6;
+	static const uint32_t RessourceBits     = GlwRessourcePool<GlwMaterial>::IndexBits;
+	static const uint32_t DepthBits         = 16;
+	static const uint32_t RadixBits         = 8;
+	static const uint32_t RadixSize         = 1 << RadixBits;
+	static const uint32_t RadixPassCount    = 64 / RadixBits;
+
+private:
+	std::vector<GlwRenderQueueItem> m_items;
+	std::vector<uint64_t> m_keys;
+	std::vector<uint32_t> m_order;
+	std::vector<uint64_t> m_swap_keys;
+	std::vector<uint32_t> m_swap_order;
+	GlwRenderQueueStatistics m_unsorted;
+	GlwRenderQueueStatistics m_sorted;
+	bool m_is_sorted;
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwRenderQueue( );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwRenderQueue( ) = default;
+
+	/**
+	 * Reserve method
+	 * @note : Reserve memory for query draw count.
+	 * @param capacity : Query draw count.
+	 **/
+	void Reserve( const uint32_t capacity );
+
+	/**
+	 * Reset method
+	 * @note : Drop queued draws without releasing memory.
+	 **/
+	void Reset( );
+
+	/**
+	 * Push method
+	 * @note : Queue draw.
+	 * @param render_pass : Query render pass, only the lowest RenderPassBits bits are used.
+	 * @param is_translucent : Query if draw is sorted back to front after opaque draws.
+	 * @param depth : Query normalized view depth, clamped to [0, 1].
+	 * @param item : Query draw item.
+	 **/
+	void Push(
+		const uint32_t render_pass,
+		const bool is_translucent,
+		const float depth,
+		const GlwRenderQueueItem& item
+	);
+
+	/**
+	 * Sort method
+	 * @note : Radix sort queued draws by key, compute sorted statistics.
+	 **/
+	void Sort( );
+
+private:
+	/**
+	 * CountSwitches static method
+	 * @note : Count state switches between two consecutive draws.
+	 * @param previous_key : Query previous draw key.
+	 * @param previous : Query previous draw item.
+	 * @param key : Query draw key.
+	 * @param item : Query draw item.
+	 * @param statistics : Reference to updated statistics.
+	 **/
+	static void CountSwitches(
+		const uint64_t previous_key,
+		const GlwRenderQueueItem& previous,
+		const uint64_t key,
+		const GlwRenderQueueItem& item,
+		GlwRenderQueueStatistics& statistics
+	);
+
+public:
+	/**
+	 * GetKey static function
+	 * @note : Pack draw sort key.
+	 * @param render_pass : Query render pass.
+	 * @param is_translucent : Query if draw is translucent.
+	 * @param depth : Query normalized view depth.
+	 * @param item : Query draw item.
+	 * @return : Return draw sort key.
+	 **/
+	static uint64_t GetKey(
+		const uint32_t render_pass,
+		const bool is_translucent,
+		const float depth,
+		const GlwRenderQueueItem& item
+	);
+
+	/**
+	 * GetKeyRenderPass static function
+	 * @note : Unpack render pass from a sort key.
+	 * @param key : Query draw sort key.
+	 * @return : Return render pass value.
+	 **/
+	static uint32_t GetKeyRenderPass( const uint64_t key );
+
+	/**
+	 * GetIsSorted const function
+	 * @note : Get if queue is sorted.
+	 * @return : True when no draw was pushed since last sort.
+	 **/
+	bool GetIsSorted( ) const;
+
+	/**
+	 * GetCount const function
+	 * @note : Get queued draw count.
+	 * @return : Return draw count value.
+	 **/
+	uint32_t GetCount( ) const;
+
+	/**
+	 * GetRenderPass const function
+	 * @note : Get render pass of a draw in queue order.
+	 * @param order : Query position in queue order.
+	 * @return : Return render pass value.
+	 **/
+	uint32_t GetRenderPass( const uint32_t order ) const;
+
+	/**
+	 * GetItem const function
+	 * @note : Get draw item in queue order.
+	 * @param order : Query position in queue order.
+	 * @return : Return constant reference to draw item.
+	 **/
+	const GlwRenderQueueItem& GetItem( const uint32_t order ) const;
+
+	/**
+	 * GetUnsortedStatistics const function
+	 * @note : Get state switches of draws in push order.
+	 * @return : Return constant reference to statistics.
+	 **/
+	const GlwRenderQueueStatistics& GetUnsortedStatistics( ) const;
+
+	/**
+	 * GetSortedStatistics const function
+	 * @note : Get state switches of draws in sorted order.
+	 * @return : Return constant reference to statistics.
+	 **/
+	const GlwRenderQueueStatistics& GetSortedStatistics( ) const;
+
+};
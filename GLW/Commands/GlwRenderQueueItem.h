@@ -0,0 +1,90 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwRenderQueueStatistics.h"
+
+struct GlwRenderQueueItem {
+
+	glw_ressource Material;
+	glw_ressource Mesh;
+	uint32_t VerticeCount;
+	glw_ressource StreamBuffer;
+	uint32_t StreamBinding;
+	uint32_t StreamOffset;
+	uint32_t StreamLength;
+
+	/**
+	 * Constructor
+	 **/
+	GlwRenderQueueItem( );
+
+	/**
+	 * Constructor
+	 * @param material : Query material.
+	 * @param mesh : Query mesh.
+	 * @param vertice_count : Query vertex count.
+	 **/
+	GlwRenderQueueItem(
+		const glw_ressource material,
+		const glw_ressource mesh,
+		const uint32_t vertice_count
+	);
+
+	/**
+	 * Constructor
+	 * @param material : Query material.
+	 * @param mesh : Query mesh.
+	 * @param vertice_count : Query vertex count.
+	 * @param stream_buffer : Query stream buffer holding draw data.
+	 * @param stream_binding : Query draw data binding point.
+	 * @param stream_offset : Query draw data offset from buffer start.
+	 * @param stream_length : Query draw data length in bytes.
+	 **/
+	GlwRenderQueueItem(
+		const glw_ressource material,
+		const glw_ressource mesh,
+		const uint32_t vertice_count,
+		const glw_ressource stream_buffer,
+		const uint32_t stream_binding,
+		const uint32_t stream_offset,
+		const uint32_t stream_length
+	);
+
+	/**
+	 * GetHasStream const function
+	 * @note : Get if item bind draw data before drawing.
+	 * @return : True when draw data range is not empty.
+	 **/
+	bool GetHasStream( ) const;
+
+};
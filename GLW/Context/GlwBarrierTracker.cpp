@@ -0,0 +1,233 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwBarrierTracker::GlwBarrierTracker( )
+	: m_pending{ },
+	m_storages{ },
+	m_uniforms{ },
+	m_images{ },
+	m_textures{ },
+	m_vertex_buffer{ GL_NULL },
+	m_instance_buffer{ GL_NULL },
+	m_index_buffer{ GL_NULL },
+	m_storage_writes{ 0 },
+	m_image_writes{ 0 },
+	m_required{ 0 },
+	m_issued{ 0 }
+{ 
+	Invalidate( );
+}
+
+void GlwBarrierTracker::Invalidate( ) {
+	for ( auto& storage : m_storages )
+		storage = GlwBarrierBinding{ };
+
+	for ( auto& uniform : m_uniforms )
+		uniform = GL_NULL;
+
+	for ( auto& image : m_images )
+		image = GlwBarrierBinding{ };
+
+	for ( auto& texture : m_textures )
+		texture = GL_TEXTURE_NULL;
+
+	m_vertex_buffer   = GL_NULL;
+	m_instance_buffer = GL_NULL;
+	m_index_buffer    = GL_NULL;
+	m_storage_writes  = 0;
+	m_image_writes    = 0;
+}
+
+void GlwBarrierTracker::Clear( ) {
+	Invalidate( );
+
+	m_pending.clear( );
+
+	m_required = 0;
+}
+
+void GlwBarrierTracker::ResetCounters( ) {
+	m_issued = 0;
+}
+
+void GlwBarrierTracker::BindStorage( const uint32_t binding, const glBuffer buffer, const GlwAccessModes access ) {
+	if ( binding >= StorageBindingCount )
+		return;
+
+	auto mask = 1u << binding;
+
+	m_storages[ binding ] = GlwBarrierBinding{ buffer, access };
+
+	if ( glIsValid( buffer ) && m_storages[ binding ].GetIsWrite( ) )
+		m_storage_writes |= mask;
+	else
+		m_storage_writes &= ~mask;
+}
+
+void GlwBarrierTracker::BindImage( const uint32_t unit, const glTexture texture, const GlwAccessModes access ) {
+	if ( unit >= ImageUnitCount )
+		return;
+
+	auto mask = 1u << unit;
+
+	m_images[ unit ] = GlwBarrierBinding{ texture, access };
+
+	if ( glIsValid( texture ) && m_images[ unit ].GetIsWrite( ) )
+		m_image_writes |= mask;
+	else
+		m_image_writes &= ~mask;
+}
+
+void GlwBarrierTracker::BindUniform( const uint32_t binding, const glBuffer buffer ) {
+	if ( binding < UniformBindingCount )
+		m_uniforms[ binding ] = buffer;
+}
+
+void GlwBarrierTracker::BindTexture( const uint32_t unit, const glTexture texture ) {
+	if ( unit < TextureUnitCount )
+		m_textures[ unit ] = texture;
+}
+
+void GlwBarrierTracker::BindGeometry( const glBuffer vertex_buffer, const glBuffer index_buffer ) {
+	BindGeometry( vertex_buffer, GL_NULL, index_buffer );
+}
+
+void GlwBarrierTracker::BindGeometry(
+	const glBuffer vertex_buffer,
+	const glBuffer instance_buffer,
+	const glBuffer index_buffer
+) {
+	m_vertex_buffer   = vertex_buffer;
+	m_instance_buffer = instance_buffer;
+	m_index_buffer    = index_buffer;
+}
+
+void GlwBarrierTracker::RequireBuffer( const glBuffer buffer, const uint32_t barriers ) {
+	Require( BufferKey | buffer, barriers );
+}
+
+void GlwBarrierTracker::PrepareDraw( ) {
+	if ( !m_pending.empty( ) ) {
+		Require( BufferKey | m_vertex_buffer, GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT );
+		Require( BufferKey | m_instance_buffer, GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT );
+		Require( BufferKey | m_index_buffer, GL_ELEMENT_ARRAY_BARRIER_BIT );
+	}
+
+	Prepare( );
+}
+
+void GlwBarrierTracker::PrepareDispatch( ) {
+	Prepare( );
+}
+
+void GlwBarrierTracker::Commit( ) {
+	for ( auto binding = (uint32_t)0; binding < StorageBindingCount; binding++ ) {
+		if ( m_storage_writes & ( 1u << binding ) )
+			m_pending[ BufferKey | m_storages[ binding ].Name ] = GL_ALL_BARRIER_BITS;
+	}
+
+	for ( auto unit = (uint32_t)0; unit < ImageUnitCount; unit++ ) {
+		if ( m_image_writes & ( 1u << unit ) )
+			m_pending[ TextureKey | m_images[ unit ].Name ] = GL_ALL_BARRIER_BITS;
+	}
+}
+
+void GlwBarrierTracker::Barrier( const uint32_t barriers ) {
+	m_required |= barriers;
+
+	Flush( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void GlwBarrierTracker::Require( const uint64_t key, const uint32_t barriers ) {
+	if ( ( key & UINT32_MAX ) == GL_NULL )
+		return;
+
+	auto pending = m_pending.find( key );
+
+	if ( pending != m_pending.end( ) )
+		m_required |= pending->second & barriers;
+}
+
+void GlwBarrierTracker::Prepare( ) {
+	if ( !m_pending.empty( ) ) {
+		for ( const auto& storage : m_storages )
+			Require( BufferKey | storage.Name, GL_SHADER_STORAGE_BARRIER_BIT );
+
+		for ( const auto uniform : m_uniforms )
+			Require( BufferKey | uniform, GL_UNIFORM_BARRIER_BIT );
+
+		for ( const auto& image : m_images )
+			Require( TextureKey | image.Name, GL_SHADER_IMAGE_ACCESS_BARRIER_BIT );
+
+		for ( const auto texture : m_textures )
+			Require( TextureKey | texture, GL_TEXTURE_FETCH_BARRIER_BIT );
+	}
+
+	Flush( );
+}
+
+void GlwBarrierTracker::Flush( ) {
+	if ( m_required == 0 )
+		return;
+
+	glMemoryBarrier( m_required );
+
+	for ( auto pending = m_pending.begin( ); pending != m_pending.end( ); ) {
+		pending->second &= ~m_required;
+
+		if ( pending->second == 0 )
+			pending = m_pending.erase( pending );
+		else
+			pending++;
+	}
+
+	m_required = 0;
+	m_issued  += 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t GlwBarrierTracker::GetIssued( ) const {
+	return m_issued;
+}
+
+uint32_t GlwBarrierTracker::GetPendingCount( ) const {
+	return (uint32_t)m_pending.size( );
+}
@@ -0,0 +1,225 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwBarrierBinding.h"
+
+/**
+ * GlwBarrierTracker final class
+ * @note : Track resources written by shaders through storage buffers and
+ *         image units, and issue before each draw or dispatch the smallest
+ *         glMemoryBarrier covering how pending writes are about to be read.
+ *         A barrier bit make every prior shader write visible to that kind of
+ *         access, so issued bits are cleared from all pending resources.
+ **/
+class GlwBarrierTracker final {
+
+public:
+    static const uint32_t StorageBindingCount = 16;
+    static const uint32_t UniformBindingCount = 16;
+    static const uint32_t ImageUnitCount      = 8;
+    static const uint32_t TextureUnitCount    = GlwStateTracker::TextureUnitCount;
+
+private:
+    static const uint64_t BufferKey  = 0;
+    static const uint64_t TextureKey = 1ull << 32;
+
+private:
+    std::unordered_map<uint64_t, uint32_t> m_pending;
+    GlwBarrierBinding m_storages[ StorageBindingCount ];
+    glBuffer m_uniforms[ UniformBindingCount ];
+    GlwBarrierBinding m_images[ ImageUnitCount ];
+    glTexture m_textures[ TextureUnitCount ];
+    glBuffer m_vertex_buffer;
+    glBuffer m_instance_buffer;
+    glBuffer m_index_buffer;
+    uint32_t m_storage_writes;
+    uint32_t m_image_writes;
+    uint32_t m_required;
+    uint32_t m_issued;
+
+public:
+    /**
+     * Constructor
+     **/
+    GlwBarrierTracker( );
+
+    /**
+     * Destructor
+     **/
+    ~GlwBarrierTracker( ) = default;
+
+    /**
+     * Invalidate method
+     * @note : Forget bound resources, pending writes are kept.
+     **/
+    void Invalidate( );
+
+    /**
+     * Clear method
+     * @note : Forget bound resources and pending writes.
+     **/
+    void Clear( );
+
+    /**
+     * ResetCounters method
+     * @note : Reset issued barrier counter.
+     **/
+    void ResetCounters( );
+
+    /**
+     * BindStorage method
+     * @note : Track buffer bound to a shader storage binding point.
+     * @param binding : Query binding point.
+     * @param buffer : Query OpenGL buffer.
+     * @param access : Query shader access.
+     **/
+    void BindStorage( const uint32_t binding, const glBuffer buffer, const GlwAccessModes access );
+
+    /**
+     * BindImage method
+     * @note : Track texture bound to an image unit.
+     * @param unit : Query image unit.
+     * @param texture : Query OpenGL texture.
+     * @param access : Query shader access.
+     **/
+    void BindImage( const uint32_t unit, const glTexture texture, const GlwAccessModes access );
+
+    /**
+     * BindUniform method
+     * @note : Track buffer bound to a uniform binding point.
+     * @param binding : Query binding point.
+     * @param buffer : Query OpenGL buffer.
+     **/
+    void BindUniform( const uint32_t binding, const glBuffer buffer );
+
+    /**
+     * BindTexture method
+     * @note : Track texture bound to a texture unit for sampling.
+     * @param unit : Query texture unit.
+     * @param texture : Query OpenGL texture.
+     **/
+    void BindTexture( const uint32_t unit, const glTexture texture );
+
+    /**
+     * BindGeometry method
+     * @note : Track vertex and index buffers used by next draws.
+     * @param vertex_buffer : Query OpenGL vertex buffer.
+     * @param index_buffer : Query OpenGL index buffer.
+     **/
+    void BindGeometry( const glBuffer vertex_buffer, const glBuffer index_buffer );
+
+    /**
+     * BindGeometry method
+     * @note : Track vertex, per instance and index buffers used by next draws.
+     * @param vertex_buffer : Query OpenGL vertex buffer.
+     * @param instance_buffer : Query OpenGL instance buffer.
+     * @param index_buffer : Query OpenGL index buffer.
+     **/
+    void BindGeometry(
+        const glBuffer vertex_buffer,
+        const glBuffer instance_buffer,
+        const glBuffer index_buffer
+    );
+
+    /**
+     * RequireBuffer method
+     * @note : Declare buffer read by next draw or dispatch.
+     * @param buffer : Query OpenGL buffer.
+     * @param barriers : Query barrier bits matching the read.
+     **/
+    void RequireBuffer( const glBuffer buffer, const uint32_t barriers );
+
+    /**
+     * PrepareDraw method
+     * @note : Issue barrier needed by bound resources before a draw.
+     **/
+    void PrepareDraw( );
+
+    /**
+     * PrepareDispatch method
+     * @note : Issue barrier needed by bound resources before a dispatch.
+     **/
+    void PrepareDispatch( );
+
+    /**
+     * Commit method
+     * @note : Mark resources bound with write access as written, call it
+     *         after each draw or dispatch.
+     **/
+    void Commit( );
+
+    /**
+     * Barrier method
+     * @note : Issue barrier bits immediately, for reads the tracker can not
+     *         see like buffer mapping or pixel transfers.
+     * @param barriers : Query barrier bits.
+     **/
+    void Barrier( const uint32_t barriers );
+
+private:
+    /**
+     * Require method
+     * @note : Add barrier bits pending on query resource to next barrier.
+     * @param key : Query resource key.
+     * @param barriers : Query barrier bits matching the read.
+     **/
+    void Require( const uint64_t key, const uint32_t barriers );
+
+    /**
+     * Prepare method
+     * @note : Require barriers of bound shader resources then flush.
+     **/
+    void Prepare( );
+
+    /**
+     * Flush method
+     * @note : Issue required barrier bits and clear them from pending writes.
+     **/
+    void Flush( );
+
+public:
+    /**
+     * GetIssued const function
+     * @note : Get count of glMemoryBarrier calls since last ResetCounters.
+     * @return : Return m_issued value.
+     **/
+    uint32_t GetIssued( ) const;
+
+    /**
+     * GetPendingCount const function
+     * @note : Get count of written resources with barriers not issued yet.
+     * @return : Return pending resource count.
+     **/
+    uint32_t GetPendingCount( ) const;
+
+};
@@ -0,0 +1,366 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwStateTracker::GlwStateTracker( )
+	: m_known{ 0 },
+	m_capabilities{ },
+	m_program{ GL_NULL },
+	m_vertex_array{ GL_NULL },
+	m_framebuffer{ GL_NULL },
+	m_textures{ },
+	m_color_masks{ },
+	m_viewport{ },
+	m_scissor{ },
+	m_depth_function{ 0 },
+	m_depth_range{ },
+	m_depth_mask{ true },
+	m_blend_function{ },
+	m_blend_equation{ 0 },
+	m_stencil_functions{ },
+	m_stencil_operations{ },
+	m_stencil_mask{ 0 },
+	m_clear_color{ },
+	m_clear_depth{ 0.f },
+	m_clear_stencil{ 0 },
+	m_issued{ 0 },
+	m_elided{ 0 }
+{ 
+	Invalidate( );
+}
+
+void GlwStateTracker::Invalidate( ) {
+	m_known = 0;
+
+	m_capabilities.clear( );
+
+	for ( auto& texture : m_textures )
+		texture = UINT_MAX;
+
+	for ( auto& color_mask : m_color_masks )
+		color_mask = UINT8_MAX;
+}
+
+void GlwStateTracker::ResetCounters( ) {
+	m_issued = 0;
+	m_elided = 0;
+}
+
+void GlwStateTracker::Toggle( const uint32_t capability, const GlwStates state ) {
+	auto enable = state == GlwStates::Enable;
+	auto known  = m_capabilities.find( capability );
+
+	if ( known != m_capabilities.end( ) && known->second == enable ) {
+		m_elided += 1;
+
+		return;
+	}
+
+	m_capabilities[ capability ] = enable;
+	m_issued += 1;
+
+	if ( enable )
+		glEnable( capability );
+	else
+		glDisable( capability );
+}
+
+void GlwStateTracker::UseProgram( const glProgram program ) {
+	if ( GetCanElide( KnownProgram, m_program == program ) )
+		return;
+
+	m_program = program;
+
+	glUseProgram( program );
+}
+
+void GlwStateTracker::UseVertexArray( const glVertexArray vertex_array ) {
+	if ( GetCanElide( KnownVertexArray, m_vertex_array == vertex_array ) )
+		return;
+
+	m_vertex_array = vertex_array;
+
+	glBindVertexArray( vertex_array );
+}
+
+void GlwStateTracker::UseFramebuffer( const glFramebuffer framebuffer ) {
+	if ( GetCanElide( KnownFramebuffer, m_framebuffer == framebuffer ) )
+		return;
+
+	m_framebuffer = framebuffer;
+
+	glBindFramebuffer( GL_FRAMEBUFFER, framebuffer );
+}
+
+void GlwStateTracker::UseTexture( const uint32_t unit, const glTexture texture ) {
+	if ( unit < TextureUnitCount ) {
+		if ( m_textures[ unit ] == texture ) {
+			m_elided += 1;
+
+			return;
+		}
+
+		m_textures[ unit ] = texture;
+	}
+
+	m_issued += 1;
+
+	glBindTextureUnit( unit, texture );
+}
+
+void GlwStateTracker::SetViewport( const glm::ivec4& viewport ) {
+	if ( GetCanElide( KnownViewport, m_viewport == viewport ) )
+		return;
+
+	m_viewport = viewport;
+
+	glViewport( viewport.x, viewport.y, viewport.z, viewport.w );
+}
+
+void GlwStateTracker::SetScissor( const glm::ivec4& scissor ) {
+	if ( GetCanElide( KnownScissor, m_scissor == scissor ) )
+		return;
+
+	m_scissor = scissor;
+
+	glScissor( scissor.x, scissor.y, scissor.z, scissor.w );
+}
+
+void GlwStateTracker::SetColorMask( const GlwStates state ) {
+	auto value   = (uint8_t)( ( state == GlwStates::Enable ) ? GL_TRUE : GL_FALSE );
+	auto is_same = true;
+
+	for ( auto color_mask : m_color_masks )
+		is_same = is_same && color_mask == value;
+
+	if ( is_same ) {
+		m_elided += 1;
+
+		return;
+	}
+
+	for ( auto& color_mask : m_color_masks )
+		color_mask = value;
+
+	m_issued += 1;
+
+	glColorMask( value, value, value, value );
+}
+
+void GlwStateTracker::SetColorMask( const uint32_t attachement, const GlwStates state ) {
+	auto value = (uint8_t)( ( state == GlwStates::Enable ) ? GL_TRUE : GL_FALSE );
+
+	if ( attachement < ColorMaskCount ) {
+		if ( m_color_masks[ attachement ] == value ) {
+			m_elided += 1;
+
+			return;
+		}
+
+		m_color_masks[ attachement ] = value;
+	}
+
+	m_issued += 1;
+
+	glColorMaski( attachement, value, value, value, value );
+}
+
+void GlwStateTracker::SetDepthFunction( const uint32_t function ) {
+	if ( GetCanElide( KnownDepthFunc, m_depth_function == function ) )
+		return;
+
+	m_depth_function = function;
+
+	glDepthFunc( function );
+}
+
+void GlwStateTracker::SetDepthRange( const float near, const float far ) {
+	auto range = glm::vec2{ near, far };
+
+	if ( GetCanElide( KnownDepthRange, m_depth_range == range ) )
+		return;
+
+	m_depth_range = range;
+
+	glDepthRange( near, far );
+}
+
+void GlwStateTracker::SetDepthMask( const GlwStates state ) {
+	auto enable = state == GlwStates::Enable;
+
+	if ( GetCanElide( KnownDepthMask, m_depth_mask == enable ) )
+		return;
+
+	m_depth_mask = enable;
+
+	glDepthMask( enable ? GL_TRUE : GL_FALSE );
+}
+
+void GlwStateTracker::SetBlendFunction(
+	const uint32_t source_rgb,
+	const uint32_t destination_rgb,
+	const uint32_t source_alpha,
+	const uint32_t destination_alpha
+) {
+	auto function = glm::uvec4{ source_rgb, destination_rgb, source_alpha, destination_alpha };
+
+	if ( GetCanElide( KnownBlendFunc, m_blend_function == function ) )
+		return;
+
+	m_blend_function = function;
+
+	glBlendFuncSeparate( source_rgb, destination_rgb, source_alpha, destination_alpha );
+}
+
+void GlwStateTracker::SetBlendEquation( const uint32_t equation ) {
+	if ( GetCanElide( KnownBlendEquation, m_blend_equation == equation ) )
+		return;
+
+	m_blend_equation = equation;
+
+	glBlendEquation( equation );
+}
+
+void GlwStateTracker::SetStencilFunction(
+	const uint32_t face,
+	const uint32_t function,
+	const uint32_t reference,
+	const uint32_t mask
+) {
+	auto first      = GetFaceIndex( face, GL_FRONT );
+	auto last       = GetFaceIndex( face, GL_BACK );
+	auto parameters = glm::uvec3{ function, reference, mask };
+	auto is_same    = m_stencil_functions[ first ] == parameters && m_stencil_functions[ last ] == parameters;
+
+	if ( GetCanElide( ( KnownStencilFront << first ) | ( KnownStencilFront << last ), is_same ) )
+		return;
+
+	m_stencil_functions[ first ] = parameters;
+	m_stencil_functions[ last ]  = parameters;
+
+	glStencilFuncSeparate( face, function, reference, mask );
+}
+
+void GlwStateTracker::SetStencilOperation(
+	const uint32_t face,
+	const uint32_t fail,
+	const uint32_t depth_fail,
+	const uint32_t pass
+) {
+	auto first      = GetFaceIndex( face, GL_FRONT );
+	auto last       = GetFaceIndex( face, GL_BACK );
+	auto operations = glm::uvec3{ fail, depth_fail, pass };
+	auto is_same    = m_stencil_operations[ first ] == operations && m_stencil_operations[ last ] == operations;
+
+	if ( GetCanElide( ( KnownStencilOpFront << first ) | ( KnownStencilOpFront << last ), is_same ) )
+		return;
+
+	m_stencil_operations[ first ] = operations;
+	m_stencil_operations[ last ]  = operations;
+
+	glStencilOpSeparate( face, fail, depth_fail, pass );
+}
+
+void GlwStateTracker::SetStencilMask( const uint32_t mask ) {
+	if ( GetCanElide( KnownStencilMask, m_stencil_mask == mask ) )
+		return;
+
+	m_stencil_mask = mask;
+
+	glStencilMask( mask );
+}
+
+void GlwStateTracker::SetClearColor( const glm::vec4& color ) {
+	if ( GetCanElide( KnownClearColor, m_clear_color == color ) )
+		return;
+
+	m_clear_color = color;
+
+	glClearColor( color.r, color.g, color.b, color.a );
+}
+
+void GlwStateTracker::SetClearDepth( const float depth ) {
+	if ( GetCanElide( KnownClearDepth, m_clear_depth == depth ) )
+		return;
+
+	m_clear_depth = depth;
+
+	glClearDepth( depth );
+}
+
+void GlwStateTracker::SetClearStencil( const int32_t stencil ) {
+	if ( GetCanElide( KnownClearStencil, m_clear_stencil == stencil ) )
+		return;
+
+	m_clear_stencil = stencil;
+
+	glClearStencil( stencil );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwStateTracker::GetCanElide( const uint32_t flag, const bool is_same ) {
+	auto result = ( m_known & flag ) == flag && is_same;
+
+	if ( result )
+		m_elided += 1;
+	else {
+		m_known  |= flag;
+		m_issued += 1;
+	}
+
+	return result;
+}
+
+uint32_t GlwStateTracker::GetFaceIndex( const uint32_t face, const uint32_t bound ) {
+	auto result = ( face == GL_BACK ) ? 1 : 0;
+
+	if ( face == GL_FRONT_AND_BACK )
+		result = ( bound == GL_BACK ) ? 1 : 0;
+
+	return (uint32_t)result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t GlwStateTracker::GetIssued( ) const {
+	return m_issued;
+}
+
+uint32_t GlwStateTracker::GetElided( ) const {
+	return m_elided;
+}
@@ -0,0 +1,320 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwGraphicSpecification.h"
+
+/**
+ * GlwStateTracker class
+ * @note : Shadow of the OpenGL context state, each setter only issue the GL
+ *         call when the requested value differ from the shadowed one. State
+ *         is unknown after construction or Invalidate, so the first call of
+ *         each kind always reach the driver.
+ **/
+class GlwStateTracker final {
+
+public:
+    static const uint32_t TextureUnitCount = 32;
+    static const uint32_t ColorMaskCount   = 8;
+
+private:
+    static const uint32_t KnownProgram        = 1 << 0;
+    static const uint32_t KnownVertexArray    = 1 << 1;
+    static const uint32_t KnownFramebuffer    = 1 << 2;
+    static const uint32_t KnownViewport       = 1 << 3;
+    static const uint32_t KnownScissor        = 1 << 4;
+    static const uint32_t KnownDepthFunc      = 1 << 5;
+    static const uint32_t KnownDepthRange     = 1 << 6;
+    static const uint32_t KnownDepthMask      = 1 << 7;
+    static const uint32_t KnownBlendFunc      = 1 << 8;
+    static const uint32_t KnownBlendEquation  = 1 << 9;
+    static const uint32_t KnownStencilFront   = 1 << 10;
+    static const uint32_t KnownStencilBack    = 1 << 11;
+    static const uint32_t KnownStencilOpFront = 1 << 12;
+    static const uint32_t KnownStencilOpBack  = 1 << 13;
+    static const uint32_t KnownStencilMask    = 1 << 14;
+    static const uint32_t KnownClearColor     = 1 << 15;
+    static const uint32_t KnownClearDepth     = 1 << 16;
+    static const uint32_t KnownClearStencil   = 1 << 17;
+
+private:
+    uint32_t m_known;
+    std::unordered_map<uint32_t, bool> m_capabilities;
+    glProgram m_program;
+    glVertexArray m_vertex_array;
+    glFramebuffer m_framebuffer;
+    glTexture m_textures[ TextureUnitCount ];
+    uint8_t m_color_masks[ ColorMaskCount ];
+    glm::ivec4 m_viewport;
+    glm::ivec4 m_scissor;
+    uint32_t m_depth_function;
+    glm::vec2 m_depth_range;
+    bool m_depth_mask;
+    glm::uvec4 m_blend_function;
+    uint32_t m_blend_equation;
+    glm::uvec3 m_stencil_functions[ 2 ];
+    glm::uvec3 m_stencil_operations[ 2 ];
+    uint32_t m_stencil_mask;
+    glm::vec4 m_clear_color;
+    float m_clear_depth;
+    int32_t m_clear_stencil;
+    uint32_t m_issued;
+    uint32_t m_elided;
+
+public:
+    /**
+     * Constructor
+     **/
+    GlwStateTracker( );
+
+    /**
+     * Destructor
+     **/
+    ~GlwStateTracker( ) = default;
+
+    /**
+     * Invalidate method
+     * @note : Forget shadowed state, use it after OpenGL calls made outside
+     *         of the tracker.
+     **/
+    void Invalidate( );
+
+    /**
+     * ResetCounters method
+     * @note : Reset issued and elided call counters.
+     **/
+    void ResetCounters( );
+
+    /**
+     * Toggle method
+     * @note : Enable or disable OpenGL capability.
+     * @param capability : Query OpenGL capability.
+     * @param state : Query capability state.
+     **/
+    void Toggle( const uint32_t capability, const GlwStates state );
+
+    /**
+     * UseProgram method
+     * @note : Bind OpenGL program.
+     * @param program : Query OpenGL program handle.
+     **/
+    void UseProgram( const glProgram program );
+
+    /**
+     * UseVertexArray method
+     * @note : Bind OpenGL vertex array.
+     * @param vertex_array : Query OpenGL vertex array handle.
+     **/
+    void UseVertexArray( const glVertexArray vertex_array );
+
+    /**
+     * UseFramebuffer method
+     * @note : Bind OpenGL framebuffer for draw and read.
+     * @param framebuffer : Query OpenGL framebuffer handle.
+     **/
+    void UseFramebuffer( const glFramebuffer framebuffer );
+
+    /**
+     * UseTexture method
+     * @note : Bind OpenGL texture to a texture unit.
+     * @param unit : Query texture unit.
+     * @param texture : Query OpenGL texture handle.
+     **/
+    void UseTexture( const uint32_t unit, const glTexture texture );
+
+    /**
+     * SetViewport method
+     * @note : Set viewport bounds.
+     * @param viewport : Query viewport bounds.
+     **/
+    void SetViewport( const glm::ivec4& viewport );
+
+    /**
+     * SetScissor method
+     * @note : Set scissor bounds.
+     * @param scissor : Query scissor bounds.
+     **/
+    void SetScissor( const glm::ivec4& scissor );
+
+    /**
+     * SetColorMask method
+     * @note : Set color write mask of all draw buffers.
+     * @param state : Query color write state.
+     **/
+    void SetColorMask( const GlwStates state );
+
+    /**
+     * SetColorMask method
+     * @note : Set color write mask of a draw buffer.
+     * @param attachement : Query draw buffer index.
+     * @param state : Query color write state.
+     **/
+    void SetColorMask( const uint32_t attachement, const GlwStates state );
+
+    /**
+     * SetDepthFunction method
+     * @note : Set depth test function.
+     * @param function : Query OpenGL depth function.
+     **/
+    void SetDepthFunction( const uint32_t function );
+
+    /**
+     * SetDepthRange method
+     * @note : Set depth range.
+     * @param near : Query depth range near value.
+     * @param far : Query depth range far value.
+     **/
+    void SetDepthRange( const float near, const float far );
+
+    /**
+     * SetDepthMask method
+     * @note : Set depth write state.
+     * @param state : Query depth write state.
+     **/
+    void SetDepthMask( const GlwStates state );
+
+    /**
+     * SetBlendFunction method
+     * @note : Set separate blend factors.
+     * @param source_rgb : Query color source factor.
+     * @param destination_rgb : Query color destination factor.
+     * @param source_alpha : Query alpha source factor.
+     * @param destination_alpha : Query alpha destination factor.
+     **/
+    void SetBlendFunction( 
+        const uint32_t source_rgb,
+        const uint32_t destination_rgb,
+        const uint32_t source_alpha,
+        const uint32_t destination_alpha
+    );
+
+    /**
+     * SetBlendEquation method
+     * @note : Set blend equation.
+     * @param equation : Query OpenGL blend equation.
+     **/
+    void SetBlendEquation( const uint32_t equation );
+
+    /**
+     * SetStencilFunction method
+     * @note : Set stencil function of a face.
+     * @param face : Query face as GL_FRONT, GL_BACK or GL_FRONT_AND_BACK.
+     * @param function : Query OpenGL stencil function.
+     * @param reference : Query stencil reference value.
+     * @param mask : Query stencil function mask.
+     **/
+    void SetStencilFunction( 
+        const uint32_t face,
+        const uint32_t function,
+        const uint32_t reference,
+        const uint32_t mask
+    );
+
+    /**
+     * SetStencilOperation method
+     * @note : Set stencil operations of a face.
+     * @param face : Query face as GL_FRONT, GL_BACK or GL_FRONT_AND_BACK.
+     * @param fail : Query stencil fail operation.
+     * @param depth_fail : Query depth fail operation.
+     * @param pass : Query depth and stencil pass operation.
+     **/
+    void SetStencilOperation( 
+        const uint32_t face,
+        const uint32_t fail,
+        const uint32_t depth_fail,
+        const uint32_t pass
+    );
+
+    /**
+     * SetStencilMask method
+     * @note : Set stencil write mask.
+     * @param mask : Query stencil write mask.
+     **/
+    void SetStencilMask( const uint32_t mask );
+
+    /**
+     * SetClearColor method
+     * @note : Set color clear value.
+     * @param color : Query clear color.
+     **/
+    void SetClearColor( const glm::vec4& color );
+
+    /**
+     * SetClearDepth method
+     * @note : Set depth clear value.
+     * @param depth : Query clear depth.
+     **/
+    void SetClearDepth( const float depth );
+
+    /**
+     * SetClearStencil method
+     * @note : Set stencil clear value.
+     * @param stencil : Query clear stencil.
+     **/
+    void SetClearStencil( const int32_t stencil );
+
+private:
+    /**
+     * GetCanElide function
+     * @note : Count call and check if it can be elided.
+     * @param flag : Query known state flags, all must be known to elide.
+     * @param is_same : Query if shadowed value equal requested value.
+     * @return : Return true when GL call can be elided.
+     **/
+    bool GetCanElide( const uint32_t flag, const bool is_same );
+
+    /**
+     * GetFaceIndex static function
+     * @note : Get first or last stencil shadow index covered by a face,
+     *         GL_FRONT_AND_BACK cover both front and back shadows.
+     * @param face : Query face as GL_FRONT, GL_BACK or GL_FRONT_AND_BACK.
+     * @param bound : Query GL_FRONT for first index or GL_BACK for last index.
+     * @return : Return face index.
+     **/
+    static uint32_t GetFaceIndex( const uint32_t face, const uint32_t bound );
+
+public:
+    /**
+     * GetIssued const function
+     * @note : Get count of GL calls issued since last counter reset.
+     * @return : Return issued call count.
+     **/
+    uint32_t GetIssued( ) const;
+
+    /**
+     * GetElided const function
+     * @note : Get count of GL calls elided since last counter reset.
+     * @return : Return elided call count.
+     **/
+    uint32_t GetElided( ) const;
+
+};
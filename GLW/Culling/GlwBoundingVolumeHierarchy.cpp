@@ -0,0 +1,868 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwBoundingVolumeHierarchy::GlwBoundingVolumeHierarchy( )
+	: m_nodes{ },
+	m_parents{ },
+	m_slots{ },
+	m_bounds{ },
+	m_items{ },
+	m_leaves{ },
+	m_free{ },
+	m_pending{ },
+	m_unbounded{ },
+	m_dirty{ },
+	m_is_dirty{ },
+	m_visible{ },
+	m_count{ 0 },
+	m_cost{ 0.f },
+	m_build_cost{ 0.f }
+{ }
+
+void GlwBoundingVolumeHierarchy::Reserve( const uint32_t capacity ) {
+	auto node_count = 2 * ( capacity / LeafSize + 1 );
+
+	m_nodes.reserve( node_count );
+	m_parents.reserve( node_count );
+	m_slots.reserve( ( node_count / 2 + 1 ) * LeafCapacity );
+	m_bounds.reserve( capacity );
+	m_items.reserve( capacity );
+	m_leaves.reserve( capacity );
+	m_visible.reserve( capacity );
+}
+
+void GlwBoundingVolumeHierarchy::Clear( ) {
+	m_nodes.clear( );
+	m_parents.clear( );
+	m_slots.clear( );
+	m_bounds.clear( );
+	m_items.clear( );
+	m_leaves.clear( );
+	m_free.clear( );
+	m_pending.clear( );
+	m_unbounded.clear( );
+	m_dirty.clear( );
+	m_is_dirty.clear( );
+
+	m_count		 = 0;
+	m_cost		 = 0.f;
+	m_build_cost = 0.f;
+}
+
+uint32_t GlwBoundingVolumeHierarchy::Insert( const GlwMeshBounds& bounds, const GlwCullingItem& item ) {
+	auto object = (uint32_t)m_leaves.size( );
+
+	if ( !m_free.empty( ) ) {
+		object = m_free.back( );
+
+		m_free.pop_back( );
+
+		m_bounds[ object ] = bounds;
+		m_items[ object ]  = item;
+		m_leaves[ object ] = Detached;
+	} else {
+		m_bounds.emplace_back( bounds );
+		m_items.emplace_back( item );
+		m_leaves.emplace_back( Detached );
+	}
+
+	m_count += 1;
+
+	Attach( object );
+
+	return object;
+}
+
+bool GlwBoundingVolumeHierarchy::Remove( const uint32_t object ) {
+	auto result = GetIsValid( object );
+
+	if ( result ) {
+		Detach( object );
+
+		m_bounds[ object ] = { };
+		m_leaves[ object ] = Removed;
+		m_count			  -= 1;
+
+		m_free.emplace_back( object );
+	}
+
+	return result;
+}
+
+bool GlwBoundingVolumeHierarchy::Update( const uint32_t object, const GlwMeshBounds& bounds ) {
+	auto result = GetIsValid( object );
+
+	if ( result ) {
+		auto leaf = m_leaves[ object ];
+
+		m_bounds[ object ] = bounds;
+
+		if ( leaf < m_nodes.size( ) && bounds.GetIsValid( ) )
+			MarkDirty( leaf );
+		else if ( leaf != Pending || !bounds.GetIsValid( ) ) {
+			Detach( object );
+			Attach( object );
+		}
+	}
+
+	return result;
+}
+
+void GlwBoundingVolumeHierarchy::Build( ) {
+	auto references = std::vector<GlwBoundingVolumeNode>{ };
+	auto tasks		= std::vector<uint32_t>{ };
+
+	references.reserve( m_count );
+
+	m_unbounded.clear( );
+
+	for ( auto object = (uint32_t)0; object < m_leaves.size( ); object++ ) {
+		if ( m_leaves[ object ] == Removed )
+			continue;
+
+		auto& bounds = m_bounds[ object ];
+
+		if ( bounds.GetIsValid( ) ) {
+			auto& reference = references.emplace_back( );
+
+			reference.Minimum = bounds.Minimum;
+			reference.Maximum = bounds.Maximum;
+			reference.First	  = object;
+		} else {
+			m_leaves[ object ] = Unbounded;
+
+			m_unbounded.emplace_back( object );
+		}
+	}
+
+	m_nodes.clear( );
+	m_parents.clear( );
+	m_slots.clear( );
+	m_pending.clear( );
+	m_dirty.clear( );
+
+	m_nodes.emplace_back( );
+	m_parents.emplace_back( UINT32_MAX );
+
+	tasks.emplace_back( 0 );
+	tasks.emplace_back( 0 );
+	tasks.emplace_back( (uint32_t)references.size( ) );
+
+	while ( !tasks.empty( ) ) {
+		auto count = tasks.back( ); tasks.pop_back( );
+		auto first = tasks.back( ); tasks.pop_back( );
+		auto node  = tasks.back( ); tasks.pop_back( );
+		auto centroid_min = glm::vec3{ FLT_MAX };
+		auto centroid_max = glm::vec3{ -FLT_MAX };
+
+		for ( auto index = first; index < first + count; index++ ) {
+			auto& reference = references[ index ];
+			auto centroid	= ( reference.Minimum + reference.Maximum ) * .5f;
+
+			m_nodes[ node ].Minimum = glm::min( m_nodes[ node ].Minimum, reference.Minimum );
+			m_nodes[ node ].Maximum = glm::max( m_nodes[ node ].Maximum, reference.Maximum );
+			centroid_min			= glm::min( centroid_min, centroid );
+			centroid_max			= glm::max( centroid_max, centroid );
+		}
+
+		if ( count <= LeafSize ) {
+			CreateLeaf( node, references, first, count );
+
+			continue;
+		}
+
+		auto left  = (uint32_t)m_nodes.size( );
+		auto split = Split( references, first, count, centroid_min, centroid_max );
+
+		m_nodes[ node ].First = left;
+		m_nodes[ node ].Count = GlwBoundingVolumeNode::Interior;
+
+		m_nodes.emplace_back( );
+		m_nodes.emplace_back( );
+		m_parents.emplace_back( node );
+		m_parents.emplace_back( node );
+
+		tasks.emplace_back( left );
+		tasks.emplace_back( first );
+		tasks.emplace_back( split );
+		tasks.emplace_back( left + 1 );
+		tasks.emplace_back( first + split );
+		tasks.emplace_back( count - split );
+	}
+
+	m_is_dirty.assign( m_nodes.size( ), 0 );
+
+	m_cost		 = ComputeCost( );
+	m_build_cost = GetCost( );
+}
+
+void GlwBoundingVolumeHierarchy::Refit( ) {
+	if ( m_nodes.empty( ) ) {
+		Build( );
+
+		return;
+	}
+
+	auto leaf_count = (uint32_t)m_dirty.size( );
+
+	for ( auto index = (uint32_t)0; index < leaf_count; index++ ) {
+		auto parent = m_parents[ m_dirty[ index ] ];
+
+		while ( parent != UINT32_MAX && m_is_dirty[ parent ] == 0 ) {
+			m_is_dirty[ parent ] = 1;
+
+			m_dirty.emplace_back( parent );
+
+			parent = m_parents[ parent ];
+		}
+	}
+
+	if ( m_dirty.size( ) * 16 < m_nodes.size( ) ) {
+		std::sort( m_dirty.begin( ), m_dirty.end( ), []( const uint32_t left, const uint32_t right ) { return left > right; } );
+
+		for ( auto node : m_dirty ) {
+			RefitNode( node );
+
+			m_is_dirty[ node ] = 0;
+		}
+	} else {
+		for ( auto node = (uint32_t)m_nodes.size( ); node > 0; node-- ) {
+			if ( m_is_dirty[ node - 1 ] == 0 )
+				continue;
+
+			RefitNode( node - 1 );
+
+			m_is_dirty[ node - 1 ] = 0;
+		}
+	}
+
+	m_dirty.clear( );
+
+	if ( GetCost( ) > m_build_cost * RebuildRatio || m_pending.size( ) * PendingRatio > m_count )
+		Build( );
+}
+
+void GlwBoundingVolumeHierarchy::Cull( const GlwFrustum& frustum, std::vector<uint32_t>& objects ) const {
+	auto stack = std::vector<uint32_t>{ };
+
+	objects.clear( );
+
+	if ( !m_nodes.empty( ) ) {
+		stack.reserve( 128 );
+		stack.emplace_back( 0 );
+		stack.emplace_back( ( 1u << GlwFrustum::PlaneCount ) - 1 );
+	}
+
+	while ( !stack.empty( ) ) {
+		auto mask = stack.back( ); stack.pop_back( );
+		auto node = stack.back( ); stack.pop_back( );
+		auto& current = m_nodes[ node ];
+
+		if ( !GetIsVisible( frustum, current.Minimum, current.Maximum, mask ) )
+			continue;
+
+		if ( current.GetIsLeaf( ) ) {
+			for ( auto slot = current.First; slot < current.First + current.Count; slot++ ) {
+				auto object = m_slots[ slot ];
+
+				if ( mask == 0 || frustum.GetIsVisible( m_bounds[ object ] ) )
+					objects.emplace_back( object );
+			}
+		} else {
+			stack.emplace_back( current.First + 1 );
+			stack.emplace_back( mask );
+			stack.emplace_back( current.First );
+			stack.emplace_back( mask );
+		}
+	}
+
+	for ( auto object : m_pending ) {
+		if ( frustum.GetIsVisible( m_bounds[ object ] ) )
+			objects.emplace_back( object );
+	}
+
+	objects.insert( objects.end( ), m_unbounded.begin( ), m_unbounded.end( ) );
+}
+
+void GlwBoundingVolumeHierarchy::Cull( const GlwFrustum& frustum, GlwRenderQueue& render_queue ) {
+	Cull( frustum, m_visible );
+
+	for ( auto object : m_visible ) {
+		auto& bounds = m_bounds[ object ];
+		auto& item   = m_items[ object ];
+		auto depth   = frustum.GetDepth( ( bounds.Minimum + bounds.Maximum ) * .5f );
+
+		render_queue.Push( item.RenderPass, item.IsTranslucent, depth, item.Item );
+	}
+}
+
+bool GlwBoundingVolumeHierarchy::Raycast(
+	const glm::vec3& origin,
+	const glm::vec3& direction,
+	const float max_distance,
+	uint32_t& object,
+	float& distance
+) const {
+	auto inverse = glm::vec3{ 1.f / direction.x, 1.f / direction.y, 1.f / direction.z };
+	auto closest   = max_distance;
+	auto stack	   = std::vector<uint32_t>{ };
+	auto distances = std::vector<float>{ };
+	auto hit	   = 0.f;
+	auto result	   = false;
+
+	if ( !m_nodes.empty( ) && GetRayDistance( origin, inverse, m_nodes[ 0 ].Minimum, m_nodes[ 0 ].Maximum, closest, hit ) ) {
+		stack.reserve( 64 );
+		distances.reserve( 64 );
+		stack.emplace_back( 0 );
+		distances.emplace_back( hit );
+	}
+
+	while ( !stack.empty( ) ) {
+		auto& current = m_nodes[ stack.back( ) ];
+		auto entry	  = distances.back( );
+
+		stack.pop_back( );
+		distances.pop_back( );
+
+		if ( entry > closest )
+			continue;
+
+		if ( current.GetIsLeaf( ) ) {
+			for ( auto slot = current.First; slot < current.First + current.Count; slot++ ) {
+				auto& bounds = m_bounds[ m_slots[ slot ] ];
+
+				if ( GetRayDistance( origin, inverse, bounds.Minimum, bounds.Maximum, closest, hit ) ) {
+					object  = m_slots[ slot ];
+					closest = hit;
+					result  = true;
+				}
+			}
+
+			continue;
+		}
+
+		auto& left		   = m_nodes[ current.First ];
+		auto& right		   = m_nodes[ current.First + 1 ];
+		auto left_distance  = 0.f;
+		auto right_distance = 0.f;
+		auto is_left		= GetRayDistance( origin, inverse, left.Minimum, left.Maximum, closest, left_distance );
+		auto is_right		= GetRayDistance( origin, inverse, right.Minimum, right.Maximum, closest, right_distance );
+
+		if ( is_left && is_right && left_distance <= right_distance ) {
+			stack.emplace_back( current.First + 1 );
+			stack.emplace_back( current.First );
+			distances.emplace_back( right_distance );
+			distances.emplace_back( left_distance );
+		} else if ( is_left && is_right ) {
+			stack.emplace_back( current.First );
+			stack.emplace_back( current.First + 1 );
+			distances.emplace_back( left_distance );
+			distances.emplace_back( right_distance );
+		} else if ( is_left ) {
+			stack.emplace_back( current.First );
+			distances.emplace_back( left_distance );
+		} else if ( is_right ) {
+			stack.emplace_back( current.First + 1 );
+			distances.emplace_back( right_distance );
+		}
+	}
+
+	for ( auto pending : m_pending ) {
+		auto& bounds = m_bounds[ pending ];
+
+		if ( GetRayDistance( origin, inverse, bounds.Minimum, bounds.Maximum, closest, hit ) ) {
+			object  = pending;
+			closest = hit;
+			result  = true;
+		}
+	}
+
+	if ( result )
+		distance = closest;
+
+	return result;
+}
+
+void GlwBoundingVolumeHierarchy::Query( const GlwMeshBounds& bounds, std::vector<uint32_t>& objects ) const {
+	auto stack = std::vector<uint32_t>{ };
+
+	objects.clear( );
+
+	if ( !m_nodes.empty( ) && bounds.GetIsValid( ) ) {
+		stack.reserve( 64 );
+		stack.emplace_back( 0 );
+	}
+
+	while ( !stack.empty( ) ) {
+		auto& current = m_nodes[ stack.back( ) ];
+
+		stack.pop_back( );
+
+		if ( !GetIsOverlap( current.Minimum, current.Maximum, bounds.Minimum, bounds.Maximum ) )
+			continue;
+
+		if ( current.GetIsLeaf( ) ) {
+			for ( auto slot = current.First; slot < current.First + current.Count; slot++ ) {
+				auto& other = m_bounds[ m_slots[ slot ] ];
+
+				if ( GetIsOverlap( other.Minimum, other.Maximum, bounds.Minimum, bounds.Maximum ) )
+					objects.emplace_back( m_slots[ slot ] );
+			}
+		} else {
+			stack.emplace_back( current.First + 1 );
+			stack.emplace_back( current.First );
+		}
+	}
+
+	for ( auto object : m_pending ) {
+		auto& other = m_bounds[ object ];
+
+		if ( GetIsOverlap( other.Minimum, other.Maximum, bounds.Minimum, bounds.Maximum ) )
+			objects.emplace_back( object );
+	}
+
+	objects.insert( objects.end( ), m_unbounded.begin( ), m_unbounded.end( ) );
+}
+
+void GlwBoundingVolumeHierarchy::Query( const glm::vec3& center, const float radius, std::vector<uint32_t>& objects ) const {
+	auto stack = std::vector<uint32_t>{ };
+
+	objects.clear( );
+
+	if ( !m_nodes.empty( ) && radius >= 0.f ) {
+		stack.reserve( 64 );
+		stack.emplace_back( 0 );
+	}
+
+	while ( !stack.empty( ) ) {
+		auto& current = m_nodes[ stack.back( ) ];
+
+		stack.pop_back( );
+
+		if ( !GetIsOverlap( current.Minimum, current.Maximum, center, radius ) )
+			continue;
+
+		if ( current.GetIsLeaf( ) ) {
+			for ( auto slot = current.First; slot < current.First + current.Count; slot++ ) {
+				auto& other = m_bounds[ m_slots[ slot ] ];
+
+				if ( GetIsOverlap( other.Minimum, other.Maximum, center, radius ) )
+					objects.emplace_back( m_slots[ slot ] );
+			}
+		} else {
+			stack.emplace_back( current.First + 1 );
+			stack.emplace_back( current.First );
+		}
+	}
+
+	for ( auto object : m_pending ) {
+		auto& other = m_bounds[ object ];
+
+		if ( GetIsOverlap( other.Minimum, other.Maximum, center, radius ) )
+			objects.emplace_back( object );
+	}
+
+	objects.insert( objects.end( ), m_unbounded.begin( ), m_unbounded.end( ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void GlwBoundingVolumeHierarchy::Attach( const uint32_t object ) {
+	auto& bounds = m_bounds[ object ];
+
+	if ( !bounds.GetIsValid( ) ) {
+		m_leaves[ object ] = Unbounded;
+
+		m_unbounded.emplace_back( object );
+
+		return;
+	}
+
+	auto node = (uint32_t)0;
+
+	while ( !m_nodes.empty( ) && !m_nodes[ node ].GetIsLeaf( ) ) {
+		auto left		  = m_nodes[ m_nodes[ node ].First ];
+		auto right		  = m_nodes[ m_nodes[ node ].First + 1 ];
+		auto left_area	  = left.GetArea( );
+		auto right_area   = right.GetArea( );
+
+		left.Minimum  = glm::min( left.Minimum, bounds.Minimum );
+		left.Maximum  = glm::max( left.Maximum, bounds.Maximum );
+		right.Minimum = glm::min( right.Minimum, bounds.Minimum );
+		right.Maximum = glm::max( right.Maximum, bounds.Maximum );
+
+		auto left_growth  = left.GetArea( ) - left_area;
+		auto right_growth = right.GetArea( ) - right_area;
+		auto is_left	  = left_growth < right_growth || ( left_growth == right_growth && left_area <= right_area );
+
+		node = m_nodes[ node ].First + ( is_left ? 0 : 1 );
+	}
+
+	if ( m_nodes.empty( ) || m_nodes[ node ].Count >= LeafCapacity ) {
+		m_leaves[ object ] = Pending;
+
+		m_pending.emplace_back( object );
+
+		return;
+	}
+
+	auto& leaf = m_nodes[ node ];
+
+	m_slots[ leaf.First + leaf.Count ] = object;
+	m_leaves[ object ]				   = node;
+	m_cost							  += leaf.GetArea( );
+	leaf.Count						  += 1;
+
+	MarkDirty( node );
+}
+
+void GlwBoundingVolumeHierarchy::Detach( const uint32_t object ) {
+	auto leaf = m_leaves[ object ];
+
+	if ( leaf < m_nodes.size( ) ) {
+		auto& node = m_nodes[ leaf ];
+		auto last  = node.First + node.Count - 1;
+
+		for ( auto slot = node.First; slot < last; slot++ ) {
+			if ( m_slots[ slot ] == object ) {
+				m_slots[ slot ] = m_slots[ last ];
+
+				break;
+			}
+		}
+
+		m_slots[ last ] = UINT32_MAX;
+		m_cost		   -= node.GetArea( );
+		node.Count	   -= 1;
+
+		MarkDirty( leaf );
+	} else if ( leaf == Pending ) {
+		auto pending = std::find( m_pending.begin( ), m_pending.end( ), object );
+
+		*pending = m_pending.back( );
+
+		m_pending.pop_back( );
+	} else if ( leaf == Unbounded ) {
+		auto unbounded = std::find( m_unbounded.begin( ), m_unbounded.end( ), object );
+
+		*unbounded = m_unbounded.back( );
+
+		m_unbounded.pop_back( );
+	}
+
+	m_leaves[ object ] = Detached;
+}
+
+void GlwBoundingVolumeHierarchy::MarkDirty( const uint32_t node ) {
+	if ( m_is_dirty[ node ] == 0 ) {
+		m_is_dirty[ node ] = 1;
+
+		m_dirty.emplace_back( node );
+	}
+}
+
+void GlwBoundingVolumeHierarchy::RefitNode( const uint32_t node ) {
+	auto& current = m_nodes[ node ];
+	auto is_leaf  = current.GetIsLeaf( );
+	auto weight   = is_leaf ? (float)current.Count : 1.f;
+
+	m_cost -= current.GetArea( ) * weight;
+
+	current.Minimum = glm::vec3{ FLT_MAX };
+	current.Maximum = glm::vec3{ -FLT_MAX };
+
+	if ( is_leaf ) {
+		for ( auto slot = current.First; slot < current.First + current.Count; slot++ ) {
+			auto& bounds = m_bounds[ m_slots[ slot ] ];
+
+			current.Minimum = glm::min( current.Minimum, bounds.Minimum );
+			current.Maximum = glm::max( current.Maximum, bounds.Maximum );
+		}
+	} else {
+		auto& left  = m_nodes[ current.First ];
+		auto& right = m_nodes[ current.First + 1 ];
+
+		current.Minimum = glm::min( left.Minimum, right.Minimum );
+		current.Maximum = glm::max( left.Maximum, right.Maximum );
+	}
+
+	m_cost += current.GetArea( ) * weight;
+}
+
+void GlwBoundingVolumeHierarchy::CreateLeaf(
+	const uint32_t node,
+	const std::vector<GlwBoundingVolumeNode>& references,
+	const uint32_t first,
+	const uint32_t count
+) {
+	auto& leaf = m_nodes[ node ];
+
+	leaf.First = (uint32_t)m_slots.size( );
+	leaf.Count = count;
+
+	for ( auto index = first; index < first + count; index++ ) {
+		m_leaves[ references[ index ].First ] = node;
+
+		m_slots.emplace_back( references[ index ].First );
+	}
+
+	m_slots.resize( leaf.First + LeafCapacity, UINT32_MAX );
+}
+
+uint32_t GlwBoundingVolumeHierarchy::Split(
+	std::vector<GlwBoundingVolumeNode>& references,
+	const uint32_t first,
+	const uint32_t count,
+	const glm::vec3& minimum,
+	const glm::vec3& maximum
+) const {
+	auto best_cost = FLT_MAX;
+	auto best_axis = -1;
+	auto best_bin  = (uint32_t)0;
+	auto begin	   = references.begin( ) + first;
+	auto end	   = begin + count;
+	auto extent	   = maximum - minimum;
+
+	GlwBoundingVolumeNode bins[ 3 ][ BinCount ];
+	float left_areas[ BinCount ];
+	uint32_t left_counts[ BinCount ];
+
+	auto scale = glm::vec3{ 0.f };
+
+	for ( auto axis = 0; axis < 3; axis++ )
+		scale[ axis ] = extent[ axis ] > 0.f ? (float)BinCount / extent[ axis ] : 0.f;
+
+	for ( auto iterator = begin; iterator < end; iterator++ ) {
+		auto centroid = ( iterator->Minimum + iterator->Maximum ) * .5f;
+
+		for ( auto axis = 0; axis < 3; axis++ ) {
+			auto bin  = std::min( BinCount - 1, (uint32_t)( ( centroid[ axis ] - minimum[ axis ] ) * scale[ axis ] ) );
+			auto& box = bins[ axis ][ bin ];
+
+			box.Minimum = glm::min( box.Minimum, iterator->Minimum );
+			box.Maximum = glm::max( box.Maximum, iterator->Maximum );
+			box.Count  += 1;
+		}
+	}
+
+	for ( auto axis = 0; axis < 3; axis++ ) {
+		if ( extent[ axis ] <= 0.f )
+			continue;
+
+		auto sweep = GlwBoundingVolumeNode{ };
+
+		for ( auto bin = (uint32_t)0; bin < BinCount - 1; bin++ ) {
+			sweep.Minimum = glm::min( sweep.Minimum, bins[ axis ][ bin ].Minimum );
+			sweep.Maximum = glm::max( sweep.Maximum, bins[ axis ][ bin ].Maximum );
+			sweep.Count  += bins[ axis ][ bin ].Count;
+
+			left_areas[ bin ]  = sweep.GetArea( );
+			left_counts[ bin ] = sweep.Count;
+		}
+
+		sweep = GlwBoundingVolumeNode{ };
+
+		for ( auto bin = BinCount - 1; bin > 0; bin-- ) {
+			sweep.Minimum = glm::min( sweep.Minimum, bins[ axis ][ bin ].Minimum );
+			sweep.Maximum = glm::max( sweep.Maximum, bins[ axis ][ bin ].Maximum );
+			sweep.Count  += bins[ axis ][ bin ].Count;
+
+			auto cost = left_areas[ bin - 1 ] * left_counts[ bin - 1 ] + sweep.GetArea( ) * sweep.Count;
+
+			if ( left_counts[ bin - 1 ] > 0 && sweep.Count > 0 && cost < best_cost ) {
+				best_cost = cost;
+				best_axis = axis;
+				best_bin  = bin - 1;
+			}
+		}
+	}
+
+	if ( best_axis >= 0 ) {
+		auto middle = std::partition( begin, end, [ & ]( const GlwBoundingVolumeNode& reference ) {
+			auto centroid = ( reference.Minimum[ best_axis ] + reference.Maximum[ best_axis ] ) * .5f;
+			auto bin	  = std::min( BinCount - 1, (uint32_t)( ( centroid - minimum[ best_axis ] ) * scale[ best_axis ] ) );
+
+			return bin <= best_bin;
+		} );
+
+		return (uint32_t)( middle - begin );
+	}
+
+	auto axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : ( extent.y >= extent.z ? 1 : 2 );
+	auto half = count / 2;
+
+	std::nth_element( begin, begin + half, end, [ & ]( const GlwBoundingVolumeNode& left, const GlwBoundingVolumeNode& right ) {
+		return left.Minimum[ axis ] + left.Maximum[ axis ] < right.Minimum[ axis ] + right.Maximum[ axis ];
+	} );
+
+	return half;
+}
+
+float GlwBoundingVolumeHierarchy::ComputeCost( ) const {
+	auto cost = 0.f;
+
+	for ( auto& node : m_nodes )
+		cost += node.GetArea( ) * ( node.GetIsLeaf( ) ? (float)node.Count : 1.f );
+
+	return cost;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwBoundingVolumeHierarchy::GetIsVisible(
+	const GlwFrustum& frustum,
+	const glm::vec3& minimum,
+	const glm::vec3& maximum,
+	uint32_t& mask
+) {
+	if ( minimum.x > maximum.x )
+		return false;
+
+	auto center = ( minimum + maximum ) * .5f;
+	auto extent = ( maximum - minimum ) * .5f;
+	auto result = true;
+
+	for ( auto index = (uint32_t)0; index < GlwFrustum::PlaneCount && result; index++ ) {
+		if ( ( mask & ( 1u << index ) ) == 0 )
+			continue;
+
+		auto& plane   = frustum.GetPlane( index );
+		auto distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+		auto reach	  = std::abs( plane.x ) * extent.x + std::abs( plane.y ) * extent.y + std::abs( plane.z ) * extent.z;
+
+		if ( distance - reach >= 0.f )
+			mask &= ~( 1u << index );
+
+		result = distance + reach >= 0.f;
+	}
+
+	return result;
+}
+
+bool GlwBoundingVolumeHierarchy::GetRayDistance(
+	const glm::vec3& origin,
+	const glm::vec3& inverse,
+	const glm::vec3& minimum,
+	const glm::vec3& maximum,
+	const float max_distance,
+	float& distance
+) {
+	if ( minimum.x > maximum.x )
+		return false;
+
+	auto entry = 0.f;
+	auto exit  = max_distance;
+
+	for ( auto axis = 0; axis < 3; axis++ ) {
+		auto near_distance = ( minimum[ axis ] - origin[ axis ] ) * inverse[ axis ];
+		auto far_distance  = ( maximum[ axis ] - origin[ axis ] ) * inverse[ axis ];
+
+		if ( near_distance > far_distance )
+			std::swap( near_distance, far_distance );
+
+		entry = near_distance > entry ? near_distance : entry;
+		exit  = far_distance < exit ? far_distance : exit;
+	}
+
+	auto result = entry <= exit;
+
+	if ( result )
+		distance = entry;
+
+	return result;
+}
+
+bool GlwBoundingVolumeHierarchy::GetIsOverlap(
+	const glm::vec3& minimum,
+	const glm::vec3& maximum,
+	const glm::vec3& other_minimum,
+	const glm::vec3& other_maximum
+) {
+	return minimum.x <= other_maximum.x && minimum.y <= other_maximum.y && minimum.z <= other_maximum.z &&
+		   maximum.x >= other_minimum.x && maximum.y >= other_minimum.y && maximum.z >= other_minimum.z;
+}
+
+bool GlwBoundingVolumeHierarchy::GetIsOverlap(
+	const glm::vec3& minimum,
+	const glm::vec3& maximum,
+	const glm::vec3& center,
+	const float radius
+) {
+	auto closest = glm::clamp( center, minimum, maximum );
+	auto offset  = closest - center;
+
+	return minimum.x <= maximum.x && glm::dot( offset, offset ) <= radius * radius;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t GlwBoundingVolumeHierarchy::GetCount( ) const {
+	return m_count;
+}
+
+uint32_t GlwBoundingVolumeHierarchy::GetNodeCount( ) const {
+	return (uint32_t)m_nodes.size( );
+}
+
+uint32_t GlwBoundingVolumeHierarchy::GetPendingCount( ) const {
+	return (uint32_t)m_pending.size( );
+}
+
+uint32_t GlwBoundingVolumeHierarchy::GetUnboundedCount( ) const {
+	return (uint32_t)m_unbounded.size( );
+}
+
+float GlwBoundingVolumeHierarchy::GetCost( ) const {
+	auto area = m_nodes.empty( ) ? 0.f : m_nodes[ 0 ].GetArea( );
+
+	return area > 0.f ? m_cost / area : 0.f;
+}
+
+bool GlwBoundingVolumeHierarchy::GetIsValid( const uint32_t object ) const {
+	return object < m_leaves.size( ) && m_leaves[ object ] != Removed;
+}
+
+const GlwMeshBounds& GlwBoundingVolumeHierarchy::GetBounds( const uint32_t object ) const {
+	return m_bounds[ object ];
+}
+
+const GlwCullingItem& GlwBoundingVolumeHierarchy::GetItem( const uint32_t object ) const {
+	return m_items[ object ];
+}
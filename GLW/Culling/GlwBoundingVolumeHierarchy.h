@@ -0,0 +1,406 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwBoundingVolumeNode.h"
+
+/**
+ * GlwBoundingVolumeHierarchy final class
+ * @note : Bounding volume hierarchy of object bounds built with a binned 
+ *		   surface area heuristic, used to answer frustum, ray and overlap 
+ *		   queries without touching every object.
+ *		   Moving objects only refit their leaf and its parents, inserted 
+ *		   objects go down the tree to the leaf that grow the least and 
+ *		   wait in a pending list when that leaf is full. The tree is 
+ *		   rebuilt by Refit when its cost or its pending list grow too much.
+ *		   Objects without valid bounds are kept in an unbounded list, Cull
+ *		   and Query always return them.
+ **/
+class GlwBoundingVolumeHierarchy final {
+
+public:
+	static const uint32_t LeafSize     = 4;
+	static const uint32_t LeafCapacity = 8;
+	static const uint32_t BinCount     = 16;
+	static const uint32_t PendingRatio = 32;
+	static constexpr float RebuildRatio = 1.5f;
+
+private:
+	static constexpr uint32_t Detached  = UINT32_MAX;
+	static constexpr uint32_t Pending   = UINT32_MAX - 1;
+	static constexpr uint32_t Removed   = UINT32_MAX - 2;
+	static constexpr uint32_t Unbounded = UINT32_MAX - 3;
+
+	std::vector<GlwBoundingVolumeNode> m_nodes;
+	std::vector<uint32_t> m_parents;
+	std::vector<uint32_t> m_slots;
+	std::vector<GlwMeshBounds> m_bounds;
+	std::vector<GlwCullingItem> m_items;
+	std::vector<uint32_t> m_leaves;
+	std::vector<uint32_t> m_free;
+	std::vector<uint32_t> m_pending;
+	std::vector<uint32_t> m_unbounded;
+	std::vector<uint32_t> m_dirty;
+	std::vector<uint8_t> m_is_dirty;
+	std::vector<uint32_t> m_visible;
+	uint32_t m_count;
+	float m_cost;
+	float m_build_cost;
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwBoundingVolumeHierarchy( );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwBoundingVolumeHierarchy( ) = default;
+
+	/**
+	 * Reserve method
+	 * @note : Reserve memory for query object count.
+	 * @param capacity : Query object count.
+	 **/
+	void Reserve( const uint32_t capacity );
+
+	/**
+	 * Clear method
+	 * @note : Remove every object and node.
+	 **/
+	void Clear( );
+
+	/**
+	 * Insert function
+	 * @note : Add object, removed object indexes are reused. Object is 
+	 *		   queried once Build or Refit has been called at least once.
+	 * @param bounds : Query world space bounds, see GlwMeshBounds::Transform.
+	 * @param item : Query draw pushed to render queue when visible.
+	 * @return : Return object index.
+	 **/
+	uint32_t Insert( const GlwMeshBounds& bounds, const GlwCullingItem& item );
+
+	/**
+	 * Remove function
+	 * @note : Remove object, its leaf is refitted on next Refit call.
+	 * @param object : Query object index.
+	 * @return : True when object exist.
+	 **/
+	bool Remove( const uint32_t object );
+
+	/**
+	 * Update function
+	 * @note : Update world space bounds of an object, its leaf is refitted
+	 *		   on next Refit call.
+	 * @param object : Query object index.
+	 * @param bounds : Query world space bounds.
+	 * @return : True when object exist.
+	 **/
+	bool Update( const uint32_t object, const GlwMeshBounds& bounds );
+
+	/**
+	 * Build method
+	 * @note : Rebuild the whole tree from object bounds.
+	 **/
+	void Build( );
+
+	/**
+	 * Refit method
+	 * @note : Refit nodes of updated objects, call once per frame after 
+	 *		   updates. Children are stored after their parent so nodes are
+	 *		   refitted in decreasing index order. Tree is rebuilt when its cost exceed build cost by
+	 *		   RebuildRatio or when pending objects exceed 1 / PendingRatio
+	 *		   of object count.
+	 **/
+	void Refit( );
+
+	/**
+	 * Cull const method
+	 * @note : Get objects intersecting the frustum.
+	 * @param frustum : Query world space frustum.
+	 * @param objects : Query visible object indexes, cleared first.
+	 **/
+	void Cull( const GlwFrustum& frustum, std::vector<uint32_t>& objects ) const;
+
+	/**
+	 * Cull method
+	 * @note : Push objects intersecting the frustum to render queue, depth 
+	 *		   is read from the frustum near and far planes.
+	 * @param frustum : Query world space frustum.
+	 * @param render_queue : Query render queue.
+	 **/
+	void Cull( const GlwFrustum& frustum, GlwRenderQueue& render_queue );
+
+	/**
+	 * Raycast const function
+	 * @note : Find closest object box hit by a ray, hit can be refined 
+	 *		   against object triangles by the caller. Objects without valid
+	 *		   bounds have no box and are never hit.
+	 * @param origin : Query ray origin.
+	 * @param direction : Query ray direction.
+	 * @param max_distance : Query maximum hit distance along direction.
+	 * @param object : Query hit object index.
+	 * @param distance : Query hit distance along direction.
+	 * @return : True when an object is hit.
+	 **/
+	bool Raycast(
+		const glm::vec3& origin,
+		const glm::vec3& direction,
+		const float max_distance,
+		uint32_t& object,
+		float& distance
+	) const;
+
+	/**
+	 * Query const method
+	 * @note : Get objects whose box overlap query box, like shadow casters
+	 *		   inside a light volume.
+	 * @param bounds : Query world space bounds.
+	 * @param objects : Query overlapping object indexes, cleared first.
+	 **/
+	void Query( const GlwMeshBounds& bounds, std::vector<uint32_t>& objects ) const;
+
+	/**
+	 * Query const method
+	 * @note : Get objects whose box overlap query sphere, like objects lit 
+	 *		   by a point light.
+	 * @param center : Query sphere center.
+	 * @param radius : Query sphere radius.
+	 * @param objects : Query overlapping object indexes, cleared first.
+	 **/
+	void Query( const glm::vec3& center, const float radius, std::vector<uint32_t>& objects ) const;
+
+private:
+	/**
+	 * Attach method
+	 * @note : Add object to the leaf that grow the least, to pending list or
+	 *		   to unbounded list when its bounds are invalid.
+	 * @param object : Query object index.
+	 **/
+	void Attach( const uint32_t object );
+
+	/**
+	 * Detach method
+	 * @note : Remove object from its leaf, from pending list or from unbounded list.
+	 * @param object : Query object index.
+	 **/
+	void Detach( const uint32_t object );
+
+	/**
+	 * MarkDirty method
+	 * @note : Queue node for next refit.
+	 * @param node : Query node index.
+	 **/
+	void MarkDirty( const uint32_t node );
+
+	/**
+	 * RefitNode method
+	 * @note : Recompute node box from its objects or its children.
+	 * @param node : Query node index.
+	 **/
+	void RefitNode( const uint32_t node );
+
+	/**
+	 * CreateLeaf method
+	 * @note : Store objects in node slots, LeafCapacity slots are reserved.
+	 * @param node : Query node index.
+	 * @param references : Query build list, object boxes with object index
+	 *					   stored in First.
+	 * @param first : Query first object in build list.
+	 * @param count : Query object count.
+	 **/
+	void CreateLeaf( 
+		const uint32_t node, 
+		const std::vector<GlwBoundingVolumeNode>& references, 
+		const uint32_t first, 
+		const uint32_t count 
+	);
+
+	/**
+	 * Split function
+	 * @note : Partition build list range with binned surface area heuristic,
+	 *		   fallback to a median split on largest axis.
+	 * @param references : Query build list.
+	 * @param first : Query first object in build list.
+	 * @param count : Query object count.
+	 * @param minimum : Query centroid bounds minimum.
+	 * @param maximum : Query centroid bounds maximum.
+	 * @return : Return object count of left child.
+	 **/
+	uint32_t Split(
+		std::vector<GlwBoundingVolumeNode>& references,
+		const uint32_t first,
+		const uint32_t count,
+		const glm::vec3& minimum,
+		const glm::vec3& maximum
+	) const;
+
+	/**
+	 * ComputeCost function
+	 * @note : Sum node areas, leaf areas weighted by their object count.
+	 * @return : Return unnormalized tree cost.
+	 **/
+	float ComputeCost( ) const;
+
+private:
+	/**
+	 * GetIsVisible static function
+	 * @note : Test box against frustum planes in mask, planes fully 
+	 *		   containing the box are removed from mask.
+	 * @param frustum : Query world space frustum.
+	 * @param minimum : Query box minimum.
+	 * @param maximum : Query box maximum.
+	 * @param mask : Query plane mask, bit N for plane N.
+	 * @return : Return false when box is outside.
+	 **/
+	static bool GetIsVisible(
+		const GlwFrustum& frustum,
+		const glm::vec3& minimum,
+		const glm::vec3& maximum,
+		uint32_t& mask
+	);
+
+	/**
+	 * GetRayDistance static function
+	 * @note : Slab test of a ray against a box.
+	 * @param origin : Query ray origin.
+	 * @param inverse : Query inverse of ray direction.
+	 * @param minimum : Query box minimum.
+	 * @param maximum : Query box maximum.
+	 * @param max_distance : Query maximum hit distance.
+	 * @param distance : Query entry distance, 0 when origin is inside.
+	 * @return : Return true when box is hit before max distance.
+	 **/
+	static bool GetRayDistance(
+		const glm::vec3& origin,
+		const glm::vec3& inverse,
+		const glm::vec3& minimum,
+		const glm::vec3& maximum,
+		const float max_distance,
+		float& distance
+	);
+
+	/**
+	 * GetIsOverlap static function
+	 * @note : Test box against box.
+	 * @param minimum : Query box minimum.
+	 * @param maximum : Query box maximum.
+	 * @param other_minimum : Query other box minimum.
+	 * @param other_maximum : Query other box maximum.
+	 * @return : Return true when they overlap.
+	 **/
+	static bool GetIsOverlap(
+		const glm::vec3& minimum,
+		const glm::vec3& maximum,
+		const glm::vec3& other_minimum,
+		const glm::vec3& other_maximum
+	);
+
+	/**
+	 * GetIsOverlap static function
+	 * @note : Test box against sphere.
+	 * @param minimum : Query box minimum.
+	 * @param maximum : Query box maximum.
+	 * @param center : Query sphere center.
+	 * @param radius : Query sphere radius.
+	 * @return : Return true when they overlap.
+	 **/
+	static bool GetIsOverlap(
+		const glm::vec3& minimum,
+		const glm::vec3& maximum,
+		const glm::vec3& center,
+		const float radius
+	);
+
+public:
+	/**
+	 * GetCount const function
+	 * @note : Get object count, removed objects excluded.
+	 * @return : Return object count value.
+	 **/
+	uint32_t GetCount( ) const;
+
+	/**
+	 * GetNodeCount const function
+	 * @note : Get tree node count.
+	 * @return : Return node count value.
+	 **/
+	uint32_t GetNodeCount( ) const;
+
+	/**
+	 * GetPendingCount const function
+	 * @note : Get count of objects waiting for next rebuild.
+	 * @return : Return pending object count value.
+	 **/
+	uint32_t GetPendingCount( ) const;
+
+	/**
+	 * GetUnboundedCount const function
+	 * @note : Get count of objects without valid bounds, never culled.
+	 * @return : Return unbounded object count value.
+	 **/
+	uint32_t GetUnboundedCount( ) const;
+
+	/**
+	 * GetCost const function
+	 * @note : Get surface area heuristic cost of the tree.
+	 * @return : Return cost relative to root area.
+	 **/
+	float GetCost( ) const;
+
+	/**
+	 * GetIsValid const function
+	 * @note : Get if object exist.
+	 * @param object : Query object index.
+	 * @return : Return true when object is not removed.
+	 **/
+	bool GetIsValid( const uint32_t object ) const;
+
+	/**
+	 * GetBounds const function
+	 * @note : Get object bounds.
+	 * @param object : Query object index.
+	 * @return : Return constant reference to object bounds.
+	 **/
+	const GlwMeshBounds& GetBounds( const uint32_t object ) const;
+
+	/**
+	 * GetItem const function
+	 * @note : Get object draw.
+	 * @param object : Query object index.
+	 * @return : Return constant reference to object draw.
+	 **/
+	const GlwCullingItem& GetItem( const uint32_t object ) const;
+
+};
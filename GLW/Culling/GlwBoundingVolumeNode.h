@@ -0,0 +1,66 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwFrustumCuller.h"
+
+struct GlwBoundingVolumeNode {
+
+	static const uint32_t Interior = UINT32_MAX;
+
+	glm::vec3 Minimum;
+	uint32_t First;
+	glm::vec3 Maximum;
+	uint32_t Count;
+
+	/**
+	 * Constructor
+	 **/
+	GlwBoundingVolumeNode( );
+
+	/**
+	 * GetIsLeaf const function
+	 * @note : Get if node store objects, interior nodes store their left 
+	 *		   child in First, their right child follow it.
+	 * @return : Return true when Count is not Interior.
+	 **/
+	bool GetIsLeaf( ) const;
+
+	/**
+	 * GetArea const function
+	 * @note : Get node box surface area.
+	 * @return : Return surface area, 0 for empty node.
+	 **/
+	float GetArea( ) const;
+
+};
@@ -0,0 +1,97 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwFrustum::GlwFrustum( )
+	: GlwFrustum{ glm::mat4{ 1.f } }
+{ }
+
+GlwFrustum::GlwFrustum( const glm::mat4& view_projection )
+	: m_planes{ }
+{
+	for ( auto axis = 0; axis < 3; axis++ ) {
+		for ( auto side = 0; side < 2; side++ ) {
+			auto sign   = side == 0 ? 1.f : -1.f;
+			auto& plane = m_planes[ axis * 2 + side ];
+
+			for ( auto column = 0; column < 4; column++ )
+				plane[ column ] = view_projection[ column ][ 3 ] + sign * view_projection[ column ][ axis ];
+
+			auto length = glm::length( glm::vec3{ plane.x, plane.y, plane.z } );
+
+			if ( length > 0.f )
+				plane = plane / length;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwFrustum::GetIsVisible( const GlwMeshBounds& bounds ) const {
+	if ( !bounds.GetIsValid( ) )
+		return true;
+
+	auto center = ( bounds.Minimum + bounds.Maximum ) * .5f;
+	auto extent = bounds.GetExtent( );
+	auto result = true;
+
+	for ( auto index = (uint32_t)0; index < PlaneCount && result; index++ ) {
+		auto& plane = m_planes[ index ];
+		auto normal = glm::vec3{ plane.x, plane.y, plane.z };
+		auto sphere = glm::dot( normal, bounds.Center ) + plane.w;
+		auto box    = glm::dot( normal, center ) + plane.w;
+		auto reach  = std::abs( normal.x ) * extent.x + std::abs( normal.y ) * extent.y + std::abs( normal.z ) * extent.z;
+
+		result = sphere >= -bounds.Radius && box >= -reach;
+	}
+
+	return result;
+}
+
+float GlwFrustum::GetDepth( const glm::vec3& point ) const {
+	auto& near_plane = m_planes[ Near ];
+	auto& far_plane  = m_planes[ Far ];
+	auto front       = glm::dot( glm::vec3{ near_plane.x, near_plane.y, near_plane.z }, point ) + near_plane.w;
+	auto back        = glm::dot( glm::vec3{ far_plane.x, far_plane.y, far_plane.z }, point ) + far_plane.w;
+	auto total       = front + back;
+
+	return total > 0.f ? glm::clamp( front / total, 0.f, 1.f ) : 0.f;
+}
+
+const glm::vec4& GlwFrustum::GetPlane( const uint32_t plane ) const {
+	return m_planes[ plane < PlaneCount ? plane : 0 ];
+}
@@ -0,0 +1,97 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "../Commands/GlwRenderQueue.h"
+
+/**
+ * GlwFrustum class
+ * @note : View frustum planes extracted from an OpenGL view projection 
+ *		   matrix, plane normals point inside the frustum.
+ **/
+class GlwFrustum final {
+
+public:
+	static const uint32_t PlaneCount = 6;
+	static const uint32_t Near       = 4;
+	static const uint32_t Far        = 5;
+
+private:
+	glm::vec4 m_planes[ PlaneCount ];
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwFrustum( );
+
+	/**
+	 * Constructor
+	 * @param view_projection : Query view projection matrix, world bounds are
+	 *							tested when it include no model transform.
+	 **/
+	GlwFrustum( const glm::mat4& view_projection );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwFrustum( ) = default;
+
+public:
+	/**
+	 * GetIsVisible const function
+	 * @note : Get if bounds intersect the frustum, bounds are outside when 
+	 *		   their sphere or their box is behind a plane. Invalid bounds
+	 *		   are always visible.
+	 * @param bounds : Query bounds in frustum space.
+	 * @return : Return true when bounds can be visible.
+	 **/
+	bool GetIsVisible( const GlwMeshBounds& bounds ) const;
+
+	/**
+	 * GetDepth const function
+	 * @note : Get normalized depth of a point between near and far planes.
+	 * @param point : Query point.
+	 * @return : Return depth, 0 on near plane and 1 on far plane.
+	 **/
+	float GetDepth( const glm::vec3& point ) const;
+
+	/**
+	 * GetPlane const function
+	 * @note : Get frustum plane, left, right, bottom, top, near then far.
+	 * @param plane : Query plane index.
+	 * @return : Return normalized plane, xyz normal and w distance.
+	 **/
+	const glm::vec4& GetPlane( const uint32_t plane ) const;
+
+};
@@ -0,0 +1,300 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwFrustumCuller::GlwFrustumCuller( )
+	: m_center_x{ },
+	m_center_y{ },
+	m_center_z{ },
+	m_extent_x{ },
+	m_extent_y{ },
+	m_extent_z{ },
+	m_radius{ },
+	m_items{ },
+	m_visible{ },
+	m_visible_count{ 0 }
+{ }
+
+void GlwFrustumCuller::Reserve( const uint32_t capacity ) {
+	m_center_x.reserve( capacity );
+	m_center_y.reserve( capacity );
+	m_center_z.reserve( capacity );
+	m_extent_x.reserve( capacity );
+	m_extent_y.reserve( capacity );
+	m_extent_z.reserve( capacity );
+	m_radius.reserve( capacity );
+	m_items.reserve( capacity );
+	m_visible.reserve( capacity );
+}
+
+void GlwFrustumCuller::Reset( ) {
+	m_center_x.clear( );
+	m_center_y.clear( );
+	m_center_z.clear( );
+	m_extent_x.clear( );
+	m_extent_y.clear( );
+	m_extent_z.clear( );
+	m_radius.clear( );
+	m_items.clear( );
+
+	m_visible_count = 0;
+}
+
+void GlwFrustumCuller::Push( const GlwMeshBounds& bounds, const GlwCullingItem& item ) {
+	auto object = GetCount( );
+
+	m_center_x.emplace_back( 0.f );
+	m_center_y.emplace_back( 0.f );
+	m_center_z.emplace_back( 0.f );
+	m_extent_x.emplace_back( 0.f );
+	m_extent_y.emplace_back( 0.f );
+	m_extent_z.emplace_back( 0.f );
+	m_radius.emplace_back( 0.f );
+	m_items.emplace_back( item );
+
+	Store( object, bounds );
+}
+
+bool GlwFrustumCuller::Update( const uint32_t object, const GlwMeshBounds& bounds ) {
+	auto result = object < GetCount( );
+
+	if ( result )
+		Store( object, bounds );
+
+	return result;
+}
+
+void GlwFrustumCuller::Cull( const GlwFrustum& frustum ) {
+	auto count = GetCount( );
+	auto first = (uint32_t)0;
+
+	m_visible.resize( count );
+	m_visible_count = 0;
+
+#	ifdef GLW_AVX2
+	first = CullAVX2( frustum );
+#	elif defined( GLW_SSE2 )
+	first = CullSSE2( frustum );
+#	endif
+
+	CullScalar( frustum, first, count );
+}
+
+void GlwFrustumCuller::Cull( const GlwFrustum& frustum, GlwRenderQueue& render_queue ) {
+	Cull( frustum );
+
+	for ( auto visible = (uint32_t)0; visible < m_visible_count; visible++ ) {
+		auto object = m_visible[ visible ];
+		auto center = glm::vec3{ m_center_x[ object ], m_center_y[ object ], m_center_z[ object ] };
+		auto& item  = m_items[ object ];
+
+		render_queue.Push( item.RenderPass, item.IsTranslucent, frustum.GetDepth( center ), item.Item );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void GlwFrustumCuller::Store( const uint32_t object, const GlwMeshBounds& bounds ) {
+	if ( !bounds.GetIsValid( ) ) {
+		m_center_x[ object ] = 0.f;
+		m_center_y[ object ] = 0.f;
+		m_center_z[ object ] = 0.f;
+		m_extent_x[ object ] = FLT_MAX;
+		m_extent_y[ object ] = FLT_MAX;
+		m_extent_z[ object ] = FLT_MAX;
+		m_radius[ object ]   = FLT_MAX;
+
+		return;
+	}
+
+	auto center = ( bounds.Minimum + bounds.Maximum ) * .5f;
+	auto extent = bounds.GetExtent( );
+
+	m_center_x[ object ] = center.x;
+	m_center_y[ object ] = center.y;
+	m_center_z[ object ] = center.z;
+	m_extent_x[ object ] = extent.x;
+	m_extent_y[ object ] = extent.y;
+	m_extent_z[ object ] = extent.z;
+	m_radius[ object ]   = bounds.Radius + glm::distance( center, bounds.Center );
+}
+
+void GlwFrustumCuller::CullScalar( const GlwFrustum& frustum, const uint32_t first, const uint32_t last ) {
+	for ( auto object = first; object < last; object++ ) {
+		auto is_visible = true;
+
+		for ( auto index = (uint32_t)0; index < GlwFrustum::PlaneCount && is_visible; index++ ) {
+			auto& plane   = frustum.GetPlane( index );
+			auto distance = plane.x * m_center_x[ object ] + plane.y * m_center_y[ object ] + plane.z * m_center_z[ object ] + plane.w;
+			auto reach    = std::abs( plane.x ) * m_extent_x[ object ] + std::abs( plane.y ) * m_extent_y[ object ] + std::abs( plane.z ) * m_extent_z[ object ];
+
+			is_visible = distance + std::min( reach, m_radius[ object ] ) >= 0.f;
+		}
+
+		m_visible[ m_visible_count ] = object;
+		m_visible_count             += is_visible ? 1 : 0;
+	}
+}
+
+#ifdef GLW_SSE2
+uint32_t GlwFrustumCuller::CullSSE2( const GlwFrustum& frustum ) {
+	__m128 planes[ GlwFrustum::PlaneCount ][ 4 ];
+	__m128 reaches[ GlwFrustum::PlaneCount ][ 3 ];
+
+	for ( auto index = (uint32_t)0; index < GlwFrustum::PlaneCount; index++ ) {
+		auto& plane = frustum.GetPlane( index );
+
+		for ( auto component = 0; component < 4; component++ )
+			planes[ index ][ component ] = _mm_set1_ps( plane[ component ] );
+
+		for ( auto component = 0; component < 3; component++ )
+			reaches[ index ][ component ] = _mm_set1_ps( std::abs( plane[ component ] ) );
+	}
+
+	auto count  = GetCount( );
+	auto object = (uint32_t)0;
+	auto zero   = _mm_setzero_ps( );
+
+	for ( ; object + 4 <= count; object += 4 ) {
+		auto center_x   = _mm_loadu_ps( m_center_x.data( ) + object );
+		auto center_y   = _mm_loadu_ps( m_center_y.data( ) + object );
+		auto center_z   = _mm_loadu_ps( m_center_z.data( ) + object );
+		auto extent_x   = _mm_loadu_ps( m_extent_x.data( ) + object );
+		auto extent_y   = _mm_loadu_ps( m_extent_y.data( ) + object );
+		auto extent_z   = _mm_loadu_ps( m_extent_z.data( ) + object );
+		auto radius     = _mm_loadu_ps( m_radius.data( ) + object );
+		auto is_visible = _mm_cmpeq_ps( zero, zero );
+
+		for ( auto index = (uint32_t)0; index < GlwFrustum::PlaneCount; index++ ) {
+			auto distance = _mm_add_ps( 
+				_mm_add_ps( _mm_mul_ps( planes[ index ][ 0 ], center_x ), _mm_mul_ps( planes[ index ][ 1 ], center_y ) ),
+				_mm_add_ps( _mm_mul_ps( planes[ index ][ 2 ], center_z ), planes[ index ][ 3 ] )
+			);
+			auto reach = _mm_add_ps( 
+				_mm_add_ps( _mm_mul_ps( reaches[ index ][ 0 ], extent_x ), _mm_mul_ps( reaches[ index ][ 1 ], extent_y ) ),
+				_mm_mul_ps( reaches[ index ][ 2 ], extent_z )
+			);
+
+			distance   = _mm_add_ps( distance, _mm_min_ps( reach, radius ) );
+			is_visible = _mm_and_ps( is_visible, _mm_cmpge_ps( distance, zero ) );
+		}
+
+		auto mask = _mm_movemask_ps( is_visible );
+
+		for ( auto lane = 0; lane < 4; lane++ ) {
+			m_visible[ m_visible_count ] = object + lane;
+			m_visible_count             += ( mask >> lane ) & 1;
+		}
+	}
+
+	return object;
+}
+#endif
+
+#ifdef GLW_AVX2
+uint32_t GlwFrustumCuller::CullAVX2( const GlwFrustum& frustum ) {
+	__m256 planes[ GlwFrustum::PlaneCount ][ 4 ];
+	__m256 reaches[ GlwFrustum::PlaneCount ][ 3 ];
+
+	for ( auto index = (uint32_t)0; index < GlwFrustum::PlaneCount; index++ ) {
+		auto& plane = frustum.GetPlane( index );
+
+		for ( auto component = 0; component < 4; component++ )
+			planes[ index ][ component ] = _mm256_set1_ps( plane[ component ] );
+
+		for ( auto component = 0; component < 3; component++ )
+			reaches[ index ][ component ] = _mm256_set1_ps( std::abs( plane[ component ] ) );
+	}
+
+	auto count  = GetCount( );
+	auto object = (uint32_t)0;
+	auto zero   = _mm256_setzero_ps( );
+
+	for ( ; object + 8 <= count; object += 8 ) {
+		auto center_x   = _mm256_loadu_ps( m_center_x.data( ) + object );
+		auto center_y   = _mm256_loadu_ps( m_center_y.data( ) + object );
+		auto center_z   = _mm256_loadu_ps( m_center_z.data( ) + object );
+		auto extent_x   = _mm256_loadu_ps( m_extent_x.data( ) + object );
+		auto extent_y   = _mm256_loadu_ps( m_extent_y.data( ) + object );
+		auto extent_z   = _mm256_loadu_ps( m_extent_z.data( ) + object );
+		auto radius     = _mm256_loadu_ps( m_radius.data( ) + object );
+		auto is_visible = _mm256_cmp_ps( zero, zero, _CMP_EQ_OQ );
+
+		for ( auto index = (uint32_t)0; index < GlwFrustum::PlaneCount; index++ ) {
+			auto distance = _mm256_add_ps( 
+				_mm256_add_ps( _mm256_mul_ps( planes[ index ][ 0 ], center_x ), _mm256_mul_ps( planes[ index ][ 1 ], center_y ) ),
+				_mm256_add_ps( _mm256_mul_ps( planes[ index ][ 2 ], center_z ), planes[ index ][ 3 ] )
+			);
+			auto reach = _mm256_add_ps( 
+				_mm256_add_ps( _mm256_mul_ps( reaches[ index ][ 0 ], extent_x ), _mm256_mul_ps( reaches[ index ][ 1 ], extent_y ) ),
+				_mm256_mul_ps( reaches[ index ][ 2 ], extent_z )
+			);
+
+			distance   = _mm256_add_ps( distance, _mm256_min_ps( reach, radius ) );
+			is_visible = _mm256_and_ps( is_visible, _mm256_cmp_ps( distance, zero, _CMP_GE_OQ ) );
+		}
+
+		auto mask = _mm256_movemask_ps( is_visible );
+
+		for ( auto lane = 0; lane < 8; lane++ ) {
+			m_visible[ m_visible_count ] = object + lane;
+			m_visible_count             += ( mask >> lane ) & 1;
+		}
+	}
+
+	return object;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t GlwFrustumCuller::GetCount( ) const {
+	return (uint32_t)m_items.size( );
+}
+
+uint32_t GlwFrustumCuller::GetVisibleCount( ) const {
+	return m_visible_count;
+}
+
+uint32_t GlwFrustumCuller::GetVisible( const uint32_t visible ) const {
+	return m_visible[ visible ];
+}
+
+const GlwCullingItem& GlwFrustumCuller::GetItem( const uint32_t object ) const {
+	return m_items[ object ];
+}
@@ -0,0 +1,187 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwCullingItem.h"
+
+/**
+ * GlwFrustumCuller class
+ * @note : World space bounds stored as structure of arrays and tested 
+ *		   against a frustum 8 at a time with AVX2, 4 at a time with SSE2, 
+ *		   visible draws are pushed to a render queue with their depth.
+ *		   Each object is tested with a sphere and a box around the box 
+ *		   center, the sphere grows to stay conservative when mesh sphere
+ *		   center differ from its box center.
+ **/
+class GlwFrustumCuller final {
+
+private:
+	std::vector<float> m_center_x;
+	std::vector<float> m_center_y;
+	std::vector<float> m_center_z;
+	std::vector<float> m_extent_x;
+	std::vector<float> m_extent_y;
+	std::vector<float> m_extent_z;
+	std::vector<float> m_radius;
+	std::vector<GlwCullingItem> m_items;
+	std::vector<uint32_t> m_visible;
+	uint32_t m_visible_count;
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwFrustumCuller( );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwFrustumCuller( ) = default;
+
+	/**
+	 * Reserve method
+	 * @note : Reserve memory for query object count.
+	 * @param capacity : Query object count.
+	 **/
+	void Reserve( const uint32_t capacity );
+
+	/**
+	 * Reset method
+	 * @note : Drop objects without releasing memory.
+	 **/
+	void Reset( );
+
+	/**
+	 * Push method
+	 * @note : Add object, its index is the object count before the push.
+	 * @param bounds : Query world space bounds, see GlwMeshBounds::Transform.
+	 * @param item : Query draw pushed to render queue when visible.
+	 **/
+	void Push( const GlwMeshBounds& bounds, const GlwCullingItem& item );
+
+	/**
+	 * Update function
+	 * @note : Update world space bounds of an object.
+	 * @param object : Query object index.
+	 * @param bounds : Query world space bounds.
+	 * @return : True when object exist.
+	 **/
+	bool Update( const uint32_t object, const GlwMeshBounds& bounds );
+
+	/**
+	 * Cull method
+	 * @note : Test every object against frustum and store visible ones.
+	 * @param frustum : Query world space frustum.
+	 **/
+	void Cull( const GlwFrustum& frustum );
+
+	/**
+	 * Cull method
+	 * @note : Test every object against frustum and push visible ones to 
+	 *		   render queue, depth is read from the frustum near and far planes.
+	 * @param frustum : Query world space frustum.
+	 * @param render_queue : Query render queue.
+	 **/
+	void Cull( const GlwFrustum& frustum, GlwRenderQueue& render_queue );
+
+private:
+	/**
+	 * Store method
+	 * @note : Store world space bounds as structure of arrays, invalid
+	 *		   bounds are stored infinite so the object is never culled.
+	 * @param object : Query object index.
+	 * @param bounds : Query world space bounds.
+	 **/
+	void Store( const uint32_t object, const GlwMeshBounds& bounds );
+
+	/**
+	 * CullScalar method
+	 * @note : Test a range of objects one at a time.
+	 * @param frustum : Query world space frustum.
+	 * @param first : Query first object.
+	 * @param last : Query object following the range.
+	 **/
+	void CullScalar( const GlwFrustum& frustum, const uint32_t first, const uint32_t last );
+
+#	ifdef GLW_SSE2
+	/**
+	 * CullSSE2 function
+	 * @note : Test objects 4 at a time.
+	 * @param frustum : Query world space frustum.
+	 * @return : Return index of the first object left untested.
+	 **/
+	uint32_t CullSSE2( const GlwFrustum& frustum );
+#	endif
+
+#	ifdef GLW_AVX2
+	/**
+	 * CullAVX2 function
+	 * @note : Test objects 8 at a time.
+	 * @param frustum : Query world space frustum.
+	 * @return : Return index of the first object left untested.
+	 **/
+	uint32_t CullAVX2( const GlwFrustum& frustum );
+#	endif
+
+public:
+	/**
+	 * GetCount const function
+	 * @note : Get object count.
+	 * @return : Return object count value.
+	 **/
+	uint32_t GetCount( ) const;
+
+	/**
+	 * GetVisibleCount const function
+	 * @note : Get visible object count of last cull.
+	 * @return : Return visible object count value.
+	 **/
+	uint32_t GetVisibleCount( ) const;
+
+	/**
+	 * GetVisible const function
+	 * @note : Get visible object of last cull.
+	 * @param visible : Query position in visible list.
+	 * @return : Return object index.
+	 **/
+	uint32_t GetVisible( const uint32_t visible ) const;
+
+	/**
+	 * GetItem const function
+	 * @note : Get object draw.
+	 * @param object : Query object index.
+	 * @return : Return constant reference to object draw.
+	 **/
+	const GlwCullingItem& GetItem( const uint32_t object ) const;
+
+};
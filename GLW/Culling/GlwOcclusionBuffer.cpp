@@ -0,0 +1,475 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwOcclusionBuffer::GlwOcclusionBuffer( )
+	: GlwOcclusionBuffer{ DefaultWidth, DefaultHeight }
+{ }
+
+GlwOcclusionBuffer::GlwOcclusionBuffer( const uint32_t width, const uint32_t height )
+	: m_width{ 0 },
+	m_height{ 0 },
+	m_tile_count_x{ 0 },
+	m_tile_count_y{ 0 },
+	m_thread_count{ 1 },
+	m_view_projection{ 1.f },
+	m_occluders{ },
+	m_vertex_offsets{ },
+	m_triangle_offsets{ },
+	m_vertices{ },
+	m_triangles{ },
+	m_bins{ },
+	m_levels{ },
+	m_visible{ }
+{
+	Resize( width, height );
+}
+
+void GlwOcclusionBuffer::Resize( const uint32_t width, const uint32_t height ) {
+	m_tile_count_x = std::max( ( width + TileWidth - 1 ) / TileWidth, 1u );
+	m_tile_count_y = std::max( ( height + TileHeight - 1 ) / TileHeight, 1u );
+	m_width		   = m_tile_count_x * TileWidth;
+	m_height	   = m_tile_count_y * TileHeight;
+
+	m_levels.clear( );
+
+	do {
+		auto level = (uint32_t)m_levels.size( );
+
+		m_levels.emplace_back( GetLevelWidth( level ) * GetLevelHeight( level ), 1.f );
+	} while ( GetLevelWidth( (uint32_t)m_levels.size( ) - 1 ) > 1 || GetLevelHeight( (uint32_t)m_levels.size( ) - 1 ) > 1 );
+
+	m_bins.clear( );
+	m_triangles.clear( );
+}
+
+void GlwOcclusionBuffer::Begin( const glm::mat4& view_projection ) {
+	m_view_projection = view_projection;
+
+	m_occluders.clear( );
+
+	for ( auto& level : m_levels )
+		std::fill( level.begin( ), level.end( ), 1.f );
+}
+
+void GlwOcclusionBuffer::Push( const GlwOcclusionOccluder& occluder ) {
+	if ( occluder.GetTriangleCount( ) > 0 )
+		m_occluders.emplace_back( occluder );
+}
+
+void GlwOcclusionBuffer::Rasterize( ) {
+	Rasterize( 1 );
+}
+
+void GlwOcclusionBuffer::Rasterize( const uint32_t thread_count ) {
+	auto occluder_count = (uint32_t)m_occluders.size( );
+	auto tile_count		= m_tile_count_x * m_tile_count_y;
+
+	m_thread_count = std::max( thread_count, 1u );
+
+	m_vertex_offsets.resize( occluder_count + 1 );
+	m_triangle_offsets.resize( occluder_count + 1 );
+	m_triangles.resize( m_thread_count );
+	m_bins.resize( m_thread_count * tile_count );
+
+	m_vertex_offsets[ 0 ]   = 0;
+	m_triangle_offsets[ 0 ] = 0;
+
+	for ( auto occluder = (uint32_t)0; occluder < occluder_count; occluder++ ) {
+		m_vertex_offsets[ occluder + 1 ]   = m_vertex_offsets[ occluder ] + m_occluders[ occluder ].VertexCount;
+		m_triangle_offsets[ occluder + 1 ] = m_triangle_offsets[ occluder ] + m_occluders[ occluder ].GetTriangleCount( );
+	}
+
+	m_vertices.resize( m_vertex_offsets[ occluder_count ] );
+
+	Dispatch( &GlwOcclusionBuffer::TransformVertices );
+	Dispatch( &GlwOcclusionBuffer::BinTriangles );
+	Dispatch( &GlwOcclusionBuffer::RasterizeTiles );
+
+	BuildPyramid( );
+}
+
+void GlwOcclusionBuffer::Filter( const GlwBoundingVolumeHierarchy& hierarchy, std::vector<uint32_t>& objects ) const {
+	auto count = (uint32_t)0;
+
+	for ( auto object : objects ) {
+		if ( GetIsVisible( hierarchy.GetBounds( object ) ) )
+			objects[ count++ ] = object;
+	}
+
+	objects.resize( count );
+}
+
+void GlwOcclusionBuffer::Cull(
+	const GlwFrustum& frustum,
+	const GlwBoundingVolumeHierarchy& hierarchy,
+	GlwRenderQueue& render_queue
+) {
+	hierarchy.Cull( frustum, m_visible );
+
+	Filter( hierarchy, m_visible );
+
+	for ( auto object : m_visible ) {
+		auto& bounds = hierarchy.GetBounds( object );
+		auto& item   = hierarchy.GetItem( object );
+		auto depth   = frustum.GetDepth( ( bounds.Minimum + bounds.Maximum ) * .5f );
+
+		render_queue.Push( item.RenderPass, item.IsTranslucent, depth, item.Item );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void GlwOcclusionBuffer::Dispatch( void ( GlwOcclusionBuffer::*task )( const uint32_t, const uint32_t ) ) {
+	auto workers = std::vector<std::thread>{ };
+
+	workers.reserve( m_thread_count - 1 );
+
+	for ( auto thread = (uint32_t)1; thread < m_thread_count; thread++ )
+		workers.emplace_back( task, this, thread, m_thread_count );
+
+	( this->*task )( 0, m_thread_count );
+
+	for ( auto& worker : workers )
+		worker.join( );
+}
+
+void GlwOcclusionBuffer::TransformVertices( const uint32_t thread, const uint32_t thread_count ) {
+	for ( auto occluder = thread; occluder < m_occluders.size( ); occluder += thread_count ) {
+		auto& current  = m_occluders[ occluder ];
+		auto transform = m_view_projection * current.Transform;
+		auto vertices  = (const uint8_t*)current.Vertices + current.PositionOffset;
+		auto offset	   = m_vertex_offsets[ occluder ];
+
+		for ( auto vertex = (uint32_t)0; vertex < current.VertexCount; vertex++ ) {
+			auto position = glm::vec3{ };
+
+			std::memcpy( &position, vertices + vertex * current.Stride, sizeof( glm::vec3 ) );
+
+			auto clip = transform * glm::vec4{ position, 1.f };
+
+			if ( clip.w > MinimumW ) {
+				auto inverse = 1.f / clip.w;
+
+				m_vertices[ offset + vertex ] = glm::vec4{
+					( clip.x * inverse * .5f + .5f ) * (float)m_width,
+					( clip.y * inverse * .5f + .5f ) * (float)m_height,
+					clip.z * inverse * .5f + .5f,
+					clip.w
+				};
+			} else
+				m_vertices[ offset + vertex ] = glm::vec4{ 0.f, 0.f, 0.f, -1.f };
+		}
+	}
+}
+
+void GlwOcclusionBuffer::BinTriangles( const uint32_t thread, const uint32_t thread_count ) {
+	auto tile_count = m_tile_count_x * m_tile_count_y;
+	auto& triangles = m_triangles[ thread ];
+	auto total		= (uint64_t)m_triangle_offsets.back( );
+	auto first		= (uint32_t)( total * thread / thread_count );
+	auto last		= (uint32_t)( total * ( thread + 1 ) / thread_count );
+	auto occluder	= (uint32_t)( std::upper_bound( m_triangle_offsets.begin( ), m_triangle_offsets.end( ), first ) - m_triangle_offsets.begin( ) ) - 1;
+
+	triangles.clear( );
+
+	for ( auto tile = (uint32_t)0; tile < tile_count; tile++ )
+		m_bins[ thread * tile_count + tile ].clear( );
+
+	for ( auto triangle = first; triangle < last; triangle++ ) {
+		while ( triangle >= m_triangle_offsets[ occluder + 1 ] )
+			occluder += 1;
+
+		auto& current = m_occluders[ occluder ];
+		auto indexes  = current.Indexes + ( triangle - m_triangle_offsets[ occluder ] ) * 3;
+		auto offset	  = m_vertex_offsets[ occluder ];
+
+		if ( indexes[ 0 ] >= current.VertexCount || indexes[ 1 ] >= current.VertexCount || indexes[ 2 ] >= current.VertexCount )
+			continue;
+
+		auto& vertex_a = m_vertices[ offset + indexes[ 0 ] ];
+		auto& vertex_b = m_vertices[ offset + indexes[ 1 ] ];
+		auto& vertex_c = m_vertices[ offset + indexes[ 2 ] ];
+
+		if ( vertex_a.w < 0.f || vertex_b.w < 0.f || vertex_c.w < 0.f )
+			continue;
+
+		if ( vertex_a.z > 1.f && vertex_b.z > 1.f && vertex_c.z > 1.f )
+			continue;
+
+		auto setup	  = GlwOcclusionTriangle{ };
+		auto screen_a = glm::vec3{ vertex_a.x, vertex_a.y, vertex_a.z };
+		auto screen_b = glm::vec3{ vertex_b.x, vertex_b.y, vertex_b.z };
+		auto screen_c = glm::vec3{ vertex_c.x, vertex_c.y, vertex_c.z };
+
+		if ( !setup.Setup( screen_a, screen_b, screen_c, m_width, m_height ) )
+			continue;
+
+		auto index = (uint32_t)triangles.size( );
+
+		triangles.emplace_back( setup );
+
+		for ( auto tile_y = setup.MinimumY / TileHeight; tile_y <= setup.MaximumY / TileHeight; tile_y++ ) {
+			for ( auto tile_x = setup.MinimumX / TileWidth; tile_x <= setup.MaximumX / TileWidth; tile_x++ )
+				m_bins[ thread * tile_count + tile_y * m_tile_count_x + tile_x ].emplace_back( index );
+		}
+	}
+}
+
+void GlwOcclusionBuffer::RasterizeTiles( const uint32_t thread, const uint32_t thread_count ) {
+	auto tile_count = m_tile_count_x * m_tile_count_y;
+
+	for ( auto tile = thread; tile < tile_count; tile += thread_count ) {
+		auto tile_x = tile % m_tile_count_x;
+		auto tile_y = tile / m_tile_count_x;
+
+		for ( auto source = (uint32_t)0; source < m_thread_count; source++ ) {
+			for ( auto index : m_bins[ source * tile_count + tile ] )
+				RasterizeTriangle( m_triangles[ source ][ index ], tile_x, tile_y );
+		}
+	}
+}
+
+void GlwOcclusionBuffer::RasterizeTriangle( const GlwOcclusionTriangle& triangle, const uint32_t tile_x, const uint32_t tile_y ) {
+	auto minimum_x = std::max( triangle.MinimumX, tile_x * TileWidth );
+	auto minimum_y = std::max( triangle.MinimumY, tile_y * TileHeight );
+	auto maximum_x = std::min( triangle.MaximumX, ( tile_x + 1 ) * TileWidth - 1 );
+	auto maximum_y = std::min( triangle.MaximumY, ( tile_y + 1 ) * TileHeight - 1 );
+	auto& edge_a   = triangle.Edges[ 0 ];
+	auto& edge_b   = triangle.Edges[ 1 ];
+	auto& edge_c   = triangle.Edges[ 2 ];
+	auto& depth	   = triangle.Depth;
+
+#	ifdef GLW_AVX2
+	minimum_x &= ~7u;
+
+	auto lanes	  = _mm256_setr_ps( .5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f );
+	auto zero	  = _mm256_setzero_ps( );
+	auto a_x	  = _mm256_set1_ps( edge_a.x );
+	auto b_x	  = _mm256_set1_ps( edge_b.x );
+	auto c_x	  = _mm256_set1_ps( edge_c.x );
+	auto depth_x  = _mm256_set1_ps( depth.x );
+
+	for ( auto y = minimum_y; y <= maximum_y; y++ ) {
+		auto center_y = (float)y + .5f;
+		auto a_row	  = _mm256_set1_ps( edge_a.y * center_y + edge_a.z );
+		auto b_row	  = _mm256_set1_ps( edge_b.y * center_y + edge_b.z );
+		auto c_row	  = _mm256_set1_ps( edge_c.y * center_y + edge_c.z );
+		auto depth_row = _mm256_set1_ps( depth.y * center_y + depth.z );
+		auto row	  = m_levels[ 0 ].data( ) + y * m_width;
+
+		for ( auto x = minimum_x; x <= maximum_x; x += 8 ) {
+			auto center_x = _mm256_add_ps( _mm256_set1_ps( (float)x ), lanes );
+			auto a		  = _mm256_add_ps( _mm256_mul_ps( a_x, center_x ), a_row );
+			auto b		  = _mm256_add_ps( _mm256_mul_ps( b_x, center_x ), b_row );
+			auto c		  = _mm256_add_ps( _mm256_mul_ps( c_x, center_x ), c_row );
+			auto inside	  = _mm256_and_ps( _mm256_and_ps( _mm256_cmp_ps( a, zero, _CMP_GE_OQ ), _mm256_cmp_ps( b, zero, _CMP_GE_OQ ) ), _mm256_cmp_ps( c, zero, _CMP_GE_OQ ) );
+
+			if ( _mm256_movemask_ps( inside ) == 0 )
+				continue;
+
+			auto current = _mm256_loadu_ps( row + x );
+			auto closest = _mm256_min_ps( current, _mm256_add_ps( _mm256_mul_ps( depth_x, center_x ), depth_row ) );
+
+			_mm256_storeu_ps( row + x, _mm256_blendv_ps( current, closest, inside ) );
+		}
+	}
+#	elif defined( GLW_SSE2 )
+	minimum_x &= ~3u;
+
+	auto lanes	  = _mm_setr_ps( .5f, 1.5f, 2.5f, 3.5f );
+	auto zero	  = _mm_setzero_ps( );
+	auto a_x	  = _mm_set1_ps( edge_a.x );
+	auto b_x	  = _mm_set1_ps( edge_b.x );
+	auto c_x	  = _mm_set1_ps( edge_c.x );
+	auto depth_x  = _mm_set1_ps( depth.x );
+
+	for ( auto y = minimum_y; y <= maximum_y; y++ ) {
+		auto center_y  = (float)y + .5f;
+		auto a_row	   = _mm_set1_ps( edge_a.y * center_y + edge_a.z );
+		auto b_row	   = _mm_set1_ps( edge_b.y * center_y + edge_b.z );
+		auto c_row	   = _mm_set1_ps( edge_c.y * center_y + edge_c.z );
+		auto depth_row = _mm_set1_ps( depth.y * center_y + depth.z );
+		auto row	   = m_levels[ 0 ].data( ) + y * m_width;
+
+		for ( auto x = minimum_x; x <= maximum_x; x += 4 ) {
+			auto center_x = _mm_add_ps( _mm_set1_ps( (float)x ), lanes );
+			auto a		  = _mm_add_ps( _mm_mul_ps( a_x, center_x ), a_row );
+			auto b		  = _mm_add_ps( _mm_mul_ps( b_x, center_x ), b_row );
+			auto c		  = _mm_add_ps( _mm_mul_ps( c_x, center_x ), c_row );
+			auto inside	  = _mm_and_ps( _mm_and_ps( _mm_cmpge_ps( a, zero ), _mm_cmpge_ps( b, zero ) ), _mm_cmpge_ps( c, zero ) );
+
+			if ( _mm_movemask_ps( inside ) == 0 )
+				continue;
+
+			auto current = _mm_loadu_ps( row + x );
+			auto closest = _mm_min_ps( current, _mm_add_ps( _mm_mul_ps( depth_x, center_x ), depth_row ) );
+
+			_mm_storeu_ps( row + x, _mm_or_ps( _mm_and_ps( inside, closest ), _mm_andnot_ps( inside, current ) ) );
+		}
+	}
+#	else
+	for ( auto y = minimum_y; y <= maximum_y; y++ ) {
+		auto center_y = (float)y + .5f;
+		auto row	  = m_levels[ 0 ].data( ) + y * m_width;
+
+		for ( auto x = minimum_x; x <= maximum_x; x++ ) {
+			auto center_x = (float)x + .5f;
+			auto a		  = edge_a.x * center_x + edge_a.y * center_y + edge_a.z;
+			auto b		  = edge_b.x * center_x + edge_b.y * center_y + edge_b.z;
+			auto c		  = edge_c.x * center_x + edge_c.y * center_y + edge_c.z;
+
+			if ( a >= 0.f && b >= 0.f && c >= 0.f )
+				row[ x ] = std::min( row[ x ], depth.x * center_x + depth.y * center_y + depth.z );
+		}
+	}
+#	endif
+}
+
+void GlwOcclusionBuffer::BuildPyramid( ) {
+	for ( auto level = (uint32_t)1; level < m_levels.size( ); level++ ) {
+		auto& source	   = m_levels[ level - 1 ];
+		auto& destination  = m_levels[ level ];
+		auto source_width  = GetLevelWidth( level - 1 );
+		auto source_height = GetLevelHeight( level - 1 );
+		auto width		   = GetLevelWidth( level );
+		auto height		   = GetLevelHeight( level );
+
+		for ( auto y = (uint32_t)0; y < height; y++ ) {
+			auto top	= y * 2;
+			auto bottom = std::min( top + 1, source_height - 1 );
+
+			for ( auto x = (uint32_t)0; x < width; x++ ) {
+				auto left  = x * 2;
+				auto right = std::min( left + 1, source_width - 1 );
+				auto upper = std::max( source[ top * source_width + left ], source[ top * source_width + right ] );
+				auto lower = std::max( source[ bottom * source_width + left ], source[ bottom * source_width + right ] );
+
+				destination[ y * width + x ] = std::max( upper, lower );
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwOcclusionBuffer::GetIsVisible( const GlwMeshBounds& bounds ) const {
+	if ( !bounds.GetIsValid( ) )
+		return true;
+
+	auto size	 = bounds.Maximum - bounds.Minimum;
+	auto origin	 = m_view_projection * glm::vec4{ bounds.Minimum, 1.f };
+	auto axis_x	 = m_view_projection[ 0 ] * size.x;
+	auto axis_y	 = m_view_projection[ 1 ] * size.y;
+	auto axis_z	 = m_view_projection[ 2 ] * size.z;
+	auto minimum = glm::vec3{ FLT_MAX };
+	auto maximum = glm::vec3{ -FLT_MAX };
+
+	for ( auto corner = 0; corner < 8; corner++ ) {
+		auto clip = origin;
+
+		if ( corner & 1 )
+			clip += axis_x;
+
+		if ( corner & 2 )
+			clip += axis_y;
+
+		if ( corner & 4 )
+			clip += axis_z;
+
+		if ( clip.w <= MinimumW )
+			return true;
+
+		auto inverse = 1.f / clip.w;
+		auto screen  = glm::vec3{
+			( clip.x * inverse * .5f + .5f ) * (float)m_width,
+			( clip.y * inverse * .5f + .5f ) * (float)m_height,
+			clip.z * inverse * .5f + .5f
+		};
+
+		minimum = glm::min( minimum, screen );
+		maximum = glm::max( maximum, screen );
+	}
+
+	if ( maximum.x < 0.f || maximum.y < 0.f || minimum.x >= (float)m_width || minimum.y >= (float)m_height )
+		return true;
+
+	auto minimum_x = (uint32_t)std::max( minimum.x, 0.f );
+	auto minimum_y = (uint32_t)std::max( minimum.y, 0.f );
+	auto maximum_x = (uint32_t)std::min( maximum.x, (float)( m_width - 1 ) );
+	auto maximum_y = (uint32_t)std::min( maximum.y, (float)( m_height - 1 ) );
+	auto level	   = (uint32_t)0;
+
+	while ( level + 1 < m_levels.size( ) && ( ( maximum_x - minimum_x ) >> level > 1 || ( maximum_y - minimum_y ) >> level > 1 ) )
+		level += 1;
+
+	auto& depths   = m_levels[ level ];
+	auto width	   = GetLevelWidth( level );
+	auto farthest  = 0.f;
+
+	for ( auto y = minimum_y >> level; y <= maximum_y >> level; y++ ) {
+		for ( auto x = minimum_x >> level; x <= maximum_x >> level; x++ )
+			farthest = std::max( farthest, depths[ y * width + x ] );
+	}
+
+	return minimum.z <= farthest;
+}
+
+uint32_t GlwOcclusionBuffer::GetWidth( ) const {
+	return m_width;
+}
+
+uint32_t GlwOcclusionBuffer::GetHeight( ) const {
+	return m_height;
+}
+
+uint32_t GlwOcclusionBuffer::GetLevelCount( ) const {
+	return (uint32_t)m_levels.size( );
+}
+
+uint32_t GlwOcclusionBuffer::GetLevelWidth( const uint32_t level ) const {
+	return std::max( ( m_width + ( 1u << level ) - 1 ) >> level, 1u );
+}
+
+uint32_t GlwOcclusionBuffer::GetLevelHeight( const uint32_t level ) const {
+	return std::max( ( m_height + ( 1u << level ) - 1 ) >> level, 1u );
+}
+
+const float* GlwOcclusionBuffer::GetDepth( const uint32_t level ) const {
+	return m_levels[ level < m_levels.size( ) ? level : 0 ].data( );
+}
@@ -0,0 +1,253 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwOcclusionTriangle.h"
+
+/**
+ * GlwOcclusionBuffer final class
+ * @note : Low resolution software depth buffer used to skip draws hidden 
+ *		   behind occluders before they are recorded.
+ *		   Occluder triangles are transformed and binned to screen tiles, 
+ *		   tiles are then rasterized 8 pixels at a time with AVX2, 4 with
+ *		   SSE2. Both steps are split between worker threads. A max depth 
+ *		   pyramid is built from the result so object screen bounds are 
+ *		   tested against at most 3x3 texels.
+ **/
+class GlwOcclusionBuffer final {
+
+public:
+	static const uint32_t DefaultWidth  = 256;
+	static const uint32_t DefaultHeight = 128;
+	static const uint32_t TileWidth		= 32;
+	static const uint32_t TileHeight	= 32;
+	static constexpr float MinimumW		= 1e-5f;
+
+private:
+	uint32_t m_width;
+	uint32_t m_height;
+	uint32_t m_tile_count_x;
+	uint32_t m_tile_count_y;
+	uint32_t m_thread_count;
+	glm::mat4 m_view_projection;
+	std::vector<GlwOcclusionOccluder> m_occluders;
+	std::vector<uint32_t> m_vertex_offsets;
+	std::vector<uint32_t> m_triangle_offsets;
+	std::vector<glm::vec4> m_vertices;
+	std::vector<std::vector<GlwOcclusionTriangle>> m_triangles;
+	std::vector<std::vector<uint32_t>> m_bins;
+	std::vector<std::vector<float>> m_levels;
+	std::vector<uint32_t> m_visible;
+
+public:
+	/**
+	 * Constructor
+	 * @note : Create a DefaultWidth x DefaultHeight buffer.
+	 **/
+	GlwOcclusionBuffer( );
+
+	/**
+	 * Constructor
+	 * @param width : Query buffer width, rounded up to TileWidth.
+	 * @param height : Query buffer height, rounded up to TileHeight.
+	 **/
+	GlwOcclusionBuffer( const uint32_t width, const uint32_t height );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwOcclusionBuffer( ) = default;
+
+	/**
+	 * Resize method
+	 * @note : Resize buffer and clear it.
+	 * @param width : Query buffer width, rounded up to TileWidth.
+	 * @param height : Query buffer height, rounded up to TileHeight.
+	 **/
+	void Resize( const uint32_t width, const uint32_t height );
+
+	/**
+	 * Begin method
+	 * @note : Clear depth and occluders for a new frame.
+	 * @param view_projection : Query camera view projection matrix.
+	 **/
+	void Begin( const glm::mat4& view_projection );
+
+	/**
+	 * Push method
+	 * @note : Add occluder to next Rasterize call.
+	 * @param occluder : Query occluder.
+	 **/
+	void Push( const GlwOcclusionOccluder& occluder );
+
+	/**
+	 * Rasterize method
+	 * @note : Rasterize occluders on calling thread.
+	 **/
+	void Rasterize( );
+
+	/**
+	 * Rasterize method
+	 * @note : Rasterize occluders and build depth pyramid, transform and 
+	 *		   binning then tile rasterization are split between threads.
+	 * @param thread_count : Query worker thread count, calling thread
+	 *						 included.
+	 **/
+	void Rasterize( const uint32_t thread_count );
+
+	/**
+	 * Filter const method
+	 * @note : Remove occluded objects from a hierarchy query result.
+	 * @param hierarchy : Query hierarchy objects come from.
+	 * @param objects : Query object indexes, occluded ones are removed.
+	 **/
+	void Filter( const GlwBoundingVolumeHierarchy& hierarchy, std::vector<uint32_t>& objects ) const;
+
+	/**
+	 * Cull method
+	 * @note : Frustum cull hierarchy objects, then push the ones not 
+	 *		   occluded to render queue.
+	 * @param frustum : Query world space frustum.
+	 * @param hierarchy : Query scene hierarchy.
+	 * @param render_queue : Query render queue.
+	 **/
+	void Cull( 
+		const GlwFrustum& frustum, 
+		const GlwBoundingVolumeHierarchy& hierarchy, 
+		GlwRenderQueue& render_queue 
+	);
+
+private:
+	/**
+	 * Dispatch method
+	 * @note : Run a task on worker threads and calling thread.
+	 * @param task : Query task, called with thread index and thread count.
+	 **/
+	void Dispatch( void ( GlwOcclusionBuffer::*task )( const uint32_t, const uint32_t ) );
+
+	/**
+	 * TransformVertices method
+	 * @note : Transform occluder vertices, one occluder out of thread_count.
+	 * @param thread : Query thread index.
+	 * @param thread_count : Query thread count.
+	 **/
+	void TransformVertices( const uint32_t thread, const uint32_t thread_count );
+
+	/**
+	 * BinTriangles method
+	 * @note : Setup a contiguous triangle range and bin it to tiles.
+	 * @param thread : Query thread index.
+	 * @param thread_count : Query thread count.
+	 **/
+	void BinTriangles( const uint32_t thread, const uint32_t thread_count );
+
+	/**
+	 * RasterizeTiles method
+	 * @note : Rasterize binned triangles, one tile out of thread_count.
+	 * @param thread : Query thread index.
+	 * @param thread_count : Query thread count.
+	 **/
+	void RasterizeTiles( const uint32_t thread, const uint32_t thread_count );
+
+	/**
+	 * RasterizeTriangle method
+	 * @note : Rasterize a triangle inside a tile, closest depth is kept.
+	 * @param triangle : Query triangle.
+	 * @param tile_x : Query tile column.
+	 * @param tile_y : Query tile row.
+	 **/
+	void RasterizeTriangle( const GlwOcclusionTriangle& triangle, const uint32_t tile_x, const uint32_t tile_y );
+
+	/**
+	 * BuildPyramid method
+	 * @note : Build max depth pyramid from depth buffer.
+	 **/
+	void BuildPyramid( );
+
+public:
+	/**
+	 * GetIsVisible const function
+	 * @note : Get if bounds are not hidden behind occluders, bounds 
+	 *		   crossing the near plane or outside the screen are visible,
+	 *		   like invalid bounds.
+	 * @param bounds : Query world space bounds.
+	 * @return : Return false when bounds are occluded.
+	 **/
+	bool GetIsVisible( const GlwMeshBounds& bounds ) const;
+
+	/**
+	 * GetWidth const function
+	 * @note : Get buffer width.
+	 * @return : Return width in pixels.
+	 **/
+	uint32_t GetWidth( ) const;
+
+	/**
+	 * GetHeight const function
+	 * @note : Get buffer height.
+	 * @return : Return height in pixels.
+	 **/
+	uint32_t GetHeight( ) const;
+
+	/**
+	 * GetLevelCount const function
+	 * @note : Get depth pyramid level count.
+	 * @return : Return level count, level 0 is the depth buffer.
+	 **/
+	uint32_t GetLevelCount( ) const;
+
+	/**
+	 * GetLevelWidth const function
+	 * @note : Get depth pyramid level width.
+	 * @param level : Query level.
+	 * @return : Return level width in texels.
+	 **/
+	uint32_t GetLevelWidth( const uint32_t level ) const;
+
+	/**
+	 * GetLevelHeight const function
+	 * @note : Get depth pyramid level height.
+	 * @param level : Query level.
+	 * @return : Return level height in texels.
+	 **/
+	uint32_t GetLevelHeight( const uint32_t level ) const;
+
+	/**
+	 * GetDepth const function
+	 * @note : Get depth pyramid level texels, row major.
+	 * @param level : Query level.
+	 * @return : Return constant pointer to level depths, 0 near and 1 far.
+	 **/
+	const float* GetDepth( const uint32_t level ) const;
+
+};
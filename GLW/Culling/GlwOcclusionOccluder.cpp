@@ -0,0 +1,65 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwOcclusionOccluder::GlwOcclusionOccluder( )
+	: GlwOcclusionOccluder{ glm::mat4{ 1.f }, 0, 0, 0, nullptr, 0, nullptr }
+{ }
+
+GlwOcclusionOccluder::GlwOcclusionOccluder(
+	const glm::mat4& transform,
+	const uint32_t stride,
+	const uint32_t position_offset,
+	const uint32_t vertex_count,
+	const void* vertices,
+	const uint32_t index_count,
+	const uint32_t* indexes
+)
+	: Transform{ transform },
+	Stride{ stride },
+	PositionOffset{ position_offset },
+	VertexCount{ vertex_count },
+	Vertices{ vertices },
+	IndexCount{ index_count },
+	Indexes{ indexes }
+{ }
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t GlwOcclusionOccluder::GetTriangleCount( ) const {
+	return ( Vertices != nullptr && Indexes != nullptr ) ? IndexCount / 3 : 0;
+}
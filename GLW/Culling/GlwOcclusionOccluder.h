@@ -0,0 +1,82 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwBoundingVolumeHierarchy.h"
+
+struct GlwOcclusionOccluder {
+
+	glm::mat4 Transform;
+	uint32_t Stride;
+	uint32_t PositionOffset;
+	uint32_t VertexCount;
+	const void* Vertices;
+	uint32_t IndexCount;
+	const uint32_t* Indexes;
+
+	/**
+	 * Constructor
+	 **/
+	GlwOcclusionOccluder( );
+
+	/**
+	 * Constructor
+	 * @note : Vertices and indexes are read by GlwOcclusionBuffer::Rasterize,
+	 *		   they must stay alive until it return. Occluders should be
+	 *		   low polygon shapes that stay inside the mesh they stand for.
+	 * @param transform : Query object to world matrix.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param position_offset : Query offset of 3 float position in vertex.
+	 * @param vertex_count : Query vertex count.
+	 * @param vertices : Query vertices.
+	 * @param index_count : Query index count, 3 per triangle.
+	 * @param indexes : Query indexes.
+	 **/
+	GlwOcclusionOccluder(
+		const glm::mat4& transform,
+		const uint32_t stride,
+		const uint32_t position_offset,
+		const uint32_t vertex_count,
+		const void* vertices,
+		const uint32_t index_count,
+		const uint32_t* indexes
+	);
+
+	/**
+	 * GetTriangleCount const function
+	 * @note : Get occluder triangle count.
+	 * @return : Return index count divided by 3.
+	 **/
+	uint32_t GetTriangleCount( ) const;
+
+};
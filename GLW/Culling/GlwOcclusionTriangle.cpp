@@ -0,0 +1,92 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwOcclusionTriangle::GlwOcclusionTriangle( )
+	: Edges{ },
+	Depth{ 0.f },
+	MinimumX{ 0 },
+	MinimumY{ 0 },
+	MaximumX{ 0 },
+	MaximumY{ 0 }
+{ }
+
+bool GlwOcclusionTriangle::Setup(
+	const glm::vec3& vertex_a,
+	const glm::vec3& vertex_b,
+	const glm::vec3& vertex_c,
+	const uint32_t width,
+	const uint32_t height
+) {
+	auto area = ( vertex_b.x - vertex_a.x ) * ( vertex_c.y - vertex_a.y ) - ( vertex_b.y - vertex_a.y ) * ( vertex_c.x - vertex_a.x );
+
+	if ( std::abs( area ) < 1e-6f )
+		return false;
+
+	glm::vec3 vertices[ 3 ] = { vertex_a, area > 0.f ? vertex_b : vertex_c, area > 0.f ? vertex_c : vertex_b };
+
+	auto minimum_x = std::min( vertices[ 0 ].x, std::min( vertices[ 1 ].x, vertices[ 2 ].x ) );
+	auto minimum_y = std::min( vertices[ 0 ].y, std::min( vertices[ 1 ].y, vertices[ 2 ].y ) );
+	auto maximum_x = std::max( vertices[ 0 ].x, std::max( vertices[ 1 ].x, vertices[ 2 ].x ) );
+	auto maximum_y = std::max( vertices[ 0 ].y, std::max( vertices[ 1 ].y, vertices[ 2 ].y ) );
+
+	if ( maximum_x < 0.f || maximum_y < 0.f || minimum_x >= (float)width || minimum_y >= (float)height )
+		return false;
+
+	area = std::abs( area );
+
+	for ( auto edge = 0; edge < 3; edge++ ) {
+		auto& start = vertices[ edge ];
+		auto& end   = vertices[ ( edge + 1 ) % 3 ];
+		auto a		= start.y - end.y;
+		auto b		= end.x - start.x;
+
+		Edges[ edge ] = glm::vec3{ a, b, -( a * start.x + b * start.y ) };
+	}
+
+	auto& depth_a = vertices[ 0 ].z;
+	auto& depth_b = vertices[ 1 ].z;
+	auto& depth_c = vertices[ 2 ].z;
+
+	Depth = ( Edges[ 1 ] * depth_a + Edges[ 2 ] * depth_b + Edges[ 0 ] * depth_c ) / area;
+
+	MinimumX = (uint32_t)std::max( minimum_x, 0.f );
+	MinimumY = (uint32_t)std::max( minimum_y, 0.f );
+	MaximumX = (uint32_t)std::min( maximum_x, (float)( width - 1 ) );
+	MaximumY = (uint32_t)std::min( maximum_y, (float)( height - 1 ) );
+
+	return true;
+}
@@ -0,0 +1,70 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwOcclusionOccluder.h"
+
+struct GlwOcclusionTriangle {
+
+	glm::vec3 Edges[ 3 ];
+	glm::vec3 Depth;
+	uint32_t MinimumX;
+	uint32_t MinimumY;
+	uint32_t MaximumX;
+	uint32_t MaximumY;
+
+	/**
+	 * Constructor
+	 **/
+	GlwOcclusionTriangle( );
+
+	/**
+	 * Setup function
+	 * @note : Setup edge equations and depth plane of a screen space 
+	 *		   triangle, both windings are kept.
+	 * @param vertex_a : Query first vertex, xy in pixels and z depth.
+	 * @param vertex_b : Query second vertex.
+	 * @param vertex_c : Query third vertex.
+	 * @param width : Query depth buffer width.
+	 * @param height : Query depth buffer height.
+	 * @return : Return false when triangle is degenerated or off screen.
+	 **/
+	bool Setup(
+		const glm::vec3& vertex_a,
+		const glm::vec3& vertex_b,
+		const glm::vec3& vertex_c,
+		const uint32_t width,
+		const uint32_t height
+	);
+
+};
@@ -36,16 +36,23 @@
 #define GlwTrackMesh( TRACKER ) TRACKER.MeshCount += 1
 #define GlwTrackMaterial( TRACKER ) TRACKER.MaterialCount += 1
 #define GlwTrackTexture( TRACKER ) TRACKER.TextureCount += 1
+#define GlwUntrackMesh( TRACKER ) TRACKER.MeshCount -= 1
+#define GlwUntrackMaterial( TRACKER ) TRACKER.MaterialCount -= 1
+#define GlwUntrackTexture( TRACKER ) TRACKER.TextureCount -= 1
 
 #ifdef GLW_DEBUG
 
 #   define GlwTrackCommand( TRACKER, RENDER_PASS, NAME, VALUE )\
-        if ( RENDER_PASS < (uint32_t)TRACKER.RenderPass.size( ) )\
-            TRACKER.RenderPass[ RENDER_PASS ].Commands.emplace_back( GlwDebugTrackerCommands{ NAME, (uint64_t)VALUE } );
+        if ( RENDER_PASS < (uint32_t)TRACKER.RenderPass.size( ) ) {\
+            auto glw_lock = std::lock_guard<std::mutex>{ TRACKER.Mutex };\
+            TRACKER.RenderPass[ RENDER_PASS ].Commands.emplace_back( GlwDebugTrackerCommands{ NAME, (uint64_t)VALUE } );\
+        }
 
 #   define GlwTrackDraw( TRACKER, RENDER_PASS, VERTICE_COUNT )\
-        if ( RENDER_PASS < (uint32_t)TRACKER.RenderPass.size( ) )\
-            TRACKER.RenderPass[ RENDER_PASS ].Draws.emplace_back( GlwDebugTracherDraws{ VERTICE_COUNT } );
+        if ( RENDER_PASS < (uint32_t)TRACKER.RenderPass.size( ) ) {\
+            auto glw_lock = std::lock_guard<std::mutex>{ TRACKER.Mutex };\
+            TRACKER.RenderPass[ RENDER_PASS ].Draws.emplace_back( GlwDebugTracherDraws{ VERTICE_COUNT } );\
+        }
 
 #else
 #   define GlwTrackCommand( TRACKER, RENDER_PASS, NAME, VALUE ) 
@@ -59,6 +66,10 @@ struct GlwDebugTracker {
     uint32_t TextureCount;
     std::vector<GlwDebugTrackerRenderPass> RenderPass;
 
+#   ifdef GLW_DEBUG
+    std::mutex Mutex;
+#   endif
+
     /**
      * Constructor
      **/
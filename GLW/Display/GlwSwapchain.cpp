@@ -51,14 +51,17 @@ void GlwSwapchain::SetRefresh( const glm::vec4& color ) {
     m_refresh = color;
 }
 
-void GlwSwapchain::Use( const glm::ivec2& viewport_dimensions ) {
+void GlwSwapchain::Use( 
+    GlwStateTracker& state_tracker, 
+    const glm::ivec2& viewport_dimensions 
+) {
     auto destination = GetViewportDestination( viewport_dimensions );
 
-    Bind( destination );
+    Bind( state_tracker, destination );
 }
 
-void GlwSwapchain::Use( ) {
-    Bind( { 0, 0, m_dimensions.x, m_dimensions.y } );
+void GlwSwapchain::Use( GlwStateTracker& state_tracker ) {
+    Bind( state_tracker, { 0, 0, m_dimensions.x, m_dimensions.y } );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,12 +81,16 @@ glm::ivec4 GlwSwapchain::GetViewportDestination( const glm::ivec2& viewport_dime
     return destination;
 }
 
-void GlwSwapchain::Bind( const glm::ivec4& viewport ) {
-    glBindFramebuffer( GL_FRAMEBUFFER, GL_NULL );
-    glDisable( GL_DEPTH_TEST );
-    glDisable( GL_STENCIL_TEST );
-    glViewport( viewport.x, viewport.y, viewport.z, viewport.w );
-    glScissor( viewport.x, viewport.y, viewport.z, viewport.w );
-    glClearColor( m_refresh.r, m_refresh.g, m_refresh.b, m_refresh.a );
+void GlwSwapchain::Bind( 
+    GlwStateTracker& state_tracker, 
+    const glm::ivec4& viewport 
+) {
+    state_tracker.UseFramebuffer( GL_NULL );
+    state_tracker.Toggle( GL_DEPTH_TEST, GlwStates::Disable );
+    state_tracker.Toggle( GL_STENCIL_TEST, GlwStates::Disable );
+    state_tracker.SetViewport( viewport );
+    state_tracker.SetScissor( viewport );
+    state_tracker.SetClearColor( m_refresh );
+
     glClear( GL_COLOR_BUFFER_BIT );
 }
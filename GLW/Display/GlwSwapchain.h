@@ -77,14 +77,16 @@ public:
      * @param viewport_dimensions : Dimensions of the last render pass
      *                              to adjuste screen positioning according
      *                              to aspect ratio.
+     * @param state_tracker : Query current state tracker.
      **/
-    void Use( const glm::ivec2& viewport_dimensions );
+    void Use( GlwStateTracker& state_tracker, const glm::ivec2& viewport_dimensions );
 
     /**
      * Use method
      * @note : Use swapchain without renderpass.
+     * @param state_tracker : Query current state tracker.
      **/
-    void Use( );
+    void Use( GlwStateTracker& state_tracker );
 
 private:
     /**
@@ -97,8 +99,9 @@ private:
     /**
      * Bind method
      * @note : Bind screen with query viewport.
+     * @param state_tracker : Query current state tracker.
      * @param viewport : Query viewport.
      **/
-    void Bind( const glm::ivec4& viewport );
+    void Bind( GlwStateTracker& state_tracker, const glm::ivec4& viewport );
 
 };
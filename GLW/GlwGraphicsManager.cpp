@@ -40,6 +40,10 @@ GlwGraphicsManager::GlwGraphicsManager( )
 	m_render_passes{ },
 	m_ressources{ }, 
 	m_debug_tracker{ },
+	m_state_tracker{ },
+	m_barrier_tracker{ },
+	m_command_list_mutex{ },
+	m_command_lists{ },
 	m_need_resize{ false }
 { }
 
@@ -55,6 +59,11 @@ bool GlwGraphicsManager::Create(
 		if ( result && glewInit( ) == GLEW_OK ) {
 			PlatformSetup( window, specification );
 
+			if ( GLEW_KHR_parallel_shader_compile )
+				glMaxShaderCompilerThreadsKHR( UINT_MAX );
+			else if ( GLEW_ARB_parallel_shader_compile )
+				glMaxShaderCompilerThreadsARB( UINT_MAX );
+
 			SetDebugContext( specification.Debug );
 			SetFaceCullingContext( specification.Culling );
 
@@ -89,27 +98,20 @@ void GlwGraphicsManager::SetDebugContext(
 void GlwGraphicsManager::SetFaceCullingContext(
 	const GlwFaceCulling& context
 ) {
+	m_state_tracker.Toggle( GL_CULL_FACE, context.State );
+
 	if ( context.State == GlwStates::Enable ) {
-		glEnable( GL_CULL_FACE );
 		glCullFace( context.Face );
 		glFrontFace( context.Mode );
-	} else
-		glDisable( GL_CULL_FACE );
+	}
 }
 
 void GlwGraphicsManager::ToggleMultiSampling( const GlwStates state ) {
-	if ( state == GlwStates::Enable )
-		glEnable( GL_MULTISAMPLE );
-	else
-		glDisable( GL_MULTISAMPLE );
-
+	m_state_tracker.Toggle( GL_MULTISAMPLE, state );
 }
 
 void GlwGraphicsManager::ToggleSRGB( const GlwStates state ) {
-	if ( state == GlwStates::Enable )
-		glEnable( GL_FRAMEBUFFER_SRGB );
-	else
-		glDisable( GL_FRAMEBUFFER_SRGB );
+	m_state_tracker.Toggle( GL_FRAMEBUFFER_SRGB, state );
 }
 
 bool GlwGraphicsManager::CreateRenderPass(
@@ -156,7 +158,16 @@ bool GlwGraphicsManager::CreateRenderPasses(
 bool GlwGraphicsManager::CreateMesh(
 	const GlwMeshSpecification& specification
 ) {
-	auto result = m_ressources.CreateMesh( specification );
+	auto mesh = glw_ressource{ };
+
+	return CreateMesh( specification, mesh );
+}
+
+bool GlwGraphicsManager::CreateMesh(
+	const GlwMeshSpecification& specification,
+	glw_ressource& mesh
+) {
+	auto result = m_ressources.CreateMesh( specification, mesh );
 
 	if ( result )
 		GlwTrackMesh( m_debug_tracker );
@@ -164,10 +175,19 @@ bool GlwGraphicsManager::CreateMesh(
 	return result;
 }
 
-bool GlwGraphicsManager::CreateTexture2D( 
+bool GlwGraphicsManager::CreateTexture2D(
 	const GlwTexture2DSpecification& specification
 ) {
-	auto result = m_ressources.CreateTexture2D( specification );
+	auto texture = glw_ressource{ };
+
+	return CreateTexture2D( specification, texture );
+}
+
+bool GlwGraphicsManager::CreateTexture2D(
+	const GlwTexture2DSpecification& specification,
+	glw_ressource& texture
+) {
+	auto result = m_ressources.CreateTexture2D( specification, texture );
 
 	if ( result )
 		GlwTrackTexture( m_debug_tracker );
@@ -179,7 +199,17 @@ bool GlwGraphicsManager::CreateTexture2D(
 	const GlwTexture2DSpecification& specification,
 	const std::vector<uint8_t>& pixels
 ) {
-	auto result = m_ressources.CreateTexture2D( specification, pixels );
+	auto texture = glw_ressource{ };
+
+	return CreateTexture2D( specification, pixels, texture );
+}
+
+bool GlwGraphicsManager::CreateTexture2D(
+	const GlwTexture2DSpecification& specification,
+	const std::vector<uint8_t>& pixels,
+	glw_ressource& texture
+) {
+	auto result = m_ressources.CreateTexture2D( specification, pixels, texture );
 
 	if ( result )
 		GlwTrackTexture( m_debug_tracker );
@@ -190,7 +220,16 @@ bool GlwGraphicsManager::CreateTexture2D(
 bool GlwGraphicsManager::CreateCubemap(
 	const GlwTextureCubemapSpecification& specification
 ) {
-	auto result = m_ressources.CreateCubemap( specification );
+	auto cubemap = glw_ressource{ };
+
+	return CreateCubemap( specification, cubemap );
+}
+
+bool GlwGraphicsManager::CreateCubemap(
+	const GlwTextureCubemapSpecification& specification,
+	glw_ressource& cubemap
+) {
+	auto result = m_ressources.CreateCubemap( specification, cubemap );
 
 	if ( result )
 		GlwTrackTexture( m_debug_tracker );
@@ -202,7 +241,17 @@ bool GlwGraphicsManager::CreateCubemap(
 	const GlwTextureCubemapSpecification& specification,
 	const std::vector<uint8_t> face_pixels[ GlwTextureCubemap::FaceCount ]
 ) {
-	auto result = m_ressources.CreateCubemap( specification, face_pixels );
+	auto cubemap = glw_ressource{ };
+
+	return CreateCubemap( specification, face_pixels, cubemap );
+}
+
+bool GlwGraphicsManager::CreateCubemap(
+	const GlwTextureCubemapSpecification& specification,
+	const std::vector<uint8_t> face_pixels[ GlwTextureCubemap::FaceCount ],
+	glw_ressource& cubemap
+) {
+	auto result = m_ressources.CreateCubemap( specification, face_pixels, cubemap );
 
 	if ( result )
 		GlwTrackTexture( m_debug_tracker );
@@ -210,10 +259,39 @@ bool GlwGraphicsManager::CreateCubemap(
 	return result;
 }
 
-bool GlwGraphicsManager::CreateMaterial( 
+bool GlwGraphicsManager::CreateProgramCache( const std::string& directory ) {
+	return m_ressources.CreateProgramCache( directory );
+}
+
+void GlwGraphicsManager::ClearProgramCache( ) {
+	m_ressources.ClearProgramCache( );
+}
+
+bool GlwGraphicsManager::CreateMaterial(
 	const GlwMaterialSpecification& specification
 ) {
-	auto result = m_ressources.CreateMaterial( specification );
+	auto material = glw_ressource{ };
+
+	return CreateMaterial( specification, material );
+}
+
+bool GlwGraphicsManager::CreateMaterial(
+	const GlwMaterialSpecification& specification,
+	glw_ressource& material
+) {
+	auto result = m_ressources.CreateMaterial( specification, material );
+
+	if ( result )
+		GlwTrackMaterial( m_debug_tracker );
+
+	return result;
+}
+
+bool GlwGraphicsManager::SubmitMaterial(
+	const GlwMaterialSpecification& specification,
+	glw_ressource& material
+) {
+	auto result = m_ressources.SubmitMaterial( specification, material );
 
 	if ( result )
 		GlwTrackMaterial( m_debug_tracker );
@@ -221,10 +299,70 @@ bool GlwGraphicsManager::CreateMaterial(
 	return result;
 }
 
+bool GlwGraphicsManager::CreateMaterialVariant(
+	GlwMaterialTemplate& material_template,
+	const GlwMaterialDefines& defines,
+	glw_ressource& material
+) {
+	auto count  = m_ressources.GetMaterialCount( );
+	auto result = m_ressources.CreateMaterialVariant( material_template, defines, material );
+
+	if ( result && m_ressources.GetMaterialCount( ) > count )
+		GlwTrackMaterial( m_debug_tracker );
+
+	return result;
+}
+
+bool GlwGraphicsManager::SubmitMaterialVariant(
+	GlwMaterialTemplate& material_template,
+	const GlwMaterialDefines& defines,
+	glw_ressource& material
+) {
+	auto count  = m_ressources.GetMaterialCount( );
+	auto result = m_ressources.SubmitMaterialVariant( material_template, defines, material );
+
+	if ( result && m_ressources.GetMaterialCount( ) > count )
+		GlwTrackMaterial( m_debug_tracker );
+
+	return result;
+}
+
+void GlwGraphicsManager::SetPlaceholderMaterial( const glw_ressource material ) {
+	m_ressources.SetPlaceholderMaterial( material );
+}
+
+uint32_t GlwGraphicsManager::PollMaterials( ) {
+	return m_ressources.PollMaterials( );
+}
+
+bool GlwGraphicsManager::CreateStreamBuffer(
+	const GlwStreamBufferSpecification& specification,
+	glw_ressource& stream_buffer
+) {
+	return m_ressources.CreateStreamBuffer( specification, stream_buffer );
+}
+
+bool GlwGraphicsManager::CreateStreamBuffer(
+	const GlwStreamBufferSpecification& specification,
+	const std::vector<GlwVertexAttribute>& attributes,
+	glw_ressource& stream_buffer
+) {
+	return m_ressources.CreateStreamBuffer( specification, attributes, stream_buffer );
+}
+
+bool GlwGraphicsManager::CreateGeometryPool(
+	const GlwGeometryPoolSpecification& specification,
+	glw_ressource& geometry_pool
+) {
+	return m_ressources.CreateGeometryPool( specification, geometry_pool );
+}
+
 bool GlwGraphicsManager::ReplaceMesh(
 	const glw_ressource mesh,
 	const GlwMeshSpecification& specification
 ) {
+	m_state_tracker.Invalidate( );
+
 	return m_ressources.ReplaceMesh( mesh, specification );
 }
 
@@ -232,6 +370,8 @@ bool GlwGraphicsManager::ReplaceTexture2D(
 	const glw_ressource texture,
 	const GlwTexture2DSpecification& specification
 ) {
+	m_state_tracker.Invalidate( );
+
 	return m_ressources.ReplaceTexture2D( texture, specification );
 }
 
@@ -240,6 +380,8 @@ bool GlwGraphicsManager::ReplaceTexture2D(
 	const GlwTexture2DSpecification& specification,
 	const std::vector<uint8_t>& pixels
 ) {
+	m_state_tracker.Invalidate( );
+
 	return m_ressources.ReplaceTexture2D( texture, specification );
 }
 
@@ -247,6 +389,8 @@ bool GlwGraphicsManager::ReplaceCubemap(
 	const glw_ressource cubemap,
 	const GlwTextureCubemapSpecification& specification
 ) {
+	m_state_tracker.Invalidate( );
+
 	return m_ressources.ReplaceCubemap( cubemap, specification );
 }
 
@@ -255,6 +399,8 @@ bool GlwGraphicsManager::ReplaceCubemap(
 	const GlwTextureCubemapSpecification& specification,
 	const std::vector<uint8_t> face_pixels[ GlwTextureCubemap::FaceCount ]
 ) {
+	m_state_tracker.Invalidate( );
+
 	return m_ressources.ReplaceCubemap( cubemap, specification );
 }
 
@@ -262,9 +408,72 @@ bool GlwGraphicsManager::ReplaceMaterial(
 	const glw_ressource material,
 	const GlwMaterialSpecification& specification
 ) {
+	m_state_tracker.Invalidate( );
+
 	return m_ressources.ReplaceMaterial( material, specification );
 }
 
+bool GlwGraphicsManager::DestroyMesh( const glw_ressource mesh ) {
+	auto result = m_ressources.DestroyMesh( mesh );
+
+	if ( result ) {
+		m_state_tracker.Invalidate( );
+
+		GlwUntrackMesh( m_debug_tracker );
+	}
+
+	return result;
+}
+
+bool GlwGraphicsManager::DestroyTexture2D( const glw_ressource texture ) {
+	auto result = m_ressources.DestroyTexture2D( texture );
+
+	if ( result ) {
+		m_state_tracker.Invalidate( );
+
+		GlwUntrackTexture( m_debug_tracker );
+	}
+
+	return result;
+}
+
+bool GlwGraphicsManager::DestroyCubemap( const glw_ressource cubemap ) {
+	auto result = m_ressources.DestroyCubemap( cubemap );
+
+	if ( result ) {
+		m_state_tracker.Invalidate( );
+
+		GlwUntrackTexture( m_debug_tracker );
+	}
+
+	return result;
+}
+
+bool GlwGraphicsManager::DestroyMaterial( const glw_ressource material ) {
+	auto result = m_ressources.DestroyMaterial( material );
+
+	if ( result ) {
+		m_state_tracker.Invalidate( );
+
+		GlwUntrackMaterial( m_debug_tracker );
+	}
+
+	return result;
+}
+
+bool GlwGraphicsManager::DestroyStreamBuffer( const glw_ressource stream_buffer ) {
+	return m_ressources.DestroyStreamBuffer( stream_buffer );
+}
+
+bool GlwGraphicsManager::DestroyGeometryPool( const glw_ressource geometry_pool ) {
+	auto result = m_ressources.DestroyGeometryPool( geometry_pool );
+
+	if ( result )
+		m_state_tracker.Invalidate( );
+
+	return result;
+}
+
 void GlwGraphicsManager::FillTexture2D(
 	const uint32_t texture,
 	const GlwTextureFillSpecification& fill_specification
@@ -309,22 +518,55 @@ void GlwGraphicsManager::SetRefresh( const glm::vec4& color ) {
 	m_swapchain.SetRefresh( color );
 }
 
+void GlwGraphicsManager::InvalidateState( ) {
+	m_state_tracker.Invalidate( );
+	m_barrier_tracker.Invalidate( );
+}
+
 bool GlwGraphicsManager::Acquire( 
 	const GlwWindow* window, 
 	GlwRenderContext& render_context 
 ) {
-	render_context = { };
+	render_context.Reset( );
 
 	m_debug_tracker.Reset( );
+	m_state_tracker.ResetCounters( );
+	m_barrier_tracker.ResetCounters( );
 
 	Resize( window );
 
+	m_ressources.AcquireStreamBuffers( );
+	m_ressources.PollMaterials( );
+
 	if ( m_render_passes.GetLast( ) == nullptr )
-		m_swapchain.Use( );
+		m_swapchain.Use( m_state_tracker );
 
 	return m_state == GlwStates::Enable;
 }
 
+bool GlwGraphicsManager::AcquireCommandList(
+	GlwRenderContext& command_list,
+	const uint32_t render_pass,
+	const uint64_t key
+) {
+	command_list.Reset( );
+
+	command_list.Key = key;
+
+	CmdUseRenderPass( command_list, render_pass );
+
+	return m_state == GlwStates::Enable && command_list.GetInUse( );
+}
+
+void GlwGraphicsManager::SubmitCommandList( GlwRenderContext& command_list ) {
+	if ( command_list.Commands.GetIsEmpty( ) )
+		return;
+
+	auto lock = std::lock_guard<std::mutex>{ m_command_list_mutex };
+
+	m_command_lists.emplace_back( &command_list );
+}
+
 GlwRenderPass* GlwGraphicsManager::CmdUseRenderPass(
 	GlwRenderContext& render_context, 
 	const uint32_t render_pass 
@@ -334,7 +576,7 @@ GlwRenderPass* GlwGraphicsManager::CmdUseRenderPass(
 	if ( instance != nullptr ) {
 		render_context.RenderPass = render_pass;
 		
-		instance->Use( );
+		render_context.Commands.Record( GlwCommandTypes::Use_Render_Pass, GlwCommandUseRenderPass{ { }, instance } );
 
 		CmdToggleColorWrites( render_context, GlwStates::Enable );
 	} else
@@ -347,15 +589,14 @@ GlwRenderPass* GlwGraphicsManager::CmdUseRenderPass(
 
 void GlwGraphicsManager::CmdUseSwapchain( GlwRenderContext& render_context ) {
 	auto* render_pass = m_render_passes.GetLast( );
+	auto command      = GlwCommandUseSwapchain{ { }, render_pass != nullptr, { } };
 
 	render_context.RenderPass = 0;
 
-	if ( render_pass != nullptr ) {
-		auto dimensions = render_pass->GetDimensions( );
+	if ( command.UseDimensions )
+		command.Dimensions = render_pass->GetDimensions( );
 
-		m_swapchain.Use( dimensions );
-	} else
-		m_swapchain.Use( );
+	render_context.Commands.Record( GlwCommandTypes::Use_Swapchain, command );
 
 	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdUseSwapchain", render_pass );
 }
@@ -368,10 +609,7 @@ void GlwGraphicsManager::CmdToggle(
 	if ( !render_context.GetInUse( ) )
 		return;
 
-	if ( state == GlwStates::Enable )
-		glEnable( capability );
-	else
-		glDisable( capability );
+	render_context.Commands.Record( GlwCommandTypes::Toggle, GlwCommandToggle{ { }, capability, state } );
 }
 
 void GlwGraphicsManager::CmdToggleFaceCulling(
@@ -390,7 +628,7 @@ void GlwGraphicsManager::CmdSetViewport(
 	if ( !render_context.GetInUse( ) )
 		return;
 
-	glViewport( viewport.x, viewport.y, viewport.z, viewport.w );
+	render_context.Commands.Record( GlwCommandTypes::Set_Viewport, GlwCommandBounds{ { }, glm::ivec4{ viewport } } );
 
 	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdSetViewport", 0 );
 }
@@ -402,7 +640,7 @@ void GlwGraphicsManager::CmdSetScissor(
 	if ( !render_context.GetInUse( ) )
 		return;
 
-	glScissor( scissor.x, scissor.y, scissor.z, scissor.w );
+	render_context.Commands.Record( GlwCommandTypes::Set_Scissor, GlwCommandBounds{ { }, glm::ivec4{ scissor } } );
 
 	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdSetScissor", 0 );
 }
@@ -422,9 +660,7 @@ void GlwGraphicsManager::CmdToggleColorWrites(
 	if ( !render_context.GetInUse( ) )
 		return;
 
-	auto value = ( state == GlwStates::Enable ) ? GL_TRUE : GL_FALSE;
-
-	glColorMaski( attachement, value, value, value, value );
+	render_context.Commands.Record( GlwCommandTypes::Toggle_Color_Writes, GlwCommandToggle{ { }, attachement, state } );
 
 	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdToggleColorWrites", ( (uint64_t)attachement << 32 ) & (uint32_t)state );
 }
@@ -451,7 +687,7 @@ void GlwGraphicsManager::CmdToggleStencilWrite( GlwRenderContext& render_context
 	if ( !render_context.GetInUse( ) )
 		return;
 
-	glStencilMask( ( state == GlwStates::Enable ) ? 0xFF : 0x00 );
+	render_context.Commands.Record( GlwCommandTypes::Toggle_Stencil_Write, GlwCommandToggle{ { }, 0, state } );
 
 	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdToggleStencilWrite", state );
 }
@@ -464,9 +700,7 @@ void GlwGraphicsManager::CmdClearColor(
 	if ( !render_context.GetInUse( ) )
 		return;
 
-	auto* color = glm::value_ptr( clear_value );
-
-	glClearBufferfv( GL_COLOR, attachement, color );
+	render_context.Commands.Record( GlwCommandTypes::Clear_Color, GlwCommandClearColor{ { }, attachement, clear_value } );
 
 	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdClearColor", attachement );
 }
@@ -478,7 +712,7 @@ void GlwGraphicsManager::CmdClearDepth(
 	if ( !render_context.GetInUse( ) )
 		return;
 
-	glClearDepth( clear_value );
+	render_context.Commands.Record( GlwCommandTypes::Clear_Depth, GlwCommandClearDepthStencil{ { }, clear_value, 0 } );
 
 	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdClearDepth", clear_value );
 }
@@ -490,7 +724,7 @@ void GlwGraphicsManager::CmdClearStencil(
 	if ( !render_context.GetInUse( ) )
 		return;
 
-	glClearStencil( clear_value );
+	render_context.Commands.Record( GlwCommandTypes::Clear_Stencil, GlwCommandClearDepthStencil{ { }, .0f, (int32_t)clear_value } );
 
 	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdClearStencil", clear_value );
 }
@@ -502,21 +736,28 @@ void GlwGraphicsManager::CmdBlitRenderTarget(
 	if ( !render_context.GetInUse( ) )
 		return;
 
-	m_render_passes.CmdBlitRenderTarget( blit_specification );
+	render_context.Commands.Record( GlwCommandTypes::Blit_Render_Target, GlwCommandBlit{ { }, blit_specification } );
 
 	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdBlitRenderTarget", blit_specification.Type );
 }
 
-GlwMaterial* GlwGraphicsManager::CmdUseMaterial(
+const GlwMaterial* GlwGraphicsManager::CmdUseMaterial(
 	GlwRenderContext& render_context, 
 	const uint32_t material 
 ) {
 	auto* instance = (GlwMaterial*)nullptr;
 	
 	if ( render_context.GetInUse( ) ) {
-		instance = m_ressources.UseMaterial( material );
+		auto used_material = material;
 
-		render_context.Material = ( instance != nullptr ) ? material : UINT_MAX;
+		instance = m_ressources.GetReadyMaterial( used_material );
+
+		if ( instance != nullptr ) {
+			render_context.Material = used_material;
+
+			render_context.Commands.Record( GlwCommandTypes::Use_Material, GlwCommandUseMaterial{ { }, instance } );
+		} else
+			render_context.Material = UINT_MAX;
 	}
 
 	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdUseMaterial", instance );
@@ -531,11 +772,15 @@ GlwMesh* GlwGraphicsManager::CmdUseMesh(
 	auto* instance = (GlwMesh*)nullptr;
 
 	if ( render_context.GetInUse( ) ) {
-		instance = m_ressources.UseMesh( mesh );
+		instance = m_ressources.GetMesh( mesh );
 
 		if ( instance != nullptr ) {
-			render_context.Mesh	   = mesh;
-			render_context.UseIndex = instance->GetHasIndex( );
+			render_context.Mesh           = mesh;
+			render_context.GeometryPool   = UINT_MAX;
+			render_context.StreamGeometry = UINT_MAX;
+			render_context.UseIndex       = instance->GetHasIndex( );
+
+			render_context.Commands.Record( GlwCommandTypes::Use_Mesh, GlwCommandUseMesh{ { }, instance } );
 		} else 
 			render_context.Mesh = UINT_MAX;
 	}
@@ -545,25 +790,484 @@ GlwMesh* GlwGraphicsManager::CmdUseMesh(
 	return instance;
 }
 
+GlwGeometryPool* GlwGraphicsManager::CmdUseGeometryPool(
+	GlwRenderContext& render_context,
+	const glw_ressource geometry_pool
+) {
+	auto* instance = (GlwGeometryPool*)nullptr;
+
+	if ( render_context.GetInUse( ) ) {
+		instance = m_ressources.GetGeometryPool( geometry_pool );
+
+		if ( instance != nullptr ) {
+			render_context.Mesh           = UINT_MAX;
+			render_context.GeometryPool   = geometry_pool;
+			render_context.StreamGeometry = UINT_MAX;
+			render_context.UseIndex       = true;
+
+			render_context.Commands.Record( GlwCommandTypes::Use_Geometry_Pool, GlwCommandUseGeometryPool{ { }, instance } );
+		} else
+			render_context.GeometryPool = UINT_MAX;
+	}
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdUseGeometryPool", instance );
+
+	return instance;
+}
+
+GlwStreamBuffer* GlwGraphicsManager::CmdUseStreamGeometry(
+	GlwRenderContext& render_context,
+	const glw_ressource vertex_stream
+) {
+	return CmdUseStreamGeometry( render_context, vertex_stream, UINT_MAX );
+}
+
+GlwStreamBuffer* GlwGraphicsManager::CmdUseStreamGeometry(
+	GlwRenderContext& render_context,
+	const glw_ressource vertex_stream,
+	const glw_ressource index_stream
+) {
+	auto* instance = (GlwStreamBuffer*)nullptr;
+
+	if ( render_context.GetInUse( ) ) {
+		auto* vertices = m_ressources.GetStreamBuffer( vertex_stream );
+		auto* indices  = ( index_stream < UINT_MAX ) ? m_ressources.GetStreamBuffer( index_stream ) : nullptr;
+		auto is_valid  =
+			vertices != nullptr && vertices->GetFormat( ) != nullptr &&
+			( index_stream == UINT_MAX || ( indices != nullptr && indices->GetType( ) == GlwBufferTypes::Index ) );
+
+		if ( is_valid ) {
+			auto index   = ( indices != nullptr ) ? indices->Get( ) : GL_NULL;
+			auto command = GlwCommandUseStreamGeometry{ { }, vertices->GetFormat( ), vertices->Get( ), vertices->GetStride( ), index };
+
+			instance = vertices;
+
+			render_context.Mesh           = UINT_MAX;
+			render_context.GeometryPool   = UINT_MAX;
+			render_context.StreamGeometry = vertex_stream;
+			render_context.StreamStride   = vertices->GetStride( );
+			render_context.UseIndex       = indices != nullptr;
+
+			render_context.Commands.Record( GlwCommandTypes::Use_Stream_Geometry, command );
+		} else
+			render_context.StreamGeometry = UINT_MAX;
+	}
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdUseStreamGeometry", instance );
+
+	return instance;
+}
+
+void GlwGraphicsManager::CmdUseTexture(
+	GlwRenderContext& render_context,
+	const uint32_t slot,
+	const glTexture texture
+) {
+	if ( !render_context.GetInUse( ) )
+		return;
+
+	render_context.Commands.Record( GlwCommandTypes::Use_Texture, GlwCommandUseTexture{ { }, slot, texture } );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdUseTexture", slot );
+}
+
+void GlwGraphicsManager::CmdBindStreamBuffer(
+	GlwRenderContext& render_context,
+	const glw_ressource stream_buffer,
+	const uint32_t binding,
+	const uint32_t offset,
+	const uint32_t length
+) {
+	if ( !render_context.GetInUse( ) )
+		return;
+
+	auto* instance = m_ressources.GetStreamBuffer( stream_buffer );
+
+	if ( instance != nullptr )
+		render_context.Commands.Record( GlwCommandTypes::Bind_Stream_Buffer, GlwCommandBindStreamBuffer{ { }, instance, binding, offset, length } );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdBindStreamBuffer", binding );
+}
+
+void GlwGraphicsManager::CmdBindUniformBuffer(
+	GlwRenderContext& render_context,
+	const uint32_t binding,
+	const GlwBuffer& buffer
+) {
+	CmdBindUniformBuffer( render_context, binding, buffer, 0, 0 );
+}
+
+void GlwGraphicsManager::CmdBindUniformBuffer(
+	GlwRenderContext& render_context,
+	const uint32_t binding,
+	const GlwBuffer& buffer,
+	const uint32_t offset,
+	const uint32_t length
+) {
+	if ( !render_context.GetInUse( ) || !buffer.GetIsValid( ) )
+		return;
+
+	auto command = GlwCommandBindUniformBuffer{ { }, buffer.Get( ), binding, offset, length };
+
+	render_context.Commands.Record( GlwCommandTypes::Bind_Uniform_Buffer, command );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdBindUniformBuffer", binding );
+}
+
+void GlwGraphicsManager::CmdSetUniformBuffer(
+	GlwRenderContext& render_context,
+	const int32_t location,
+	const GlwBuffer& buffer
+) {
+	if ( !render_context.GetInUse( ) || render_context.Material == UINT_MAX || location < 0 || !buffer.GetIsValid( ) || buffer.GetType( ) != GlwBufferTypes::Uniform )
+		return;
+
+	render_context.Commands.Record( GlwCommandTypes::Set_Uniform_Buffer, GlwCommandSetUniformBuffer{ { }, location, buffer.Get( ) } );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdSetUniformBuffer", location );
+}
+
+void GlwGraphicsManager::CmdSetUniformBuffer(
+	GlwRenderContext& render_context,
+	const GlwUniformHash hash,
+	const GlwBuffer& buffer
+) {
+	auto* material = GetMaterial( render_context.Material );
+	auto location  = ( material != nullptr ) ? material->GetBufferLocation( hash ) : -1;
+
+	CmdSetUniformBuffer( render_context, location, buffer );
+}
+
+void GlwGraphicsManager::CmdBindStorageBuffer(
+	GlwRenderContext& render_context,
+	const uint32_t binding,
+	const GlwBuffer& buffer,
+	const GlwAccessModes access
+) {
+	CmdBindStorageBuffer( render_context, binding, buffer, 0, 0, access );
+}
+
+void GlwGraphicsManager::CmdBindStorageBuffer(
+	GlwRenderContext& render_context,
+	const uint32_t binding,
+	const GlwBuffer& buffer,
+	const uint32_t offset,
+	const uint32_t length,
+	const GlwAccessModes access
+) {
+	if ( !render_context.GetInUse( ) || !buffer.GetIsValid( ) )
+		return;
+
+	auto command = GlwCommandBindStorageBuffer{ { }, buffer.Get( ), binding, offset, length, access };
+
+	render_context.Commands.Record( GlwCommandTypes::Bind_Storage_Buffer, command );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdBindStorageBuffer", binding );
+}
+
+void GlwGraphicsManager::CmdBindImage(
+	GlwRenderContext& render_context,
+	const uint32_t unit,
+	const glTexture texture,
+	const int32_t level,
+	const GlwAccessModes access,
+	const uint32_t format
+) {
+	CmdBindImage( render_context, unit, texture, level, false, 0, access, format );
+}
+
+void GlwGraphicsManager::CmdBindImage(
+	GlwRenderContext& render_context,
+	const uint32_t unit,
+	const glTexture texture,
+	const int32_t level,
+	const bool layered,
+	const int32_t layer,
+	const GlwAccessModes access,
+	const uint32_t format
+) {
+	if ( !render_context.GetInUse( ) )
+		return;
+
+	auto command = GlwCommandBindImage{ { }, unit, texture, level, layered, layer, access, format };
+
+	render_context.Commands.Record( GlwCommandTypes::Bind_Image, command );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdBindImage", unit );
+}
+
 void GlwGraphicsManager::CmdDraw( 
 	GlwRenderContext& render_context, 
 	const uint32_t vertice_count 
 ) {
-	if ( !render_context.GetCanDraw( ) && vertice_count > 0 )
+	if ( !render_context.GetCanDraw( ) || vertice_count == 0 )
+		return;
+
+	render_context.Commands.Record( GlwCommandTypes::Draw, GlwCommandDraw{ { }, vertice_count, render_context.UseIndex } );
+
+	GlwTrackDraw( m_debug_tracker, render_context.RenderPass, vertice_count );
+}
+
+void GlwGraphicsManager::CmdDrawGeometry(
+	GlwRenderContext& render_context,
+	const uint32_t geometry
+) {
+	if ( !render_context.GetCanDraw( ) || render_context.GeometryPool == UINT_MAX )
+		return;
+
+	render_context.Commands.Record( GlwCommandTypes::Draw_Geometry, GlwCommandDrawGeometry{ { }, geometry } );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdDrawGeometry", geometry );
+}
+
+void GlwGraphicsManager::CmdDrawStreamGeometry(
+	GlwRenderContext& render_context,
+	const uint32_t vertice_count,
+	const uint32_t vertex_offset
+) {
+	CmdDrawStreamGeometry( render_context, vertice_count, 0, vertex_offset );
+}
+
+void GlwGraphicsManager::CmdDrawStreamGeometry(
+	GlwRenderContext& render_context,
+	const uint32_t vertice_count,
+	const uint32_t index_offset,
+	const uint32_t vertex_offset
+) {
+	auto stride = render_context.StreamStride;
+
+	if ( !render_context.GetCanDraw( ) || render_context.StreamGeometry == UINT_MAX || vertice_count == 0 || stride == 0 )
+		return;
+
+	if ( vertex_offset % stride != 0 || ( render_context.UseIndex && index_offset % sizeof( uint32_t ) != 0 ) ) {
+#		ifdef _DEBUG
+		printf( "[ GLW - WARNING ] Stream geometry offsets are not multiple of element size : %u %u\n", index_offset, vertex_offset );
+#		endif
+
 		return;
+	}
+
+	auto first_vertice = vertex_offset / stride;
+
+	if ( render_context.UseIndex ) {
+		auto command = GlwCommandDrawBaseVertex{ { }, vertice_count, index_offset / (uint32_t)sizeof( uint32_t ), (int32_t)first_vertice };
 
-	if ( render_context.UseIndex )
-		glDrawElements( GL_TRIANGLES, vertice_count, GL_UNSIGNED_INT, NULL );
-	else
-		glDrawArrays( GL_TRIANGLES, 0, vertice_count );
+		render_context.Commands.Record( GlwCommandTypes::Draw_Base_Vertex, command );
+	} else {
+		auto command = GlwCommandDrawInstanced{ { }, vertice_count, 1, first_vertice, 0, 0, false };
+
+		render_context.Commands.Record( GlwCommandTypes::Draw_Instanced, command );
+	}
 
 	GlwTrackDraw( m_debug_tracker, render_context.RenderPass, vertice_count );
 }
 
+void GlwGraphicsManager::CmdDrawLod( GlwRenderContext& render_context, const float screen_size ) {
+	CmdDrawLod( render_context, screen_size, 1.f );
+}
+
+void GlwGraphicsManager::CmdDrawLod(
+	GlwRenderContext& render_context,
+	const float screen_size,
+	const float pixel_error
+) {
+	if ( !render_context.GetCanDraw( ) || render_context.Mesh == UINT_MAX || !render_context.UseIndex )
+		return;
+
+	auto* instance = m_ressources.GetMesh( render_context.Mesh );
+
+	if ( instance == nullptr )
+		return;
+
+	auto lod = instance->GetLod( screen_size, pixel_error );
+
+	if ( lod.IndexCount == 0 )
+		return;
+
+	render_context.Commands.Record( GlwCommandTypes::Draw_Base_Vertex, GlwCommandDrawBaseVertex{ { }, lod.IndexCount, lod.FirstIndex, 0 } );
+
+	GlwTrackDraw( m_debug_tracker, render_context.RenderPass, lod.IndexCount );
+}
+
+void GlwGraphicsManager::CmdDrawInstanced(
+	GlwRenderContext& render_context,
+	const uint32_t vertice_count,
+	const uint32_t instance_count
+) {
+	CmdDrawInstanced( render_context, vertice_count, instance_count, 0, 0, 0 );
+}
+
+void GlwGraphicsManager::CmdDrawInstanced(
+	GlwRenderContext& render_context,
+	const uint32_t vertice_count,
+	const uint32_t instance_count,
+	const uint32_t first_vertice,
+	const int32_t base_vertex,
+	const uint32_t base_instance
+) {
+	if ( !render_context.GetCanDraw( ) || vertice_count == 0 || instance_count == 0 )
+		return;
+
+	auto command = GlwCommandDrawInstanced{ { }, vertice_count, instance_count, first_vertice, base_vertex, base_instance, render_context.UseIndex };
+
+	render_context.Commands.Record( GlwCommandTypes::Draw_Instanced, command );
+
+	GlwTrackDraw( m_debug_tracker, render_context.RenderPass, vertice_count * instance_count );
+}
+
+void GlwGraphicsManager::CmdMultiDrawElementsIndirect(
+	GlwRenderContext& render_context,
+	const GlwBuffer& indirect,
+	const uint32_t draw_count
+) {
+	CmdMultiDrawElementsIndirect( render_context, indirect, 0, draw_count, 0 );
+}
+
+void GlwGraphicsManager::CmdMultiDrawElementsIndirect(
+	GlwRenderContext& render_context,
+	const GlwBuffer& indirect,
+	const uint32_t offset,
+	const uint32_t draw_count,
+	const uint32_t stride
+) {
+	if ( !render_context.GetCanDraw( ) || !render_context.UseIndex || !indirect.GetIsValid( ) || draw_count == 0 )
+		return;
+
+	auto command = GlwCommandMultiDrawIndirect{ { }, indirect.Get( ), offset, draw_count, stride };
+
+	render_context.Commands.Record( GlwCommandTypes::Multi_Draw_Indirect, command );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdMultiDrawElementsIndirect", draw_count );
+}
+
+void GlwGraphicsManager::CmdMultiDrawElementsIndirectCount(
+	GlwRenderContext& render_context,
+	const GlwBuffer& indirect,
+	const GlwBuffer& parameter,
+	const uint32_t max_draw_count
+) {
+	CmdMultiDrawElementsIndirectCount( render_context, indirect, 0, parameter, 0, max_draw_count, 0 );
+}
+
+void GlwGraphicsManager::CmdMultiDrawElementsIndirectCount(
+	GlwRenderContext& render_context,
+	const GlwBuffer& indirect,
+	const uint32_t offset,
+	const GlwBuffer& parameter,
+	const uint32_t parameter_offset,
+	const uint32_t max_draw_count,
+	const uint32_t stride
+) {
+	if ( !render_context.GetCanDraw( ) || !render_context.UseIndex || !indirect.GetIsValid( ) || !parameter.GetIsValid( ) || max_draw_count == 0 )
+		return;
+
+	if ( !GetSupportsIndirectCount( ) ) {
+#		ifdef _DEBUG
+		printf( "[ GLW - ERROR ] CmdMultiDrawElementsIndirectCount require OpenGL 4.6 or ARB_indirect_parameters\n" );
+#		endif
+
+		return;
+	}
+
+	auto command = GlwCommandMultiDrawIndirectCount{ { }, indirect.Get( ), offset, parameter.Get( ), parameter_offset, max_draw_count, stride };
+
+	render_context.Commands.Record( GlwCommandTypes::Multi_Draw_Indirect_Count, command );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdMultiDrawElementsIndirectCount", max_draw_count );
+}
+
+void GlwGraphicsManager::CmdDispatch( GlwRenderContext& render_context, const glm::uvec3& group_count ) {
+	if ( !render_context.GetInUse( ) || group_count.x == 0 || group_count.y == 0 || group_count.z == 0 )
+		return;
+
+	auto* material = GetMaterial( render_context.Material );
+
+	if ( material == nullptr || !material->GetIsCompute( ) )
+		return;
+
+	render_context.Commands.Record( GlwCommandTypes::Dispatch, GlwCommandDispatch{ { }, group_count } );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdDispatch", group_count.x * group_count.y * group_count.z );
+}
+
+void GlwGraphicsManager::CmdDispatchIndirect( GlwRenderContext& render_context, const GlwBuffer& indirect ) {
+	CmdDispatchIndirect( render_context, indirect, 0 );
+}
+
+void GlwGraphicsManager::CmdDispatchIndirect(
+	GlwRenderContext& render_context,
+	const GlwBuffer& indirect,
+	const uint32_t offset
+) {
+	if ( !render_context.GetInUse( ) || !indirect.GetIsValid( ) )
+		return;
+
+	auto* material = GetMaterial( render_context.Material );
+
+	if ( material == nullptr || !material->GetIsCompute( ) )
+		return;
+
+	render_context.Commands.Record( GlwCommandTypes::Dispatch_Indirect, GlwCommandDispatchIndirect{ { }, indirect.Get( ), offset } );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdDispatchIndirect", offset );
+}
+
+void GlwGraphicsManager::CmdMemoryBarrier( GlwRenderContext& render_context, const uint32_t barriers ) {
+	if ( !render_context.GetInUse( ) || barriers == 0 )
+		return;
+
+	render_context.Commands.Record( GlwCommandTypes::Memory_Barrier, GlwCommandMemoryBarrier{ { }, barriers } );
+
+	GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdMemoryBarrier", barriers );
+}
+
+void GlwGraphicsManager::CmdDrawQueue(
+	GlwRenderContext& render_context,
+	GlwRenderQueue& render_queue
+) {
+	render_queue.Sort( );
+
+	auto count = render_queue.GetCount( );
+
+	for ( auto order = 0u; order < count; order++ ) {
+		auto& item        = render_queue.GetItem( order );
+		auto render_pass = render_queue.GetRenderPass( order );
+
+		if ( render_context.RenderPass != render_pass )
+			CmdUseRenderPass( render_context, render_pass );
+
+		if ( render_context.Material != item.Material )
+			CmdUseMaterial( render_context, item.Material );
+
+		if ( render_context.Mesh != item.Mesh )
+			CmdUseMesh( render_context, item.Mesh );
+
+		if ( item.GetHasStream( ) )
+			CmdBindStreamBuffer( render_context, item.StreamBuffer, item.StreamBinding, item.StreamOffset, item.StreamLength );
+
+		CmdDraw( render_context, item.VerticeCount );
+	}
+}
+
 void GlwGraphicsManager::Present( 
 	const GlwWindow* window, 
 	GlwRenderContext& render_context 
 ) {
+	m_command_lists.insert( m_command_lists.begin( ), &render_context );
+
+	std::stable_sort( 
+		m_command_lists.begin( ), 
+		m_command_lists.end( ), 
+		[]( const GlwRenderContext* left, const GlwRenderContext* right ) { return left->Key < right->Key; }
+	);
+
+	for ( auto* command_list : m_command_lists )
+		Submit( command_list->Commands );
+
+	m_command_lists.clear( );
+
+	m_ressources.ReleaseStreamBuffers( );
+
 	PlatformSwapBuffers( window );
 }
 
@@ -586,6 +1290,350 @@ void GlwGraphicsManager::Resize( const GlwWindow* window ) {
 	m_need_resize = false;
 }
 
+void GlwGraphicsManager::Submit( const GlwCommandBuffer& command_buffer ) {
+	auto* data      = command_buffer.GetData( );
+	auto* material  = (GlwMaterial*)nullptr;
+	auto size       = command_buffer.GetSize( );
+	auto offset     = (uint32_t)0;
+	auto index_type = (GLenum)GL_UNSIGNED_INT;
+	auto index_size = (uint32_t)sizeof( uint32_t );
+	auto geometry   = false;
+	auto* pool      = (GlwGeometryPool*)nullptr;
+
+	while ( offset < size ) {
+		auto* header = (const GlwCommandHeader*)( data + offset );
+
+		switch ( header->Type ) {
+			case GlwCommandTypes::Use_Render_Pass :
+				( (const GlwCommandUseRenderPass*)header )->RenderPass->Use( m_state_tracker );
+				break;
+
+			case GlwCommandTypes::Use_Swapchain : {
+				auto* command = (const GlwCommandUseSwapchain*)header;
+
+				if ( command->UseDimensions )
+					m_swapchain.Use( m_state_tracker, command->Dimensions );
+				else
+					m_swapchain.Use( m_state_tracker );
+			} break;
+
+			case GlwCommandTypes::Toggle : {
+				auto* command = (const GlwCommandToggle*)header;
+
+				m_state_tracker.Toggle( command->Target, command->State );
+			} break;
+
+			case GlwCommandTypes::Set_Viewport :
+				m_state_tracker.SetViewport( ( (const GlwCommandBounds*)header )->Bounds );
+				break;
+
+			case GlwCommandTypes::Set_Scissor :
+				m_state_tracker.SetScissor( ( (const GlwCommandBounds*)header )->Bounds );
+				break;
+
+			case GlwCommandTypes::Toggle_Color_Writes : {
+				auto* command = (const GlwCommandToggle*)header;
+
+				m_state_tracker.SetColorMask( command->Target, command->State );
+			} break;
+
+			case GlwCommandTypes::Toggle_Stencil_Write :
+				m_state_tracker.SetStencilMask( ( ( (const GlwCommandToggle*)header )->State == GlwStates::Enable ) ? 0xFF : 0x00 );
+				break;
+
+			case GlwCommandTypes::Clear_Color : {
+				auto* command = (const GlwCommandClearColor*)header;
+
+				glClearBufferfv( GL_COLOR, command->Attachement, glm::value_ptr( command->Color ) );
+			} break;
+
+			case GlwCommandTypes::Clear_Depth :
+				glClearBufferfv( GL_DEPTH, 0, &( (const GlwCommandClearDepthStencil*)header )->Depth );
+				break;
+
+			case GlwCommandTypes::Clear_Stencil :
+				glClearBufferiv( GL_STENCIL, 0, &( (const GlwCommandClearDepthStencil*)header )->Stencil );
+				break;
+
+			case GlwCommandTypes::Blit_Render_Target :
+				m_render_passes.CmdBlitRenderTarget( ( (const GlwCommandBlit*)header )->Specification );
+				break;
+
+			case GlwCommandTypes::Use_Material :
+				material = ( (const GlwCommandUseMaterial*)header )->Material->Use( m_state_tracker );
+				break;
+
+			case GlwCommandTypes::Set_Uniform :
+				if ( material != nullptr )
+					SubmitUniform( material, (const GlwCommandSetUniform*)header );
+				break;
+
+			case GlwCommandTypes::Set_Uniform_Buffer : {
+				auto* command = (const GlwCommandSetUniformBuffer*)header;
+
+				if ( material == nullptr || !material->SetUniformBlockBinding( command->Location ) )
+					break;
+
+				glBindBufferBase( GL_UNIFORM_BUFFER, (GLuint)command->Location, command->Buffer );
+
+				m_barrier_tracker.BindUniform( (uint32_t)command->Location, command->Buffer );
+			} break;
+
+			case GlwCommandTypes::Use_Mesh : {
+				auto* mesh = ( (const GlwCommandUseMesh*)header )->Mesh;
+
+				mesh->Use( m_state_tracker );
+
+				m_barrier_tracker.BindGeometry( mesh->GetVBO( ).Get( ), mesh->GetInstanceBuffer( ).Get( ), mesh->GetIBO( ).Get( ) );
+
+				index_type = (GLenum)mesh->GetIndexType( );
+				index_size = mesh->GetIndexSize( );
+				geometry   = true;
+				pool       = nullptr;
+			} break;
+
+			case GlwCommandTypes::Use_Geometry_Pool : {
+				auto* geometry_pool = ( (const GlwCommandUseGeometryPool*)header )->GeometryPool;
+
+				geometry_pool->Use( m_state_tracker );
+
+				m_barrier_tracker.BindGeometry( geometry_pool->GetVBO( ).Get( ), geometry_pool->GetIBO( ).Get( ) );
+
+				index_type = GL_UNSIGNED_INT;
+				index_size = sizeof( uint32_t );
+				geometry   = true;
+				pool       = geometry_pool;
+			} break;
+
+			case GlwCommandTypes::Use_Stream_Geometry : {
+				auto* command = (const GlwCommandUseStreamGeometry*)header;
+
+				command->Format->Bind( 0, command->Vertex, command->Stride );
+
+				if ( glIsValid( command->Index ) )
+					command->Format->BindIndex( command->Index );
+
+				command->Format->Use( m_state_tracker );
+
+				m_barrier_tracker.BindGeometry( command->Vertex, command->Index );
+
+				index_type = GL_UNSIGNED_INT;
+				index_size = sizeof( uint32_t );
+				geometry   = true;
+				pool       = nullptr;
+			} break;
+
+			case GlwCommandTypes::Use_Texture : {
+				auto* command = (const GlwCommandUseTexture*)header;
+
+				m_state_tracker.UseTexture( command->Slot, command->Texture );
+				m_barrier_tracker.BindTexture( command->Slot, command->Texture );
+			} break;
+
+			case GlwCommandTypes::Bind_Stream_Buffer : {
+				auto* command = (const GlwCommandBindStreamBuffer*)header;
+
+				command->StreamBuffer->BindRange( command->Binding, command->Offset, command->Length );
+
+				if ( command->StreamBuffer->GetType( ) == GlwBufferTypes::Uniform )
+					m_barrier_tracker.BindUniform( command->Binding, command->StreamBuffer->Get( ) );
+				else if ( command->StreamBuffer->GetType( ) == GlwBufferTypes::Storage )
+					m_barrier_tracker.BindStorage( command->Binding, command->StreamBuffer->Get( ), GlwAccessModes::Read );
+			} break;
+
+			case GlwCommandTypes::Bind_Uniform_Buffer : {
+				auto* command = (const GlwCommandBindUniformBuffer*)header;
+
+				if ( command->Length > 0 )
+					glBindBufferRange( GL_UNIFORM_BUFFER, command->Binding, command->Buffer, (GLintptr)command->Offset, (GLsizeiptr)command->Length );
+				else
+					glBindBufferBase( GL_UNIFORM_BUFFER, command->Binding, command->Buffer );
+
+				m_barrier_tracker.BindUniform( command->Binding, command->Buffer );
+			} break;
+
+			case GlwCommandTypes::Bind_Storage_Buffer : {
+				auto* command = (const GlwCommandBindStorageBuffer*)header;
+
+				if ( command->Length > 0 )
+					glBindBufferRange( GL_SHADER_STORAGE_BUFFER, command->Binding, command->Buffer, (GLintptr)command->Offset, (GLsizeiptr)command->Length );
+				else
+					glBindBufferBase( GL_SHADER_STORAGE_BUFFER, command->Binding, command->Buffer );
+
+				m_barrier_tracker.BindStorage( command->Binding, command->Buffer, command->Access );
+			} break;
+
+			case GlwCommandTypes::Bind_Image : {
+				auto* command = (const GlwCommandBindImage*)header;
+
+				glBindImageTexture( command->Unit, command->Texture, command->Level, command->Layered ? GL_TRUE : GL_FALSE, command->Layer, (GLenum)command->Access, command->Format );
+
+				m_barrier_tracker.BindImage( command->Unit, command->Texture, command->Access );
+			} break;
+
+			case GlwCommandTypes::Draw : {
+				if ( material == nullptr || !geometry )
+					break;
+
+				auto* command = (const GlwCommandDraw*)header;
+
+				m_barrier_tracker.PrepareDraw( );
+
+				if ( command->UseIndex )
+					glDrawElements( GL_TRIANGLES, command->VerticeCount, index_type, NULL );
+				else
+					glDrawArrays( GL_TRIANGLES, 0, command->VerticeCount );
+
+				m_barrier_tracker.Commit( );
+			} break;
+
+			case GlwCommandTypes::Draw_Base_Vertex : {
+				if ( material == nullptr || !geometry )
+					break;
+
+				auto* command = (const GlwCommandDrawBaseVertex*)header;
+				auto* indices = (const void*)( (uintptr_t)command->FirstIndex * index_size );
+
+				m_barrier_tracker.PrepareDraw( );
+
+				glDrawElementsBaseVertex( GL_TRIANGLES, command->VerticeCount, index_type, indices, command->BaseVertex );
+
+				m_barrier_tracker.Commit( );
+			} break;
+
+			case GlwCommandTypes::Draw_Geometry : {
+				if ( material == nullptr || pool == nullptr )
+					break;
+
+				auto* command  = (const GlwCommandDrawGeometry*)header;
+				auto* instance = pool->GetGeometry( command->Geometry );
+
+				if ( instance == nullptr )
+					break;
+
+				auto* indices = (const void*)( (uintptr_t)instance->Indexes.Offset * index_size );
+
+				m_barrier_tracker.PrepareDraw( );
+
+				glDrawElementsBaseVertex( GL_TRIANGLES, instance->Indexes.Length, index_type, indices, (GLint)instance->Vertices.Offset );
+
+				m_barrier_tracker.Commit( );
+			} break;
+
+			case GlwCommandTypes::Draw_Instanced : {
+				if ( material == nullptr || !geometry )
+					break;
+
+				auto* command = (const GlwCommandDrawInstanced*)header;
+
+				m_barrier_tracker.PrepareDraw( );
+
+				if ( command->UseIndex ) {
+					auto* indices = (const void*)( (uintptr_t)command->FirstVertice * index_size );
+
+					glDrawElementsInstancedBaseVertexBaseInstance( GL_TRIANGLES, command->VerticeCount, index_type, indices, command->InstanceCount, command->BaseVertex, command->BaseInstance );
+				} else
+					glDrawArraysInstancedBaseInstance( GL_TRIANGLES, command->FirstVertice, command->VerticeCount, command->InstanceCount, command->BaseInstance );
+
+				m_barrier_tracker.Commit( );
+			} break;
+
+			case GlwCommandTypes::Multi_Draw_Indirect : {
+				if ( material == nullptr || !geometry )
+					break;
+
+				auto* command  = (const GlwCommandMultiDrawIndirect*)header;
+				auto* indirect = (const void*)(uintptr_t)command->Offset;
+
+				m_barrier_tracker.RequireBuffer( command->Indirect, GL_COMMAND_BARRIER_BIT );
+				m_barrier_tracker.PrepareDraw( );
+
+				glBindBuffer( GL_DRAW_INDIRECT_BUFFER, command->Indirect );
+				glMultiDrawElementsIndirect( GL_TRIANGLES, index_type, indirect, command->DrawCount, command->Stride );
+
+				m_barrier_tracker.Commit( );
+			} break;
+
+			case GlwCommandTypes::Multi_Draw_Indirect_Count : {
+				if ( material == nullptr || !geometry )
+					break;
+
+				auto* command  = (const GlwCommandMultiDrawIndirectCount*)header;
+				auto* indirect = (const void*)(uintptr_t)command->Offset;
+
+				m_barrier_tracker.RequireBuffer( command->Indirect, GL_COMMAND_BARRIER_BIT );
+				m_barrier_tracker.RequireBuffer( command->Parameter, GL_COMMAND_BARRIER_BIT );
+				m_barrier_tracker.PrepareDraw( );
+
+				glBindBuffer( GL_DRAW_INDIRECT_BUFFER, command->Indirect );
+				glBindBuffer( GL_PARAMETER_BUFFER, command->Parameter );
+
+				if ( GLEW_VERSION_4_6 )
+					glMultiDrawElementsIndirectCount( GL_TRIANGLES, index_type, indirect, (GLintptr)command->ParameterOffset, command->MaxDrawCount, command->Stride );
+				else if ( GLEW_ARB_indirect_parameters )
+					glMultiDrawElementsIndirectCountARB( GL_TRIANGLES, index_type, indirect, (GLintptr)command->ParameterOffset, command->MaxDrawCount, command->Stride );
+
+				m_barrier_tracker.Commit( );
+			} break;
+
+			case GlwCommandTypes::Dispatch : {
+				if ( material == nullptr )
+					break;
+
+				auto* command = (const GlwCommandDispatch*)header;
+
+				m_barrier_tracker.PrepareDispatch( );
+
+				glDispatchCompute( command->GroupCount.x, command->GroupCount.y, command->GroupCount.z );
+
+				m_barrier_tracker.Commit( );
+			} break;
+
+			case GlwCommandTypes::Dispatch_Indirect : {
+				if ( material == nullptr )
+					break;
+
+				auto* command = (const GlwCommandDispatchIndirect*)header;
+
+				m_barrier_tracker.RequireBuffer( command->Indirect, GL_COMMAND_BARRIER_BIT );
+				m_barrier_tracker.PrepareDispatch( );
+
+				glBindBuffer( GL_DISPATCH_INDIRECT_BUFFER, command->Indirect );
+				glDispatchComputeIndirect( (GLintptr)command->Offset );
+
+				m_barrier_tracker.Commit( );
+			} break;
+
+			case GlwCommandTypes::Memory_Barrier :
+				m_barrier_tracker.Barrier( ( (const GlwCommandMemoryBarrier*)header )->Barriers );
+				break;
+
+			default : break;
+		}
+
+		offset += header->Size;
+	}
+}
+
+void GlwGraphicsManager::SubmitUniform( 
+	GlwMaterial* material, 
+	const GlwCommandSetUniform* command 
+) {
+	auto* value = (const uint8_t*)command + sizeof( GlwCommandSetUniform );
+
+	switch ( command->Type ) {
+		case GL_INT        : material->SetUniform( command->Location, *(const int32_t*)value ); break;
+		case GL_FLOAT      : material->SetUniform( command->Location, *(const float*)value ); break;
+		case GL_FLOAT_VEC2 : material->SetUniform( command->Location, *(const glm::vec2*)value ); break;
+		case GL_FLOAT_VEC3 : material->SetUniform( command->Location, *(const glm::vec3*)value ); break;
+		case GL_FLOAT_VEC4 : material->SetUniform( command->Location, *(const glm::vec4*)value ); break;
+		case GL_FLOAT_MAT3 : material->SetUniform( command->Location, *(const glm::mat3*)value ); break;
+		case GL_FLOAT_MAT4 : material->SetUniform( command->Location, *(const glm::mat4*)value ); break;
+
+		default : break;
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -593,10 +1641,22 @@ const GlwDebugTracker& GlwGraphicsManager::GetDebugTracker( ) const {
 	return m_debug_tracker;
 }
 
+const GlwStateTracker& GlwGraphicsManager::GetStateTracker( ) const {
+	return m_state_tracker;
+}
+
+const GlwBarrierTracker& GlwGraphicsManager::GetBarrierTracker( ) const {
+	return m_barrier_tracker;
+}
+
 GlwStates GlwGraphicsManager::GetDrawState( ) const {
 	return m_state;
 }
 
+bool GlwGraphicsManager::GetSupportsIndirectCount( ) const {
+	return GLEW_VERSION_4_6 || GLEW_ARB_indirect_parameters;
+}
+
 GlwRessourceManager& GlwGraphicsManager::GetRessources( ) {
 	return m_ressources;
 }
@@ -621,6 +1681,22 @@ uint32_t GlwGraphicsManager::GetMaterialCount( ) const {
 	return m_ressources.GetMaterialCount( );
 }
 
+uint32_t GlwGraphicsManager::GetPendingMaterialCount( ) const {
+	return m_ressources.GetPendingMaterialCount( );
+}
+
+uint32_t GlwGraphicsManager::GetStreamBufferCount( ) const {
+	return m_ressources.GetStreamBufferCount( );
+}
+
+uint32_t GlwGraphicsManager::GetGeometryPoolCount( ) const {
+	return m_ressources.GetGeometryPoolCount( );
+}
+
+uint32_t GlwGraphicsManager::GetVertexFormatCount( ) const {
+	return m_ressources.GetVertexFormatCount( );
+}
+
 bool GlwGraphicsManager::GetMeshExist( const uint32_t mesh ) const {
 	return m_ressources.GetMeshExist( mesh );
 }
@@ -637,6 +1713,14 @@ bool GlwGraphicsManager::GetMaterialExist( const uint32_t material ) const {
 	return m_ressources.GetMaterialExist( material );
 }
 
+bool GlwGraphicsManager::GetStreamBufferExist( const glw_ressource stream_buffer ) const {
+	return m_ressources.GetStreamBufferExist( stream_buffer );
+}
+
+bool GlwGraphicsManager::GetGeometryPoolExist( const glw_ressource geometry_pool ) const {
+	return m_ressources.GetGeometryPoolExist( geometry_pool );
+}
+
 GlwRenderPass* GlwGraphicsManager::GetRenderPass( const uint32_t render_pass ) const {
 	return m_render_passes.GetRenderPass( render_pass );
 }
@@ -661,6 +1745,18 @@ GlwTextureCubemap* GlwGraphicsManager::GetCubemap( const uint32_t cubemap ) {
 	return m_ressources.GetCubemap( cubemap );
 }
 
+const GlwProgramCache& GlwGraphicsManager::GetProgramCache( ) const {
+	return m_ressources.GetProgramCache( );
+}
+
 GlwMaterial* GlwGraphicsManager::GetMaterial( const glw_ressource material ) {
 	return m_ressources.GetMaterial( material );
 }
+
+GlwStreamBuffer* GlwGraphicsManager::GetStreamBuffer( const glw_ressource stream_buffer ) {
+	return m_ressources.GetStreamBuffer( stream_buffer );
+}
+
+GlwGeometryPool* GlwGraphicsManager::GetGeometryPool( const glw_ressource geometry_pool ) {
+	return m_ressources.GetGeometryPool( geometry_pool );
+}
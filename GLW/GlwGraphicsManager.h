@@ -41,6 +41,10 @@ protected:
     GlwRenderPassManager m_render_passes;
     GlwRessourceManager m_ressources;
     GlwDebugTracker m_debug_tracker;
+    GlwStateTracker m_state_tracker;
+    GlwBarrierTracker m_barrier_tracker;
+    std::mutex m_command_list_mutex;
+    std::vector<GlwRenderContext*> m_command_lists;
     bool m_need_resize;
 
 public:
@@ -136,6 +140,18 @@ public:
      **/
     bool CreateMesh( const GlwMeshSpecification& specification );
 
+    /**
+     * CreateMesh function
+     * @note : Create mesh according to query specification.
+     * @param specification : Query mesh specification.
+     * @param mesh : Store created mesh handle.
+     * @return : True when creation succeeded.
+     **/
+    bool CreateMesh( 
+        const GlwMeshSpecification& specification,
+        glw_ressource& mesh
+    );
+
     /**
      * CreateTexture2D function
      * @note : Create texture according to query specification.
@@ -144,6 +160,18 @@ public:
      **/
     bool CreateTexture2D( const GlwTexture2DSpecification& specification );
 
+    /**
+     * CreateTexture2D function
+     * @note : Create texture according to query specification.
+     * @param specification : Query texture specification.
+     * @param texture : Store created texture handle.
+     * @return : True when creation succeeded.
+     **/
+    bool CreateTexture2D( 
+        const GlwTexture2DSpecification& specification,
+        glw_ressource& texture
+    );
+
     /**
      * CreateTexture2D function
      * @note : Create texture according to query specification and fill-it width pixels data.
@@ -156,6 +184,20 @@ public:
         const std::vector<uint8_t>& pixels
     );
 
+    /**
+     * CreateTexture2D function
+     * @note : Create texture according to query specification and fill-it width pixels data.
+     * @param specification : Query texture specification.
+     * @param pixels : Query texture pixels data as unsigned byte.
+     * @param texture : Store created texture handle.
+     * @return : True when creation succeeded.
+     **/
+    bool CreateTexture2D( 
+        const GlwTexture2DSpecification& specification,
+        const std::vector<uint8_t>& pixels,
+        glw_ressource& texture
+    );
+
     /**
      * CreateCubemap function
      * @note : Create cubemap texture according to query specification.
@@ -164,6 +206,18 @@ public:
      **/
     bool CreateCubemap( const GlwTextureCubemapSpecification& specification );
 
+    /**
+     * CreateCubemap function
+     * @note : Create cubemap texture according to query specification.
+     * @param specification : Query cubemap texture specification.
+     * @param cubemap : Store created cubemap handle.
+     * @return : True when creation succeeded.
+     **/
+    bool CreateCubemap( 
+        const GlwTextureCubemapSpecification& specification,
+        glw_ressource& cubemap
+    );
+
     /**
      * CreateCubemap function
      * @note : Create cubemap texture according to query specification.
@@ -176,6 +230,35 @@ public:
         const std::vector<uint8_t> face_pixels[ GlwTextureCubemap::FaceCount ]
     );
 
+    /**
+     * CreateCubemap function
+     * @note : Create cubemap texture according to query specification.
+     * @param specification : Query cubemap texture specification.
+     * @param face_pixels : Array of the cubemap face texture pixels as unsigned byte.
+     * @param cubemap : Store created cubemap handle.
+     * @return : True when creation succeeded.
+     **/
+    bool CreateCubemap(
+        const GlwTextureCubemapSpecification& specification,
+        const std::vector<uint8_t> face_pixels[ GlwTextureCubemap::FaceCount ],
+        glw_ressource& cubemap
+    );
+
+    /**
+     * CreateProgramCache function
+     * @note : Enable on-disk program binary cache for materials created afterward.
+     *         Must be called once the OpenGL context is created.
+     * @param directory : Query cache directory path.
+     * @return : True when the cache is enabled.
+     **/
+    bool CreateProgramCache( const std::string& directory );
+
+    /**
+     * ClearProgramCache method
+     * @note : Remove every cached program binary and reset cache statistics.
+     **/
+    void ClearProgramCache( );
+
     /**
      * CreateMaterial function
      * @note : Create material according to query specification.
@@ -184,6 +267,117 @@ public:
      **/
     bool CreateMaterial( const GlwMaterialSpecification& specification );
 
+    /**
+     * CreateMaterial function
+     * @note : Create material according to query specification.
+     * @param specification : Query material specification.
+     * @param material : Store created material handle.
+     * @return : True when creation succeeded.
+     **/
+    bool CreateMaterial( 
+        const GlwMaterialSpecification& specification,
+        glw_ressource& material
+    );
+
+    /**
+     * SubmitMaterial function
+     * @note : Create material without waiting on the shader compiler, compiles
+     *         run on driver threads when GL_KHR_parallel_shader_compile is
+     *         available. CmdUseMaterial use the placeholder material until
+     *         the material is ready.
+     * @param specification : Query material specification.
+     * @param material : Store created material handle.
+     * @return : True when submission succeeded.
+     **/
+    bool SubmitMaterial( 
+        const GlwMaterialSpecification& specification,
+        glw_ressource& material
+    );
+
+    /**
+     * CreateMaterialVariant function
+     * @note : Get material of query template variant, the variant is
+     *         preprocessed and compiled on first request only.
+     * @param material_template : Query material template.
+     * @param defines : Query variant defines.
+     * @param material : Store variant material handle.
+     * @return : True when variant exist or creation succeeded.
+     **/
+    bool CreateMaterialVariant(
+        GlwMaterialTemplate& material_template,
+        const GlwMaterialDefines& defines,
+        glw_ressource& material
+    );
+
+    /**
+     * SubmitMaterialVariant function
+     * @note : Get material of query template variant like CreateMaterialVariant,
+     *         a new variant is submitted without waiting on the shader compiler.
+     * @param material_template : Query material template.
+     * @param defines : Query variant defines.
+     * @param material : Store variant material handle.
+     * @return : True when variant exist or submission succeeded.
+     **/
+    bool SubmitMaterialVariant(
+        GlwMaterialTemplate& material_template,
+        const GlwMaterialDefines& defines,
+        glw_ressource& material
+    );
+
+    /**
+     * SetPlaceholderMaterial method
+     * @note : Set material used in place of pending materials.
+     * @param material : Query placeholder material, should be created with CreateMaterial.
+     **/
+    void SetPlaceholderMaterial( const glw_ressource material );
+
+    /**
+     * PollMaterials function
+     * @note : Resolve pending materials the driver completed, already called
+     *         by Acquire. Loading screens can poll it to track progress.
+     * @return : Return count of materials still pending.
+     **/
+    uint32_t PollMaterials( );
+
+    /**
+     * CreateStreamBuffer function
+     * @note : Create persistently mapped stream buffer according to query specification.
+     * @param specification : Query stream buffer specification.
+     * @param stream_buffer : Store created stream buffer handle.
+     * @return : True when creation succeeded.
+     **/
+    bool CreateStreamBuffer(
+        const GlwStreamBufferSpecification& specification,
+        glw_ressource& stream_buffer
+    );
+
+    /**
+     * CreateStreamBuffer function
+     * @note : Create persistently mapped vertex stream buffer, the vertex
+     *         format used by CmdUseStreamGeometry is resolved here.
+     * @param specification : Query stream buffer specification.
+     * @param attributes : Query vertex attribute list, read from binding slot 0.
+     * @param stream_buffer : Store created stream buffer handle.
+     * @return : True when creation succeeded.
+     **/
+    bool CreateStreamBuffer(
+        const GlwStreamBufferSpecification& specification,
+        const std::vector<GlwVertexAttribute>& attributes,
+        glw_ressource& stream_buffer
+    );
+
+    /**
+     * CreateGeometryPool function
+     * @note : Create geometry pool according to query specification.
+     * @param specification : Query geometry pool specification.
+     * @param geometry_pool : Store created geometry pool handle.
+     * @return : True when creation succeeded.
+     **/
+    bool CreateGeometryPool(
+        const GlwGeometryPoolSpecification& specification,
+        glw_ressource& geometry_pool
+    );
+
     /**
      * ReplaceMesh function
      * @note : Replace mesh according to query specification.
@@ -260,6 +454,54 @@ public:
         const GlwMaterialSpecification& specification
     );
 
+    /**
+     * DestroyMesh function
+     * @note : Destroy mesh, its handle become stale and its slot is reused.
+     * @param mesh : Query mesh.
+     * @return : True when mesh existed.
+     **/
+    bool DestroyMesh( const glw_ressource mesh );
+
+    /**
+     * DestroyTexture2D function
+     * @note : Destroy texture 2D, its handle become stale and its slot is reused.
+     * @param texture : Query texture 2D.
+     * @return : True when texture 2D existed.
+     **/
+    bool DestroyTexture2D( const glw_ressource texture );
+
+    /**
+     * DestroyCubemap function
+     * @note : Destroy cubemap, its handle become stale and its slot is reused.
+     * @param cubemap : Query cubemap.
+     * @return : True when cubemap existed.
+     **/
+    bool DestroyCubemap( const glw_ressource cubemap );
+
+    /**
+     * DestroyMaterial function
+     * @note : Destroy material, its handle become stale and its slot is reused.
+     * @param material : Query material.
+     * @return : True when material existed.
+     **/
+    bool DestroyMaterial( const glw_ressource material );
+
+    /**
+     * DestroyStreamBuffer function
+     * @note : Destroy stream buffer, its handle become stale and its slot is reused.
+     * @param stream_buffer : Query stream buffer.
+     * @return : True when stream buffer existed.
+     **/
+    bool DestroyStreamBuffer( const glw_ressource stream_buffer );
+
+    /**
+     * DestroyGeometryPool function
+     * @note : Destroy geometry pool, its handle become stale and its slot is reused.
+     * @param geometry_pool : Query geometry pool.
+     * @return : True when geometry pool existed.
+     **/
+    bool DestroyGeometryPool( const glw_ressource geometry_pool );
+
     /**
      * FillTexture2D method
      * @note : Fill texture data.
@@ -318,6 +560,13 @@ public:
      **/
     void SetRefresh( const glm::vec4& color );
 
+    /**
+     * InvalidateState method
+     * @note : Forget shadowed OpenGL state and barrier bindings, call it
+     *         after any OpenGL call made outside of the graphic manager.
+     **/
+    void InvalidateState( );
+
     /**
      * Acquire function
      * @note : Acquire render context.
@@ -330,6 +579,35 @@ public:
         GlwRenderContext& render_context 
     );
 
+    /**
+     * AcquireCommandList function
+     * @note : Prepare a render context for recording on any thread. The list
+     *         start by using query render pass, so its replay does not depend
+     *         on the pass left bound by a previous list. Cmd* calls on
+     *         distinct lists can run concurrently, they make no OpenGL call
+     *         and only look ressources up. Ressources can be created while
+     *         recording, they must not be replaced or destroyed until the
+     *         lists using them are replayed by Present.
+     * @param command_list : Reference to recorded render context.
+     * @param render_pass : Query render pass the list is recorded for.
+     * @param key : Query replay order key.
+     * @return : Return true when drawing operation can be performed on the
+     *           query render pass.
+     **/
+    bool AcquireCommandList( 
+        GlwRenderContext& command_list, 
+        const uint32_t render_pass,
+        const uint64_t key
+    );
+
+    /**
+     * SubmitCommandList method
+     * @note : Queue recorded list for replay at next Present, can be called
+     *         from any thread. The list must stay alive until Present.
+     * @param command_list : Reference to recorded render context.
+     **/
+    void SubmitCommandList( GlwRenderContext& command_list );
+
     /**
      * CmdUseRenderPass function
      * @note : Bind and use render pass for rendering.
@@ -473,12 +751,15 @@ public:
 
     /**
      * CmdUseMaterial function
-     * @note : Use material for rendering.
+     * @note : Use material for rendering. The returned instance is read only,
+     *         its setters apply immediately when called instead of at replay,
+     *         values for following draws go through CmdSetUniform,
+     *         CmdSetUniformBuffer and CmdUseTexture.
      * @param render_context : Reference to current render context.
-     * @param material : Query material.
-     * @return : Return pointer to query material instance.
+     * @param material : Query material, a pending material is replaced by the placeholder material.
+     * @return : Return pointer to used material instance.
      **/
-    GlwMaterial* CmdUseMaterial( 
+    const GlwMaterial* CmdUseMaterial( 
         GlwRenderContext& render_context, 
         const glw_ressource material 
     );
@@ -495,6 +776,226 @@ public:
         const glw_ressource mesh
     );
 
+    /**
+     * CmdUseGeometryPool function
+     * @note : Use geometry pool for rendering, its meshes are drawn with
+     *         CmdDrawGeometry without any further vertex array bind.
+     * @param render_context : Reference to current render context.
+     * @param geometry_pool : Query geometry pool.
+     * @return : Return pointer to query geometry pool instance.
+     **/
+    GlwGeometryPool* CmdUseGeometryPool(
+        GlwRenderContext& render_context,
+        const glw_ressource geometry_pool
+    );
+
+    /**
+     * CmdUseStreamGeometry function
+     * @note : Use vertices written in a stream buffer for rendering, they are
+     *         drawn with CmdDrawStreamGeometry. The stream buffer must be
+     *         created with a vertex layout.
+     * @param render_context : Reference to current render context.
+     * @param vertex_stream : Query vertex stream buffer.
+     * @return : Return pointer to query vertex stream buffer instance.
+     **/
+    GlwStreamBuffer* CmdUseStreamGeometry(
+        GlwRenderContext& render_context,
+        const glw_ressource vertex_stream
+    );
+
+    /**
+     * CmdUseStreamGeometry function
+     * @note : Use vertices and uint32_t indices written in stream buffers for
+     *         rendering, they are drawn with CmdDrawStreamGeometry. The vertex
+     *         stream buffer must be created with a vertex layout.
+     * @param render_context : Reference to current render context.
+     * @param vertex_stream : Query vertex stream buffer.
+     * @param index_stream : Query index stream buffer.
+     * @return : Return pointer to query vertex stream buffer instance.
+     **/
+    GlwStreamBuffer* CmdUseStreamGeometry(
+        GlwRenderContext& render_context,
+        const glw_ressource vertex_stream,
+        const glw_ressource index_stream
+    );
+
+    /**
+     * CmdUseTexture method
+     * @note : Bind texture to a texture unit.
+     * @param render_context : Reference to current render context.
+     * @param slot : Query texture unit.
+     * @param texture : Query OpenGL texture value.
+     **/
+    void CmdUseTexture( 
+        GlwRenderContext& render_context, 
+        const uint32_t slot,
+        const glTexture texture
+    );
+
+    /**
+     * CmdBindStreamBuffer method
+     * @note : Bind a range of a stream buffer to an indexed binding point.
+     * @param render_context : Reference to current render context.
+     * @param stream_buffer : Query stream buffer.
+     * @param binding : Query binding point.
+     * @param offset : Query range offset from buffer start.
+     * @param length : Query range length in bytes.
+     **/
+    void CmdBindStreamBuffer(
+        GlwRenderContext& render_context,
+        const glw_ressource stream_buffer,
+        const uint32_t binding,
+        const uint32_t offset,
+        const uint32_t length
+    );
+
+    /**
+     * CmdBindUniformBuffer method
+     * @note : Bind a whole uniform buffer to a binding point, draws and
+     *         dispatches reading it wait for prior shader writes to it.
+     * @param render_context : Reference to current render context.
+     * @param binding : Query binding point.
+     * @param buffer : Query uniform buffer.
+     **/
+    void CmdBindUniformBuffer(
+        GlwRenderContext& render_context,
+        const uint32_t binding,
+        const GlwBuffer& buffer
+    );
+
+    /**
+     * CmdBindUniformBuffer method
+     * @note : Bind a range of a uniform buffer to a binding point.
+     * @param render_context : Reference to current render context.
+     * @param binding : Query binding point.
+     * @param buffer : Query uniform buffer.
+     * @param offset : Query range offset, multiple of uniform buffer offset alignment.
+     * @param length : Query range length in bytes, 0 for the whole buffer.
+     **/
+    void CmdBindUniformBuffer(
+        GlwRenderContext& render_context,
+        const uint32_t binding,
+        const GlwBuffer& buffer,
+        const uint32_t offset,
+        const uint32_t length
+    );
+
+    /**
+     * CmdSetUniformBuffer method
+     * @note : Set uniform buffer of current material for following draws, the
+     *         block use its index as binding point like SetUniformBuffer.
+     * @param render_context : Reference to current render context.
+     * @param location : Query material uniform buffer location.
+     * @param buffer : Query uniform buffer.
+     **/
+    void CmdSetUniformBuffer(
+        GlwRenderContext& render_context,
+        const int32_t location,
+        const GlwBuffer& buffer
+    );
+
+    /**
+     * CmdSetUniformBuffer method
+     * @note : Set uniform buffer of current material for following draws,
+     *         location is read from the material link time table.
+     * @param render_context : Reference to current render context.
+     * @param hash : Query material uniform buffer name hash.
+     * @param buffer : Query uniform buffer.
+     **/
+    void CmdSetUniformBuffer(
+        GlwRenderContext& render_context,
+        const GlwUniformHash hash,
+        const GlwBuffer& buffer
+    );
+
+    /**
+     * CmdBindStorageBuffer method
+     * @note : Bind a whole buffer to a shader storage binding point, write
+     *         access make following commands reading the buffer wait for
+     *         the shader writes.
+     * @param render_context : Reference to current render context.
+     * @param binding : Query binding point.
+     * @param buffer : Query buffer.
+     * @param access : Query shader access to the buffer.
+     **/
+    void CmdBindStorageBuffer(
+        GlwRenderContext& render_context,
+        const uint32_t binding,
+        const GlwBuffer& buffer,
+        const GlwAccessModes access
+    );
+
+    /**
+     * CmdBindStorageBuffer method
+     * @note : Bind a range of a buffer to a shader storage binding point.
+     * @param render_context : Reference to current render context.
+     * @param binding : Query binding point.
+     * @param buffer : Query buffer.
+     * @param offset : Query range offset from buffer start.
+     * @param length : Query range length in bytes, 0 for the whole buffer.
+     * @param access : Query shader access to the buffer.
+     **/
+    void CmdBindStorageBuffer(
+        GlwRenderContext& render_context,
+        const uint32_t binding,
+        const GlwBuffer& buffer,
+        const uint32_t offset,
+        const uint32_t length,
+        const GlwAccessModes access
+    );
+
+    /**
+     * CmdBindImage method
+     * @note : Bind a texture level to an image unit for shader load and
+     *         store.
+     * @param render_context : Reference to current render context.
+     * @param unit : Query image unit.
+     * @param texture : Query OpenGL texture value.
+     * @param level : Query texture mip level.
+     * @param access : Query shader access to the image.
+     * @param format : Query image format, like GL_RGBA8.
+     **/
+    void CmdBindImage(
+        GlwRenderContext& render_context,
+        const uint32_t unit,
+        const glTexture texture,
+        const int32_t level,
+        const GlwAccessModes access,
+        const uint32_t format
+    );
+
+    /**
+     * CmdBindImage method
+     * @note : Bind a texture level, or one of its layers, to an image unit.
+     * @param render_context : Reference to current render context.
+     * @param unit : Query image unit.
+     * @param texture : Query OpenGL texture value.
+     * @param level : Query texture mip level.
+     * @param layered : Query true to bind every layers of the level.
+     * @param layer : Query bound layer when not layered.
+     * @param access : Query shader access to the image.
+     * @param format : Query image format, like GL_RGBA8.
+     **/
+    void CmdBindImage(
+        GlwRenderContext& render_context,
+        const uint32_t unit,
+        const glTexture texture,
+        const int32_t level,
+        const bool layered,
+        const int32_t layer,
+        const GlwAccessModes access,
+        const uint32_t format
+    );
+
+    /**
+     * CmdDrawQueue method
+     * @note : Sort render queue then record its draws, render pass, material
+     *         and mesh are only used when they differ from previous draw.
+     * @param render_context : Reference to current render context.
+     * @param render_queue : Reference to render queue.
+     **/
+    void CmdDrawQueue( GlwRenderContext& render_context, GlwRenderQueue& render_queue );
+
     /**
      * CmdDraw method
      * @note : Draw call.
@@ -503,9 +1004,223 @@ public:
      **/
     void CmdDraw( GlwRenderContext& render_context, const uint32_t vertice_count );
 
+    /**
+     * CmdDrawInstanced method
+     * @note : Instanced draw call of the whole mesh.
+     * @param render_context : Reference to current render context.
+     * @param vertice_count : Query vertex count.
+     * @param instance_count : Query instance count.
+     **/
+    void CmdDrawInstanced( 
+        GlwRenderContext& render_context, 
+        const uint32_t vertice_count,
+        const uint32_t instance_count
+    );
+
+    /**
+     * CmdDrawGeometry method
+     * @note : Draw a mesh of current geometry pool with its base vertex,
+     *         geometry ranges are read at replay so Defragment or a growing
+     *         Allocate before Present keep recorded draws valid. Geometry
+     *         handles must not be released and reused before Present.
+     * @param render_context : Reference to current render context.
+     * @param geometry : Query geometry handle in current geometry pool.
+     **/
+    void CmdDrawGeometry( GlwRenderContext& render_context, const uint32_t geometry );
+
+    /**
+     * CmdDrawStreamGeometry method
+     * @note : Draw vertices of current stream geometry without index.
+     * @param render_context : Reference to current render context.
+     * @param vertice_count : Query vertex count.
+     * @param vertex_offset : Query vertex allocation offset, multiple of the vertex stride.
+     **/
+    void CmdDrawStreamGeometry( 
+        GlwRenderContext& render_context, 
+        const uint32_t vertice_count,
+        const uint32_t vertex_offset
+    );
+
+    /**
+     * CmdDrawStreamGeometry method
+     * @note : Draw allocations of current stream geometry, offsets returned
+     *         by GlwStreamBuffer::PushElements become first index and base
+     *         vertex so the buffers are never rebound between draws.
+     * @param render_context : Reference to current render context.
+     * @param vertice_count : Query index count, or vertex count without index stream.
+     * @param index_offset : Query index allocation offset, ignored without index stream.
+     * @param vertex_offset : Query vertex allocation offset, multiple of the vertex stride.
+     **/
+    void CmdDrawStreamGeometry( 
+        GlwRenderContext& render_context, 
+        const uint32_t vertice_count,
+        const uint32_t index_offset,
+        const uint32_t vertex_offset
+    );
+
+    /**
+     * CmdDrawLod method
+     * @note : Draw level of detail of current mesh whose error stay under
+     *         one pixel.
+     * @param render_context : Reference to current render context.
+     * @param screen_size : Query projected mesh diameter in pixels, see
+     *                      GlwMeshLod::GetScreenSize.
+     **/
+    void CmdDrawLod( GlwRenderContext& render_context, const float screen_size );
+
+    /**
+     * CmdDrawLod method
+     * @note : Draw coarsest level of detail of current mesh whose error
+     *         projected on screen stay under query pixel error.
+     * @param render_context : Reference to current render context.
+     * @param screen_size : Query projected mesh diameter in pixels.
+     * @param pixel_error : Query allowed error in pixels.
+     **/
+    void CmdDrawLod( 
+        GlwRenderContext& render_context, 
+        const float screen_size, 
+        const float pixel_error 
+    );
+
+    /**
+     * CmdDrawInstanced method
+     * @note : Instanced draw call, per instance attributes read instance
+     *         data from base instance.
+     * @param render_context : Reference to current render context.
+     * @param vertice_count : Query vertex count.
+     * @param instance_count : Query instance count.
+     * @param first_vertice : Query first index, or first vertex without index buffer.
+     * @param base_vertex : Query value added to each index.
+     * @param base_instance : Query first instance.
+     **/
+    void CmdDrawInstanced( 
+        GlwRenderContext& render_context, 
+        const uint32_t vertice_count,
+        const uint32_t instance_count,
+        const uint32_t first_vertice,
+        const int32_t base_vertex,
+        const uint32_t base_instance
+    );
+
+    /**
+     * CmdMultiDrawElementsIndirect method
+     * @note : Indexed draws of current mesh sourced from an indirect buffer
+     *         of tightly packed GlwDrawIndirectCommand, one GL call for all.
+     * @param render_context : Reference to current render context.
+     * @param indirect : Query indirect buffer.
+     * @param draw_count : Query draw count.
+     **/
+    void CmdMultiDrawElementsIndirect(
+        GlwRenderContext& render_context,
+        const GlwBuffer& indirect,
+        const uint32_t draw_count
+    );
+
+    /**
+     * CmdMultiDrawElementsIndirect method
+     * @note : Indexed draws of current mesh sourced from an indirect buffer.
+     * @param render_context : Reference to current render context.
+     * @param indirect : Query indirect buffer.
+     * @param offset : Query byte offset of the first command.
+     * @param draw_count : Query draw count.
+     * @param stride : Query byte distance between commands, 0 for tightly packed.
+     **/
+    void CmdMultiDrawElementsIndirect(
+        GlwRenderContext& render_context,
+        const GlwBuffer& indirect,
+        const uint32_t offset,
+        const uint32_t draw_count,
+        const uint32_t stride
+    );
+
+    /**
+     * CmdMultiDrawElementsIndirectCount method
+     * @note : Like CmdMultiDrawElementsIndirect but draw count is read on the
+     *         GPU from the first uint32_t of parameter buffer, it let a compute
+     *         pass fill both buffers without CPU read back. Require OpenGL 4.6
+     *         or ARB_indirect_parameters, see GetSupportsIndirectCount, the
+     *         call is rejected otherwise.
+     * @param render_context : Reference to current render context.
+     * @param indirect : Query indirect buffer.
+     * @param parameter : Query parameter buffer.
+     * @param max_draw_count : Query upper bound of draw count.
+     **/
+    void CmdMultiDrawElementsIndirectCount(
+        GlwRenderContext& render_context,
+        const GlwBuffer& indirect,
+        const GlwBuffer& parameter,
+        const uint32_t max_draw_count
+    );
+
+    /**
+     * CmdMultiDrawElementsIndirectCount method
+     * @note : Like CmdMultiDrawElementsIndirect but draw count is read on the
+     *         GPU from parameter buffer.
+     * @param render_context : Reference to current render context.
+     * @param indirect : Query indirect buffer.
+     * @param offset : Query byte offset of the first command.
+     * @param parameter : Query parameter buffer.
+     * @param parameter_offset : Query byte offset of draw count, multiple of 4.
+     * @param max_draw_count : Query upper bound of draw count.
+     * @param stride : Query byte distance between commands, 0 for tightly packed.
+     **/
+    void CmdMultiDrawElementsIndirectCount(
+        GlwRenderContext& render_context,
+        const GlwBuffer& indirect,
+        const uint32_t offset,
+        const GlwBuffer& parameter,
+        const uint32_t parameter_offset,
+        const uint32_t max_draw_count,
+        const uint32_t stride
+    );
+
+    /**
+     * CmdDispatch method
+     * @note : Dispatch work groups of current compute material, required
+     *         memory barriers are issued before the dispatch.
+     * @param render_context : Reference to current render context.
+     * @param group_count : Query work group count on each axis.
+     **/
+    void CmdDispatch( GlwRenderContext& render_context, const glm::uvec3& group_count );
+
+    /**
+     * CmdDispatchIndirect method
+     * @note : Dispatch work groups of current compute material, group count
+     *         is read on the GPU from a GlwDispatchIndirectCommand.
+     * @param render_context : Reference to current render context.
+     * @param indirect : Query indirect buffer.
+     **/
+    void CmdDispatchIndirect( GlwRenderContext& render_context, const GlwBuffer& indirect );
+
+    /**
+     * CmdDispatchIndirect method
+     * @note : Dispatch work groups of current compute material, group count
+     *         is read on the GPU from indirect buffer.
+     * @param render_context : Reference to current render context.
+     * @param indirect : Query indirect buffer.
+     * @param offset : Query byte offset of the command, multiple of 4.
+     **/
+    void CmdDispatchIndirect( 
+        GlwRenderContext& render_context, 
+        const GlwBuffer& indirect,
+        const uint32_t offset
+    );
+
+    /**
+     * CmdMemoryBarrier method
+     * @note : Issue memory barrier explicitly, for shader writes the barrier
+     *         tracker can't see like atomic counters or client mapped buffers.
+     * @param render_context : Reference to current render context.
+     * @param barriers : Query GL_*_BARRIER_BIT mask.
+     **/
+    void CmdMemoryBarrier( GlwRenderContext& render_context, const uint32_t barriers );
+
     /**
      * Present method
-     * @note : Present all previous operation to screen without internal display call.
+     * @note : Merge render context with submitted command lists, replay
+     *         them by ascending key then present to screen without internal
+     *         display call. Lists with the same key keep submission order,
+     *         render context goes first.
      * @param window : Pointer to current window instance.
      * @param render_context : Reference to current render context.
      **/
@@ -567,7 +1282,67 @@ protected:
      **/
     virtual void Resize( const GlwWindow* window );
 
+    /**
+     * Submit method
+     * @note : Execute recorded commands in order on the OpenGL context. Bound
+     *         material and geometry are not inherited from a previous buffer,
+     *         draws and dispatches recorded before them are skipped.
+     * @param command_buffer : Query command buffer.
+     **/
+    void Submit( const GlwCommandBuffer& command_buffer );
+
+    /**
+     * SubmitUniform method
+     * @note : Execute recorded uniform command on current material.
+     * @param material : Query current material.
+     * @param command : Query uniform command.
+     **/
+    void SubmitUniform( GlwMaterial* material, const GlwCommandSetUniform* command );
+
 public:
+    /**
+     * CmdSetUniform template method
+     * @note : Set uniform value of current material for following draws.
+     * @template Type : Query uniform value type.
+     * @param render_context : Reference to current render context.
+     * @param location : Query material uniform location.
+     * @param value : Query uniform value.
+     **/
+    template<typename Type>
+    void CmdSetUniform( 
+        GlwRenderContext& render_context, 
+        const int32_t location, 
+        const Type& value 
+    ) {
+        if ( !render_context.GetInUse( ) || render_context.Material == UINT_MAX || location < 0 )
+            return;
+
+        render_context.Commands.RecordUniform<Type>( location, value );
+
+        GlwTrackCommand( m_debug_tracker, render_context.RenderPass, "CmdSetUniform", location );
+    };
+
+    /**
+     * CmdSetUniform template method
+     * @note : Set uniform value of current material for following draws,
+     *         location is read from the material link time table.
+     * @template Type : Query uniform value type.
+     * @param render_context : Reference to current render context.
+     * @param hash : Query material uniform name hash.
+     * @param value : Query uniform value.
+     **/
+    template<typename Type>
+    void CmdSetUniform( 
+        GlwRenderContext& render_context, 
+        const GlwUniformHash hash, 
+        const Type& value 
+    ) {
+        auto* material = GetMaterial( render_context.Material );
+        auto location  = ( material != nullptr ) ? material->GetUniformLocation( hash ) : -1;
+
+        CmdSetUniform<Type>( render_context, location, value );
+    };
+
     /**
      * CreateMesh template function
      * @note : Create mesh according to query specification.
@@ -577,7 +1352,25 @@ public:
      **/
     template<typename VertexType>
     bool CreateMesh( const GlwMeshStaticSpecification<VertexType>& specification ) { 
-        auto result = m_ressources.CreateMesh<VertexType>( specification );
+        auto mesh = glw_ressource{ };
+
+        return CreateMesh<VertexType>( specification, mesh );
+    };
+
+    /**
+     * CreateMesh template function
+     * @note : Create mesh according to query specification.
+     * @template VertexType : Type of data used for vertex representation.
+     * @param specification : Query mesh specification.
+     * @param mesh : Store created mesh handle.
+     * @return : True when creation succeeded.
+     **/
+    template<typename VertexType>
+    bool CreateMesh( 
+        const GlwMeshStaticSpecification<VertexType>& specification,
+        glw_ressource& mesh
+    ) { 
+        auto result = m_ressources.CreateMesh<VertexType>( specification, mesh );
 
         if ( result )
             GlwTrackMesh( m_debug_tracker );
@@ -598,9 +1391,29 @@ public:
         const glw_ressource mesh,
         const GlwMeshStaticSpecification<VertexType>& specification 
     ) {
+        m_state_tracker.Invalidate( );
+
         return m_ressources.ReplaceMesh<VertexType>( mesh, specification );
     };
 
+    /**
+     * CreateStreamBuffer template function
+     * @note : Create persistently mapped vertex stream buffer for vertex type
+     *         declared GlwVertexLayout, its vertex format is resolved here.
+     * @template VertexType : Type of data used for vertex representation.
+     * @param specification : Query stream buffer specification.
+     * @param stream_buffer : Store created stream buffer handle.
+     * @return : True when creation succeeded.
+     **/
+    template<typename VertexType>
+        requires GlwVertexLayoutDeclared<VertexType>
+    bool CreateStreamBuffer(
+        const GlwStreamBufferSpecification& specification,
+        glw_ressource& stream_buffer
+    ) {
+        return m_ressources.CreateStreamBuffer<VertexType>( specification, stream_buffer );
+    };
+
 public:
     /**
      * GetDebugTracker const function
@@ -609,6 +1422,22 @@ public:
      **/
     const GlwDebugTracker& GetDebugTracker( ) const;
 
+    /**
+     * GetStateTracker const function
+     * @note : Get reference to internal state tracker instance, issued and
+     *         elided counters are reset on each Acquire.
+     * @return : Return constant reference to internal state tracker instance.
+     **/
+    const GlwStateTracker& GetStateTracker( ) const;
+
+    /**
+     * GetBarrierTracker const function
+     * @note : Get reference to internal barrier tracker instance, issued
+     *         counter is reset on each Acquire.
+     * @return : Return constant reference to internal barrier tracker instance.
+     **/
+    const GlwBarrierTracker& GetBarrierTracker( ) const;
+
     /**
      * GetDrawState const function
      * @note : Get current graphic manager drawing state.
@@ -616,6 +1445,14 @@ public:
      **/
     GlwStates GetDrawState( ) const;
 
+    /**
+     * GetSupportsIndirectCount const function
+     * @note : Get if CmdMultiDrawElementsIndirectCount can be used, it require
+     *         OpenGL 4.6 or ARB_indirect_parameters.
+     * @return : True when draw count can be read from a parameter buffer.
+     **/
+    bool GetSupportsIndirectCount( ) const;
+
     /**
      * GetRessources function
      * @note : Get ressource manager instance.
@@ -658,6 +1495,34 @@ public:
      **/
     uint32_t GetMaterialCount( ) const;
 
+    /**
+     * GetPendingMaterialCount const function
+     * @note : Get count of submitted materials not ready yet.
+     * @return : Return pending material count value.
+     **/
+    uint32_t GetPendingMaterialCount( ) const;
+
+    /**
+     * GetStreamBufferCount const function
+     * @note : Get stream buffer count.
+     * @return : Return stream buffer count value.
+     **/
+    uint32_t GetStreamBufferCount( ) const;
+
+    /**
+     * GetGeometryPoolCount const function
+     * @note : Get geometry pool count.
+     * @return : Return geometry pool count value.
+     **/
+    uint32_t GetGeometryPoolCount( ) const;
+
+    /**
+     * GetVertexFormatCount const function
+     * @note : Get count of vertex formats shared between meshes.
+     * @return : Return vertex format count value.
+     **/
+    uint32_t GetVertexFormatCount( ) const;
+
     /**
      * GetMeshExist const function
      * @note : Get if a mesh exist.
@@ -690,6 +1555,22 @@ public:
      **/
     bool GetMaterialExist( const glw_ressource material ) const;
 
+    /**
+     * GetStreamBufferExist const function
+     * @note : Get if a stream buffer exist.
+     * @param stream_buffer : Query stream buffer.
+     * @return : Return true when stream buffer is valid.
+     **/
+    bool GetStreamBufferExist( const glw_ressource stream_buffer ) const;
+
+    /**
+     * GetGeometryPoolExist const function
+     * @note : Get if a geometry pool exist.
+     * @param geometry_pool : Query geometry pool.
+     * @return : Return true when geometry pool is valid.
+     **/
+    bool GetGeometryPoolExist( const glw_ressource geometry_pool ) const;
+
     /**
      * GetRenderPass const function
      * @note : Get render pass instance.
@@ -735,6 +1616,14 @@ public:
      **/
     GlwTextureCubemap* GetCubemap( const glw_ressource cubemap );
 
+    /**
+     * GetProgramCache const function
+     * @note : Get program binary cache, hit, miss and time saved counters are
+     *         available from its statistics.
+     * @return : Return program cache instance.
+     **/
+    const GlwProgramCache& GetProgramCache( ) const;
+
     /**
      * GetMaterial function
      * @note : Get material instance.
@@ -743,4 +1632,20 @@ public:
      **/
     GlwMaterial* GetMaterial( const glw_ressource material );
 
+    /**
+     * GetStreamBuffer function
+     * @note : Get stream buffer instance.
+     * @param stream_buffer : Query stream buffer.
+     * @return : Return pointer to query stream buffer instance.
+     **/
+    GlwStreamBuffer* GetStreamBuffer( const glw_ressource stream_buffer );
+
+    /**
+     * GetGeometryPool function
+     * @note : Get geometry pool instance.
+     * @param geometry_pool : Query geometry pool.
+     * @return : Return pointer to query geometry pool instance.
+     **/
+    GlwGeometryPool* GetGeometryPool( const glw_ressource geometry_pool );
+
 };
@@ -38,9 +38,27 @@ GlwRenderContext::GlwRenderContext( )
     : RenderPass{ UINT_MAX },
     Material{ UINT_MAX },
     Mesh{ UINT_MAX },
-    UseIndex{ false }
+    GeometryPool{ UINT_MAX },
+    StreamGeometry{ UINT_MAX },
+    StreamStride{ 0 },
+    UseIndex{ false },
+    Key{ 0 },
+    Commands{ }
 { }
 
+void GlwRenderContext::Reset( ) {
+    RenderPass     = UINT_MAX;
+    Material       = UINT_MAX;
+    Mesh           = UINT_MAX;
+    GeometryPool   = UINT_MAX;
+    StreamGeometry = UINT_MAX;
+    StreamStride   = 0;
+    UseIndex       = false;
+    Key            = 0;
+
+    Commands.Reset( );
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //      === PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,7 +67,7 @@ bool GlwRenderContext::GetInUse( ) const {
 }
 
 bool GlwRenderContext::GetCanDraw( ) const {
-    return GetInUse( ) && Material < UINT_MAX && Mesh < UINT_MAX;
+    return GetInUse( ) && Material < UINT_MAX && ( Mesh < UINT_MAX || GeometryPool < UINT_MAX || StreamGeometry < UINT_MAX );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
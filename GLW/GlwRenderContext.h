@@ -31,20 +31,32 @@
 
 #pragma once
 
-#include "Display/GlwSwapchain.h"
+#include "Culling/GlwOcclusionBuffer.h"
 
 struct GlwRenderContext {
 
     uint32_t RenderPass;
     uint32_t Material;
     uint32_t Mesh;
+    uint32_t GeometryPool;
+    uint32_t StreamGeometry;
+    uint32_t StreamStride;
     bool UseIndex;
+    uint64_t Key;
+    GlwCommandBuffer Commands;
 
     /**
      * Constructor
      **/
     GlwRenderContext( );
 
+    /**
+     * Reset method
+     * @note : Reset render context for a new frame, recorded commands are
+     *         dropped but their memory is kept.
+     **/
+    void Reset( );
+
     /**
      * GetInUse const function
      * @note : Get if the current render context is in use.
@@ -55,7 +67,8 @@ struct GlwRenderContext {
     /**
      * GetCanDraw const function
      * @note : Get if current render context can be used for drawing.
-     * @return : True when render pass, material and mesh is valid.
+     * @return : True when render pass, material and mesh, geometry pool or
+     *           stream geometry is valid.
      **/
     bool GetCanDraw( ) const;
 
@@ -42,11 +42,11 @@ void GlwColorBlend::Create( const GlwColorBlendSpecification& specification ) {
     m_specification = specification;
 }
 
-void GlwColorBlend::Use( ) {
+void GlwColorBlend::Use( GlwStateTracker& state_tracker ) {
     if ( m_specification.Enable ) {
-        glEnable( GL_BLEND );
-        glBlendFuncSeparate( m_specification.Source.RGB, m_specification.Destination.RGB, m_specification.Source.Alpha, m_specification.Destination.Alpha );
-        glBlendEquation( m_specification.Equation );
+        state_tracker.Toggle( GL_BLEND, GlwStates::Enable );
+        state_tracker.SetBlendFunction( m_specification.Source.RGB, m_specification.Destination.RGB, m_specification.Source.Alpha, m_specification.Destination.Alpha );
+        state_tracker.SetBlendEquation( m_specification.Equation );
     } else
-        glDisable( GL_BLEND );
+        state_tracker.Toggle( GL_BLEND, GlwStates::Disable );
 }
@@ -60,7 +60,8 @@ public:
     /**
      * Use method
      * @note : Bind color blending specification.
+     * @param state_tracker : Query current state tracker.
      **/
-    void Use( );
+    void Use( GlwStateTracker& state_tracker );
 
 };
@@ -64,16 +64,19 @@ void GlwRenderPass::SetRefreshColor( const glm::vec4& color ) {
     m_refresh = color;
 }
 
-void GlwRenderPass::Use( ) {
-    m_framebuffer.Use( );
+void GlwRenderPass::Use( GlwStateTracker& state_tracker ) {
+    auto bounds = glm::ivec4{ 0, 0, m_dimensions.x, m_dimensions.y };
 
-    glViewport( 0, 0, m_dimensions.x, m_dimensions.y );
-    glScissor( 0, 0, m_dimensions.x, m_dimensions.y );
+    m_framebuffer.Use( state_tracker );
+
+    state_tracker.SetViewport( bounds );
+    state_tracker.SetScissor( bounds );
     
-    m_targets.Use( );
-    m_color_blend.Use( );
+    m_targets.Use( state_tracker );
+    m_color_blend.Use( state_tracker );
+
+    state_tracker.SetClearColor( m_refresh );
 
-    glClearColor( m_refresh.r, m_refresh.g, m_refresh.b, m_refresh.a );
     glClear( m_clear_flags );
 }
 
@@ -89,6 +92,10 @@ bool GlwRenderPass::GetIsValid( ) const {
     return m_framebuffer.GetIsValid( );
 }
 
+GlwFramebuffer& GlwRenderPass::GetFramebuffer( ) {
+    return m_framebuffer;
+}
+
 glm::ivec2 GlwRenderPass::GetDimensions( ) const {
     return m_dimensions;
 }
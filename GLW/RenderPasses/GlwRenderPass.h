@@ -72,8 +72,9 @@ public:
     /**
      * Use method
      * @note : Bind current render pass for usage.
+     * @param state_tracker : Query current state tracker.
      **/
-    void Use( );
+    void Use( GlwStateTracker& state_tracker );
 
     /**
      * Destroy method
@@ -89,6 +90,13 @@ public:
      **/
     bool GetIsValid( ) const;
 
+    /**
+     * GetFramebuffer function
+     * @note : Get render pass framebuffer.
+     * @return : Return reference to render pass framebuffer.
+     **/
+    GlwFramebuffer& GetFramebuffer( );
+
     /**
      * GetDimensions const function
      * @note : Get render pass dimensions.
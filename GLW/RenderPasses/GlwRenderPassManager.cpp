@@ -57,17 +57,25 @@ void GlwRenderPassManager::CmdBlitRenderTarget(
 	if ( src_texture == GL_NULL || dst_texture == GL_NULL )
 		return;
 
-	auto src_range = GetAttachementRange( blit_specification.Source );
-	auto dst_range = GetAttachementRange( blit_specification.Destination );
+	auto& src_framebuffer = GetRenderPass( blit_specification.Source.RenderPass )->GetFramebuffer( );
+	auto& dst_framebuffer = GetRenderPass( blit_specification.Destination.RenderPass )->GetFramebuffer( );
+	auto src_range		  = GetAttachementRange( blit_specification.Source );
+	auto dst_range		  = GetAttachementRange( blit_specification.Destination );
+	auto is_color		  = blit_specification.Type == GlwRenderAttachementTypes::Color;
+
+	if ( is_color ) {
+		glNamedFramebufferReadBuffer( src_framebuffer.Get( ), GL_COLOR_ATTACHMENT0 + blit_specification.Source.Target );
+		glNamedFramebufferDrawBuffer( dst_framebuffer.Get( ), GL_COLOR_ATTACHMENT0 + blit_specification.Destination.Target );
+	}
 
 	glBlitNamedFramebuffer(
-		src_texture,
-		dst_texture,
+		src_framebuffer.Get( ),
+		dst_framebuffer.Get( ),
 
 		src_range.x,
 		src_range.y,
 		src_range.z,
-		src_range.z,
+		src_range.w,
 
 		dst_range.x,
 		dst_range.y,
@@ -77,6 +85,9 @@ void GlwRenderPassManager::CmdBlitRenderTarget(
 		(uint32_t)blit_specification.Type,
 		blit_specification.Mode 
 	);
+
+	if ( is_color )
+		dst_framebuffer.Link( GetRenderPass( blit_specification.Destination.RenderPass )->GetColorAttachementCount( ) );
 }
 
 void GlwRenderPassManager::Destroy( ) {
@@ -68,10 +68,10 @@ bool GlwColorTarget::Create(
 	return result;
 }
 
-void GlwColorTarget::Use( ) {
-	auto value = ( m_enabled ) ? GL_TRUE : GL_FALSE;
+void GlwColorTarget::Use( GlwStateTracker& state_tracker ) {
+	auto state = ( m_enabled ) ? GlwStates::Enable : GlwStates::Disable;
 
-	glColorMask( value, value, value, value );
+	state_tracker.SetColorMask( state );
 }
 
 void GlwColorTarget::Destroy( ) {
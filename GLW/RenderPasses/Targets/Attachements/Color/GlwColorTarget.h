@@ -69,8 +69,9 @@ public:
 	/**
 	 * Use method
 	 * @note : Bind color buffer for usage.
+	 * @param state_tracker : Query current state tracker.
 	 **/
-	void Use( );
+	void Use( GlwStateTracker& state_tracker );
 
 	/**
 	 * Destroy method
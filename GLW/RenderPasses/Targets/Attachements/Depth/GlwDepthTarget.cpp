@@ -62,14 +62,14 @@ bool GlwDepthTarget::Create(
     return result;
 }
 
-void GlwDepthTarget::Use( ) {
+void GlwDepthTarget::Use( GlwStateTracker& state_tracker ) {
     if ( m_enabled ) {
-        glEnable( GL_DEPTH_TEST );
-        glDepthFunc( m_parameters.Function );
-        glDepthRange( m_parameters.ClampedNear, m_parameters.ClampedFar );
-        glClearDepth( m_parameters.ClampedFar );
+        state_tracker.Toggle( GL_DEPTH_TEST, GlwStates::Enable );
+        state_tracker.SetDepthFunction( m_parameters.Function );
+        state_tracker.SetDepthRange( m_parameters.ClampedNear, m_parameters.ClampedFar );
+        state_tracker.SetClearDepth( m_parameters.ClampedFar );
     } else
-        glDisable( GL_DEPTH_TEST );
+        state_tracker.Toggle( GL_DEPTH_TEST, GlwStates::Disable );
 }
 
 void GlwDepthTarget::Destroy( ) {
@@ -49,7 +49,7 @@ bool GlwRenderAttachement::Create(
 	auto result			  = false;
 
 	if ( specification.Accessibility == GlwRenderTargetAccessibility::None ) {
-		if ( result = m_render_buffer.Create( specification.Samples, attachement_type, dimensions ) )
+		if ( result = m_render_buffer.Create( specification.Samples, (uint32_t)specification.Layout, dimensions ) )
 			framebuffer.AttachRenderbuffer( attachement_type, m_render_buffer );
 	} else {
 		if ( result = m_texture.Create( { specification, dimensions } ) )
@@ -84,8 +84,9 @@ const uint32_t GlwRenderAttachement::GetAttachementType(
 	auto result = GL_COLOR_ATTACHMENT0;
 
 	switch ( format ) {
-		case GlwTextureFormats::Depth	: result = GL_DEPTH_ATTACHMENT;   break;
-		case GlwTextureFormats::Stencil : result = GL_STENCIL_ATTACHMENT; break;
+		case GlwTextureFormats::Depth		  : result = GL_DEPTH_ATTACHMENT;		  break;
+		case GlwTextureFormats::Stencil		  : result = GL_STENCIL_ATTACHMENT;		  break;
+		case GlwTextureFormats::Depth_Stencil : result = GL_DEPTH_STENCIL_ATTACHMENT; break;
 
 		default : break;
 	}
@@ -52,25 +52,24 @@ void GlwRenderAttachementTexture::CreateTexture(
     glCreateTextures( target, 1, &m_texture );
 
     if ( glIsValid( m_texture ) ) {
-        glBindTexture( target, m_texture );
-
         if ( specification.Samples == GlwTextureSamples::None )
-            glTexImage2D( GL_TEXTURE_2D, specification.Levels, (uint32_t)specification.Layout, specification.Width, specification.Height, 0, (uint32_t)specification.Format, GL_UNSIGNED_BYTE, NULL );
+            glTextureStorage2D( m_texture, 1, (uint32_t)specification.Layout, specification.Width, specification.Height );
         else
-            glTexImage2DMultisample( GL_TEXTURE_2D_MULTISAMPLE, (uint32_t)specification.Samples, (uint32_t)specification.Layout, specification.Width, specification.Height, GL_TRUE );
+            glTextureStorage2DMultisample( m_texture, (uint32_t)specification.Samples, (uint32_t)specification.Layout, specification.Width, specification.Height, GL_TRUE );
     }
 }
 
 void GlwRenderAttachementTexture::SetTextureParameters(
     const GlwAttachementSpecification& specification
 ) {
-    auto target = GetTarget( );
+    if ( m_type == GlwTextureTypes::Texture2D_MultiSamples )
+        return;
 
-    glTexParameteri( target, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
-    glTexParameteri( target, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
-    glTexParameteri( target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE );
-    glTexParameteri( target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
-    glTexParameteri( target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+    glTextureParameteri( m_texture, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+    glTextureParameteri( m_texture, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
 }
 
 void GlwRenderAttachementTexture::FillTexture( const GlwTextureFillSpecification& specification ) {
@@ -68,17 +68,17 @@ void GlwStencilTarget::Setup(
     clear_flags |= GL_STENCIL_BUFFER_BIT;
 }
 
-void GlwStencilTarget::Use( ) {
+void GlwStencilTarget::Use( GlwStateTracker& state_tracker ) {
     if ( m_enabled ) {
-        glEnable( GL_STENCIL_TEST );
-        glStencilFuncSeparate( GL_FRONT, m_parameters.FrontFunction.Function, m_parameters.FrontFunction.Reference, m_parameters.FrontFunction.Mask );
-        glStencilOpSeparate( GL_FRONT, m_parameters.FrontOperation.Fail, m_parameters.FrontOperation.Pass, m_parameters.FrontOperation.DepthStencilPass );
-        glStencilFuncSeparate( GL_BACK, m_parameters.BackFunction.Function, m_parameters.BackFunction.Reference, m_parameters.BackFunction.Mask );
-        glStencilOpSeparate( GL_BACK, m_parameters.BackOperation.Fail, m_parameters.BackOperation.Pass, m_parameters.BackOperation.DepthStencilPass );
-        glClearStencil( 0 );
+        state_tracker.Toggle( GL_STENCIL_TEST, GlwStates::Enable );
+        state_tracker.SetStencilFunction( GL_FRONT, m_parameters.FrontFunction.Function, m_parameters.FrontFunction.Reference, m_parameters.FrontFunction.Mask );
+        state_tracker.SetStencilOperation( GL_FRONT, m_parameters.FrontOperation.Fail, m_parameters.FrontOperation.Pass, m_parameters.FrontOperation.DepthStencilPass );
+        state_tracker.SetStencilFunction( GL_BACK, m_parameters.BackFunction.Function, m_parameters.BackFunction.Reference, m_parameters.BackFunction.Mask );
+        state_tracker.SetStencilOperation( GL_BACK, m_parameters.BackOperation.Fail, m_parameters.BackOperation.Pass, m_parameters.BackOperation.DepthStencilPass );
+        state_tracker.SetClearStencil( 0 );
     } else {
-        glDisable( GL_STENCIL_TEST );
-        glStencilMask( 0x00 );
+        state_tracker.Toggle( GL_STENCIL_TEST, GlwStates::Disable );
+        state_tracker.SetStencilMask( 0x00 );
     }
 }
 
@@ -81,8 +81,9 @@ public:
     /**
      * Use method
      * @note : Bind stencil buffer for usage.
+     * @param state_tracker : Query current state tracker.
      **/
-    void Use( );
+    void Use( GlwStateTracker& state_tracker );
 
     /**
      * Destroy method
@@ -39,22 +39,17 @@ GlwFramebuffer::GlwFramebuffer( )
 { }
 
 bool GlwFramebuffer::Create( ) {
-	glGenFramebuffers( 1, &m_framebuffer );
+	glCreateFramebuffers( 1, &m_framebuffer );
 
-	auto result = glIsValid( m_framebuffer );
-
-	if ( result )
-		glBindFramebuffer( GL_FRAMEBUFFER, m_framebuffer );
-
-	return result;
+	return glIsValid( m_framebuffer );
 }
 
 void GlwFramebuffer::AttachTexture( const uint32_t type, const glTexture attachment ) {
-	glFramebufferTexture2D( GL_FRAMEBUFFER, type, GL_TEXTURE_2D, attachment, 0 );
+	glNamedFramebufferTexture( m_framebuffer, type, attachment, 0 );
 }
 
 void GlwFramebuffer::AttachRenderbuffer( const uint32_t type, const uint32_t attachment ) {
-	glFramebufferRenderbuffer( GL_FRAMEBUFFER, type, GL_RENDERBUFFER, attachment );
+	glNamedFramebufferRenderbuffer( m_framebuffer, type, GL_RENDERBUFFER, attachment );
 }
 
 void GlwFramebuffer::Link( const uint32_t color_count ) {
@@ -68,11 +63,11 @@ void GlwFramebuffer::Link( const uint32_t color_count ) {
 	while ( color_id-- > 0 )
 		attachments[ color_id ] = GL_COLOR_ATTACHMENT0 + color_id;
 
-	glDrawBuffers( color_count, attachment_list );
+	glNamedFramebufferDrawBuffers( m_framebuffer, color_count, attachment_list );
 }
 
-void GlwFramebuffer::Use( ) {
-	glBindFramebuffer( GL_FRAMEBUFFER, m_framebuffer );
+void GlwFramebuffer::Use( GlwStateTracker& state_tracker ) {
+	state_tracker.UseFramebuffer( m_framebuffer );
 }
 
 void GlwFramebuffer::Destroy( ) {
@@ -86,3 +81,7 @@ void GlwFramebuffer::Destroy( ) {
 bool GlwFramebuffer::GetIsValid( ) const {
 	return glIsValid( m_framebuffer );
 }
+
+const glFramebuffer GlwFramebuffer::Get( ) const {
+	return m_framebuffer;
+}
@@ -85,8 +85,9 @@ public:
 	/**
 	 * Use method
 	 * @note : Bind framebuffer for usage.
+	 * @param state_tracker : Query current state tracker.
 	 **/
-	void Use( );
+	void Use( GlwStateTracker& state_tracker );
 
 	/**
 	 * Destroy method
@@ -102,4 +103,11 @@ public:
 	 **/
 	bool GetIsValid( ) const;
 
+	/**
+	 * Get const function
+	 * @note : Get OpenGL framebuffer handle.
+	 * @return : Return OpenGL framebuffer handle value.
+	 **/
+	const glFramebuffer Get( ) const;
+
 };
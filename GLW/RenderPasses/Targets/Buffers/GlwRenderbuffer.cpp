@@ -43,17 +43,15 @@ bool GlwRenderbuffer::Create(
 	const uint32_t type,
 	const glm::uvec2& dimensions
 ) {
-	glGenRenderbuffers( 1, &m_render_buffer );
+	glCreateRenderbuffers( 1, &m_render_buffer );
 
 	auto result = GetIsValid( );
 
 	if ( result ) {
-		glBindRenderbuffer( GL_RENDERBUFFER, m_render_buffer );
-
 		if ( samples == GlwTextureSamples::None )
-			glRenderbufferStorage( GL_RENDERBUFFER, type, dimensions.x, dimensions.y );
+			glNamedRenderbufferStorage( m_render_buffer, type, dimensions.x, dimensions.y );
 		else
-			glRenderbufferStorageMultisample( GL_RENDERBUFFER, (uint32_t)samples, type, dimensions.x, dimensions.y );
+			glNamedRenderbufferStorageMultisample( m_render_buffer, (uint32_t)samples, type, dimensions.x, dimensions.y );
 	}
 
 	return result;
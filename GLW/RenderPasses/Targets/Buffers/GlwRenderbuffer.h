@@ -53,7 +53,7 @@ public:
 	 * Create function
 	 * @note : Create render buffer according to specification.
 	 * @param samples : Query render buffer samples value.
-	 * @param type : Query render buffer OpenGL type.
+	 * @param type : Query render buffer OpenGL internal format.
 	 * @param dimensions : Query render buffer dimensions.
 	 * @return : Return true when operation succeeded.
 	 **/
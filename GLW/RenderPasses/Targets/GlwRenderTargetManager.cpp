@@ -50,10 +50,10 @@ bool GlwRenderTargetManager::Create(
             CreateDepthStencil( specification, dimensions, framebuffer, clear_flags );
 }
 
-void GlwRenderTargetManager::Use( ) {
-    m_colors.Use( );
-    m_depth.Use( );
-    m_stencil.Use( );
+void GlwRenderTargetManager::Use( GlwStateTracker& state_tracker ) {
+    m_colors.Use( state_tracker );
+    m_depth.Use( state_tracker );
+    m_stencil.Use( state_tracker );
 }
 
 void GlwRenderTargetManager::Destroy( ) {
@@ -70,8 +70,9 @@ public:
     /**
      * Use method
      * @note : Bind render pass targets for usage.
+     * @param state_tracker : Query current state tracker.
      **/
-	void Use( );
+	void Use( GlwStateTracker& state_tracker );
     
     /**
      * Destroy method
@@ -37,19 +37,21 @@
 GlwBuffer::GlwBuffer( )
 	: m_type{ 0 },
 	m_mode{ 0 },
+	m_update{ GlwBufferUpdates::Sub_Data },
+	m_size{ 0 },
 	m_handle{ GL_NULL }
 { }
 
 bool GlwBuffer::Create( const GlwBufferSpecification& specification ) {
-	glGenBuffers( 1, &m_handle );
+	glCreateBuffers( 1, &m_handle );
 
 	auto result = GetIsValid( );
 
 	if ( result ) {
-		m_type = (GLuint)specification.Type;
-		m_mode = (GLuint)specification.Mode;
-
-		glBindBuffer( m_type, m_handle );
+		m_type   = (GLuint)specification.Type;
+		m_mode   = (GLuint)specification.Mode;
+		m_update = specification.Update;
+		m_size   = 0;
 	}
 
 	return result;
@@ -59,14 +61,88 @@ bool GlwBuffer::Fill( const uint32_t length, const void* data ) {
 	auto result = GetIsValid( ) && length > 0;
 
 	if ( result ) {
-		glBindBuffer( m_type, m_handle );
-		glBufferData( m_type, length, data, m_mode );
-		glBindBuffer( m_type, GL_NULL );
+		glNamedBufferData( m_handle, length, data, m_mode );
+
+		m_size = length;
+	}
+
+	return result;
+}
+
+bool GlwBuffer::Update( const uint32_t offset, const uint32_t length, const void* data ) {
+	auto result = GetIsValid( ) && data != nullptr && length > 0 && offset <= m_size && length <= m_size - offset;
+
+	if ( !result )
+		return false;
+
+	switch ( m_update ) {
+		case GlwBufferUpdates::Orphan : 
+			if ( offset == 0 && length == m_size )
+				glNamedBufferData( m_handle, m_size, data, m_mode );
+			else
+				glNamedBufferSubData( m_handle, offset, length, data );
+			break;
+
+		case GlwBufferUpdates::Map_Range :
+		case GlwBufferUpdates::Map_Unsynchronized : {
+			auto* memory = Map( offset, length );
+
+			if ( result = memory != nullptr ) {
+				memcpy( memory, data, length );
+
+				result = Unmap( );
+			}
+			break;
+		}
+
+		default : glNamedBufferSubData( m_handle, offset, length, data ); break;
 	}
 
 	return result;
 }
 
+bool GlwBuffer::Orphan( ) {
+	auto result = GetIsValid( ) && m_size > 0;
+
+	if ( result )
+		glNamedBufferData( m_handle, m_size, NULL, m_mode );
+
+	return result;
+}
+
+void* GlwBuffer::Map( const uint32_t offset, const uint32_t length ) {
+	if ( !GetIsValid( ) || length == 0 || offset > m_size || length > m_size - offset )
+		return nullptr;
+
+	auto access = (GLbitfield)( GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT );
+
+	if ( m_update == GlwBufferUpdates::Map_Unsynchronized )
+		access |= GL_MAP_UNSYNCHRONIZED_BIT;
+
+	return glMapNamedBufferRange( m_handle, offset, length, access );
+}
+
+bool GlwBuffer::Unmap( ) {
+	return GetIsValid( ) && glUnmapNamedBuffer( m_handle ) == GL_TRUE;
+}
+
+bool GlwBuffer::Copy(
+	const GlwBuffer& source,
+	const uint32_t read_offset,
+	const uint32_t write_offset,
+	const uint32_t length
+) {
+	auto result = GetIsValid( ) && source.GetIsValid( ) && length > 0;
+
+	result = result && read_offset <= source.GetSize( ) && length <= source.GetSize( ) - read_offset;
+	result = result && write_offset <= m_size && length <= m_size - write_offset;
+
+	if ( result )
+		glCopyNamedBufferSubData( source.Get( ), m_handle, read_offset, write_offset, length );
+
+	return result;
+}
+
 void GlwBuffer::Destroy( ) {
 	if ( GetIsValid( ) ) {
 		glDeleteBuffers( 1, &m_handle );
@@ -90,6 +166,14 @@ const GLuint GlwBuffer::GetMode( ) const {
 	return m_mode;
 }
 
+const GlwBufferUpdates GlwBuffer::GetUpdate( ) const {
+	return m_update;
+}
+
+uint32_t GlwBuffer::GetSize( ) const {
+	return m_size;
+}
+
 const glBuffer GlwBuffer::Get( ) const {
 	return m_handle;
 }
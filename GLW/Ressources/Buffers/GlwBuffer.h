@@ -38,6 +38,8 @@ class GlwBuffer : public GlwRessource<GlwBufferSpecification> {
 protected:
 	GLuint m_type;
 	GLuint m_mode;
+	GlwBufferUpdates m_update;
+	uint32_t m_size;
 	glBuffer m_handle;
 
 public:
@@ -68,6 +70,58 @@ public:
 	 **/
 	bool Fill( const uint32_t length, const void* data );
 
+	/**
+	 * Update function
+	 * @note : Update a range of the buffer without re-specifying its storage,
+	 *		   using the update strategy of the buffer specification.
+	 * @param offset : Offset of the range in bytes.
+	 * @param length : Length of the range in bytes.
+	 * @param data : Pointer to range data.
+	 * @return : True when operation succeeded.
+	 **/
+	bool Update( const uint32_t offset, const uint32_t length, const void* data );
+
+	/**
+	 * Orphan function
+	 * @note : Detach current storage from the buffer and allocate a new one of
+	 *		   the same size, previous content become undefined.
+	 * @return : True when operation succeeded.
+	 **/
+	bool Orphan( );
+
+	/**
+	 * Map function
+	 * @note : Map a range of the buffer for writing, range content is invalidated.
+	 * @param offset : Offset of the range in bytes.
+	 * @param length : Length of the range in bytes.
+	 * @return : Return pointer to mapped range or nullptr on failure.
+	 **/
+	void* Map( const uint32_t offset, const uint32_t length );
+
+	/**
+	 * Unmap function
+	 * @note : Unmap previously mapped range.
+	 * @return : True when buffer content is valid.
+	 **/
+	bool Unmap( );
+
+	/**
+	 * Copy function
+	 * @note : Copy a range of source buffer into current buffer on the GPU,
+	 *		   ranges must not overlap when source is current buffer.
+	 * @param source : Query source buffer.
+	 * @param read_offset : Offset of the range in source buffer in bytes.
+	 * @param write_offset : Offset of the range in current buffer in bytes.
+	 * @param length : Length of the range in bytes.
+	 * @return : True when operation succeeded.
+	 **/
+	bool Copy(
+		const GlwBuffer& source,
+		const uint32_t read_offset,
+		const uint32_t write_offset,
+		const uint32_t length
+	);
+
 	/**
 	 * Destroy method
 	 * @note : Destroy buffer.
@@ -104,6 +158,37 @@ public:
 		return Fill( length, data );
 	};
 
+	/**
+	 * Update template function
+	 * @note : Update a range of the buffer.
+	 * @template Type : Type of data used by the buffer.
+	 * @param offset : Offset of the range in bytes.
+	 * @param buffer_data : Range data.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename Type>
+	bool Update( const uint32_t offset, const Type& buffer_data ) {
+		auto length = (uint32_t)sizeof( Type );
+
+		return Update( offset, length, &buffer_data );
+	};
+
+	/**
+	 * Update template function
+	 * @note : Update a range of the buffer.
+	 * @template Type : Type of data used by the buffer.
+	 * @param offset : Offset of the range in bytes.
+	 * @param buffer_data : Range data list.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename Type>
+	bool Update( const uint32_t offset, const std::vector<Type>& buffer_data ) {
+		auto* data  = (void*)buffer_data.data( );
+		auto length = (uint32_t)( buffer_data.size( ) * sizeof( Type ) );
+
+		return Update( offset, length, data );
+	};
+
 public:
 	/**
 	 * GetIsValid const function
@@ -126,6 +211,20 @@ public:
 	 **/
 	const GLuint GetMode( ) const;
 
+	/**
+	 * GetUpdate const function
+	 * @note : Get buffer range update strategy.
+	 * @return : Return buffer update strategy value.
+	 **/
+	const GlwBufferUpdates GetUpdate( ) const;
+
+	/**
+	 * GetSize const function
+	 * @note : Get buffer storage size.
+	 * @return : Return buffer storage size in bytes.
+	 **/
+	uint32_t GetSize( ) const;
+
 	/**
 	 * Get const function
 	 * @note : Get OpenGL buffer handle.
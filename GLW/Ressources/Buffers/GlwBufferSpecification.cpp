@@ -41,7 +41,16 @@ GlwBufferSpecification::GlwBufferSpecification( )
 GlwBufferSpecification::GlwBufferSpecification( 
 	const GlwBufferTypes type, 
 	const GlwBufferModes mode
+)
+	: GlwBufferSpecification{ type, mode, GlwBufferUpdates::Sub_Data }
+{ }
+
+GlwBufferSpecification::GlwBufferSpecification( 
+	const GlwBufferTypes type, 
+	const GlwBufferModes mode,
+	const GlwBufferUpdates update
 )
 	: Type{ type },
-	Mode{ mode }
+	Mode{ mode },
+	Update{ update }
 { }
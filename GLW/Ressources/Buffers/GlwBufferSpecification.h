@@ -31,12 +31,13 @@
 
 #pragma once
 
-#include "GlwBufferModes.h"
+#include "GlwDispatchIndirectCommand.h"
 
 struct GlwBufferSpecification { 
 
 	GlwBufferTypes Type;
 	GlwBufferModes Mode;
+	GlwBufferUpdates Update;
 
 	/**
 	 * Constructor
@@ -53,4 +54,16 @@ struct GlwBufferSpecification {
 		const GlwBufferModes mode 
 	);
 
+	/**
+	 * Constructor
+	 * @param type : Type of the buffer.
+	 * @param mode : Buffer access mode.
+	 * @param update : Buffer range update strategy.
+	 **/
+	GlwBufferSpecification( 
+		const GlwBufferTypes type, 
+		const GlwBufferModes mode,
+		const GlwBufferUpdates update
+	);
+
 };
@@ -35,8 +35,12 @@
 
 enum class GlwBufferTypes : uint32_t {
 
-	Vertex  = GL_ARRAY_BUFFER,
-	Index   = GL_ELEMENT_ARRAY_BUFFER,
-	Uniform = GL_UNIFORM_BUFFER
+	Vertex    = GL_ARRAY_BUFFER,
+	Index     = GL_ELEMENT_ARRAY_BUFFER,
+	Uniform   = GL_UNIFORM_BUFFER,
+	Indirect  = GL_DRAW_INDIRECT_BUFFER,
+	Parameter = GL_PARAMETER_BUFFER,
+	Storage   = GL_SHADER_STORAGE_BUFFER,
+	Dispatch  = GL_DISPATCH_INDIRECT_BUFFER
 
 };
@@ -0,0 +1,64 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwDrawIndirectCommand.h"
+
+/**
+ * GlwDispatchIndirectCommand struct
+ * @note : Layout of one dispatch stored in an indirect buffer, it match
+ *		   DispatchIndirectCommand so a compute pass can write it as is.
+ **/
+struct GlwDispatchIndirectCommand {
+
+	uint32_t GroupCountX;
+	uint32_t GroupCountY;
+	uint32_t GroupCountZ;
+
+	/**
+	 * Constructor
+	 **/
+	GlwDispatchIndirectCommand( );
+
+	/**
+	 * Constructor
+	 * @param group_count_x : Query work group count on X axis.
+	 * @param group_count_y : Query work group count on Y axis.
+	 * @param group_count_z : Query work group count on Z axis.
+	 **/
+	GlwDispatchIndirectCommand(
+		const uint32_t group_count_x,
+		const uint32_t group_count_y,
+		const uint32_t group_count_z
+	);
+
+};
@@ -0,0 +1,70 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwBufferUpdates.h"
+
+/**
+ * GlwDrawIndirectCommand struct
+ * @note : Layout of one indexed draw stored in an indirect buffer, it match
+ *		   DrawElementsIndirectCommand so a list can be uploaded as is.
+ **/
+struct GlwDrawIndirectCommand {
+
+	uint32_t VerticeCount;
+	uint32_t InstanceCount;
+	uint32_t FirstIndex;
+	int32_t BaseVertex;
+	uint32_t BaseInstance;
+
+	/**
+	 * Constructor
+	 **/
+	GlwDrawIndirectCommand( );
+
+	/**
+	 * Constructor
+	 * @param vertice_count : Query index count.
+	 * @param instance_count : Query instance count.
+	 * @param first_index : Query first index.
+	 * @param base_vertex : Query value added to each index.
+	 * @param base_instance : Query first instance.
+	 **/
+	GlwDrawIndirectCommand(
+		const uint32_t vertice_count,
+		const uint32_t instance_count,
+		const uint32_t first_index,
+		const int32_t base_vertex,
+		const uint32_t base_instance
+	);
+
+};
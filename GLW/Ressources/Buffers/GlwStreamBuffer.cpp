@@ -0,0 +1,280 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwStreamBuffer::GlwStreamBuffer( )
+	: m_type{ 0 },
+	m_handle{ GL_NULL },
+	m_data{ nullptr },
+	m_capacity{ 0 },
+	m_alignment{ 16 },
+	m_region{ 0 },
+	m_head{ 0 },
+	m_fences{ },
+	m_format{ nullptr },
+	m_stride{ 0 }
+{ }
+
+bool GlwStreamBuffer::Create( const GlwStreamBufferSpecification& specification ) {
+	if ( specification.Capacity == 0 || specification.RegionCount == 0 )
+		return false;
+
+	m_type		= (GLuint)specification.Type;
+	m_alignment = 16;
+
+	if ( specification.Type == GlwBufferTypes::Uniform || specification.Type == GlwBufferTypes::Storage ) {
+		auto alignment = (GLint)0;
+		auto query     = ( specification.Type == GlwBufferTypes::Uniform ) ? GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT : GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT;
+
+		glGetIntegerv( query, &alignment );
+
+		if ( alignment > (GLint)m_alignment )
+			m_alignment = (uint32_t)alignment;
+	}
+
+	m_capacity = ( specification.Capacity + m_alignment - 1 ) / m_alignment * m_alignment;
+
+	auto flags  = (GLbitfield)( GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT );
+	auto length = (GLsizeiptr)m_capacity * specification.RegionCount;
+
+	glCreateBuffers( 1, &m_handle );
+
+	auto result = GetIsValid( );
+
+	if ( result ) {
+		glNamedBufferStorage( m_handle, length, NULL, flags );
+
+		m_data = (uint8_t*)glMapNamedBufferRange( m_handle, 0, length, flags );
+		result = m_data != nullptr;
+	}
+
+	if ( result ) {
+		m_fences.resize( specification.RegionCount, nullptr );
+
+		m_region = specification.RegionCount - 1;
+		m_head	 = 0;
+	} else
+		Destroy( );
+
+	return result;
+}
+
+bool GlwStreamBuffer::Acquire( ) {
+	auto result = m_data != nullptr;
+
+	if ( result ) {
+		m_region = ( m_region + 1 ) % GetRegionCount( );
+		m_head	 = 0;
+
+		Wait( m_region );
+	}
+
+	return result;
+}
+
+void* GlwStreamBuffer::Allocate( const uint32_t length, uint32_t& offset ) {
+	auto head = ( m_head + m_alignment - 1 ) / m_alignment * m_alignment;
+
+	if ( m_data == nullptr || length == 0 || head > m_capacity || length > m_capacity - head )
+		return nullptr;
+
+	m_head = head + length;
+	offset = GetRegionOffset( ) + head;
+
+	return m_data + offset;
+}
+
+void* GlwStreamBuffer::Allocate( const uint32_t length, const uint32_t stride, uint32_t& offset ) {
+	if ( stride == 0 )
+		return nullptr;
+
+	auto start = GetRegionOffset( );
+	auto head  = ( start + m_head + stride - 1 ) / stride * stride - start;
+
+	if ( m_data == nullptr || length == 0 || head > m_capacity || length > m_capacity - head )
+		return nullptr;
+
+	m_head = head + length;
+	offset = start + head;
+
+	return m_data + offset;
+}
+
+bool GlwStreamBuffer::Push( const uint32_t length, const void* data, uint32_t& offset ) {
+	auto* memory = Allocate( length, offset );
+	auto result  = memory != nullptr && data != nullptr;
+
+	if ( result )
+		memcpy( memory, data, length );
+
+	return result;
+}
+
+bool GlwStreamBuffer::Push(
+	const uint32_t length,
+	const uint32_t stride,
+	const void* data,
+	uint32_t& offset
+) {
+	auto* memory = Allocate( length, stride, offset );
+	auto result  = memory != nullptr && data != nullptr;
+
+	if ( result )
+		memcpy( memory, data, length );
+
+	return result;
+}
+
+void GlwStreamBuffer::BindRange(
+	const uint32_t binding,
+	const uint32_t offset,
+	const uint32_t length
+) {
+	if ( GetIsValid( ) && GetIsIndexed( ) )
+		glBindBufferRange( m_type, binding, m_handle, offset, length );
+}
+
+void GlwStreamBuffer::SetFormat( GlwVertexFormat* format, const uint32_t stride ) {
+	if ( GetType( ) != GlwBufferTypes::Vertex )
+		return;
+
+	m_format = format;
+	m_stride = stride;
+}
+
+void GlwStreamBuffer::Release( ) {
+	if ( m_data == nullptr )
+		return;
+
+	if ( m_fences[ m_region ] != nullptr )
+		glDeleteSync( m_fences[ m_region ] );
+
+	m_fences[ m_region ] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+}
+
+void GlwStreamBuffer::Destroy( ) {
+	for ( auto& fence : m_fences ) {
+		if ( fence != nullptr )
+			glDeleteSync( fence );
+	}
+
+	m_fences.clear( );
+
+	if ( GetIsValid( ) ) {
+		if ( m_data != nullptr )
+			glUnmapNamedBuffer( m_handle );
+
+		glDeleteBuffers( 1, &m_handle );
+
+		m_handle = GL_NULL;
+	}
+
+	m_data   = nullptr;
+	m_format = nullptr;
+	m_stride = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void GlwStreamBuffer::Wait( const uint32_t region ) {
+	auto fence = m_fences[ region ];
+
+	if ( fence == nullptr )
+		return;
+
+	auto status = glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0 );
+
+	while ( status == GL_TIMEOUT_EXPIRED )
+		status = glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000 );
+
+	glDeleteSync( fence );
+
+	m_fences[ region ] = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwStreamBuffer::GetIsValid( ) const {
+	return glIsValid( m_handle );
+}
+
+bool GlwStreamBuffer::GetIsIndexed( ) const {
+	return m_type == GL_UNIFORM_BUFFER || m_type == GL_SHADER_STORAGE_BUFFER;
+}
+
+const GlwBufferTypes GlwStreamBuffer::GetType( ) const {
+	return (GlwBufferTypes)m_type;
+}
+
+uint32_t GlwStreamBuffer::GetCapacity( ) const {
+	return m_capacity;
+}
+
+uint32_t GlwStreamBuffer::GetRegionCount( ) const {
+	return (uint32_t)m_fences.size( );
+}
+
+uint32_t GlwStreamBuffer::GetRegion( ) const {
+	return m_region;
+}
+
+uint32_t GlwStreamBuffer::GetRegionOffset( ) const {
+	return m_region * m_capacity;
+}
+
+uint32_t GlwStreamBuffer::GetUsage( ) const {
+	return m_head;
+}
+
+GlwVertexFormat* GlwStreamBuffer::GetFormat( ) const {
+	return m_format;
+}
+
+uint32_t GlwStreamBuffer::GetStride( ) const {
+	return m_stride;
+}
+
+const glBuffer GlwStreamBuffer::Get( ) const {
+	return m_handle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	OPERATOR ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwStreamBuffer::operator const glBuffer( ) const {
+	return Get( );
+}
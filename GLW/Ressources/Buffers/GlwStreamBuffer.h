@@ -0,0 +1,300 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwStreamBufferSpecification.h"
+
+class GlwVertexFormat;
+
+/**
+ * GlwStreamBuffer class
+ * @note : Persistently mapped buffer split in frame regions. Each frame writes
+ *		   in its own region with plain memcpy, a fence is placed on the region
+ *		   at present and waited before the region is written again.
+ **/
+class GlwStreamBuffer : public GlwRessource<GlwStreamBufferSpecification> {
+
+protected:
+	GLuint m_type;
+	glBuffer m_handle;
+	uint8_t* m_data;
+	uint32_t m_capacity;
+	uint32_t m_alignment;
+	uint32_t m_region;
+	uint32_t m_head;
+	std::vector<GLsync> m_fences;
+	GlwVertexFormat* m_format;
+	uint32_t m_stride;
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwStreamBuffer( );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwStreamBuffer( ) = default;
+
+	/**
+	 * Create function
+	 * @note : Create immutable storage for all regions and map it persistently.
+	 * @param specification : Query stream buffer specification.
+	 * @return : True when creation succeeded.
+	 **/
+	virtual bool Create( const GlwStreamBufferSpecification& specification ) override;
+
+	/**
+	 * Acquire function
+	 * @note : Move to next region and wait for the GPU to release it.
+	 * @return : True when region is free for writing.
+	 **/
+	bool Acquire( );
+
+	/**
+	 * Allocate function
+	 * @note : Reserve bytes in the current region.
+	 * @param length : Query length in bytes.
+	 * @param offset : Store offset of the allocation from buffer start.
+	 * @return : Return pointer to mapped memory or nullptr when region is full.
+	 **/
+	void* Allocate( const uint32_t length, uint32_t& offset );
+
+	/**
+	 * Allocate function
+	 * @note : Reserve bytes in the current region at an offset multiple of
+	 *		   stride, so vertex and index allocations can be drawn with
+	 *		   offset / stride as base vertex or first index.
+	 * @param length : Query length in bytes.
+	 * @param stride : Query element size in bytes.
+	 * @param offset : Store offset of the allocation from buffer start.
+	 * @return : Return pointer to mapped memory or nullptr when region is full.
+	 **/
+	void* Allocate( const uint32_t length, const uint32_t stride, uint32_t& offset );
+
+	/**
+	 * Push function
+	 * @note : Copy data in the current region.
+	 * @param length : Length of data in bytes.
+	 * @param data : Pointer to data.
+	 * @param offset : Store offset of the data from buffer start.
+	 * @return : True when operation succeeded.
+	 **/
+	bool Push( const uint32_t length, const void* data, uint32_t& offset );
+
+	/**
+	 * Push function
+	 * @note : Copy elements in the current region at an offset multiple of stride.
+	 * @param length : Length of data in bytes.
+	 * @param stride : Query element size in bytes.
+	 * @param data : Pointer to data.
+	 * @param offset : Store offset of the data from buffer start.
+	 * @return : True when operation succeeded.
+	 **/
+	bool Push( const uint32_t length, const uint32_t stride, const void* data, uint32_t& offset );
+
+	/**
+	 * BindRange method
+	 * @note : Bind a range of the buffer to an indexed binding point, only
+	 *		   uniform and storage stream buffers have indexed binding points.
+	 * @param binding : Query binding point.
+	 * @param offset : Query range offset from buffer start.
+	 * @param length : Query range length in bytes.
+	 **/
+	void BindRange( const uint32_t binding, const uint32_t offset, const uint32_t length );
+
+	/**
+	 * SetFormat method
+	 * @note : Set vertex format used to draw vertices written in the buffer,
+	 *		   resolved once at creation so recording never create it.
+	 * @param format : Query vertex format.
+	 * @param stride : Query vertex stride in bytes.
+	 **/
+	void SetFormat( GlwVertexFormat* format, const uint32_t stride );
+
+	/**
+	 * Release method
+	 * @note : Fence current region once all commands using it are submitted.
+	 **/
+	void Release( );
+
+	/**
+	 * Destroy method
+	 * @note : Destroy stream buffer.
+	 **/
+	virtual void Destroy( ) override;
+
+public:
+	/**
+	 * Push template function
+	 * @note : Copy data in the current region.
+	 * @template Type : Type of data to copy.
+	 * @param buffer_data : Buffer data.
+	 * @param offset : Store offset of the data from buffer start.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename Type>
+	bool Push( const Type& buffer_data, uint32_t& offset ) {
+		auto length = (uint32_t)sizeof( Type );
+
+		return Push( length, &buffer_data, offset );
+	};
+
+	/**
+	 * Push template function
+	 * @note : Copy data in the current region.
+	 * @template Type : Type of data to copy.
+	 * @param buffer_data : Buffer data list.
+	 * @param offset : Store offset of the data from buffer start.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename Type>
+	bool Push( const std::vector<Type>& buffer_data, uint32_t& offset ) {
+		auto* data  = (const void*)buffer_data.data( );
+		auto length = (uint32_t)( buffer_data.size( ) * sizeof( Type ) );
+
+		return Push( length, data, offset );
+	};
+
+	/**
+	 * PushElements template function
+	 * @note : Copy vertices or indices in the current region, offset is a
+	 *		   multiple of the element size.
+	 * @template Type : Type of element to copy.
+	 * @param buffer_data : Buffer data list.
+	 * @param offset : Store offset of the data from buffer start.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename Type>
+	bool PushElements( const std::vector<Type>& buffer_data, uint32_t& offset ) {
+		auto* data  = (const void*)buffer_data.data( );
+		auto length = (uint32_t)( buffer_data.size( ) * sizeof( Type ) );
+
+		return Push( length, (uint32_t)sizeof( Type ), data, offset );
+	};
+
+private:
+	/**
+	 * Wait method
+	 * @note : Wait and delete a region fence.
+	 * @param region : Query region.
+	 **/
+	void Wait( const uint32_t region );
+
+public:
+	/**
+	 * GetIsValid const function
+	 * @note : Get stream buffer validity.
+	 * @return : True when stream buffer is valid.
+	 **/
+	virtual bool GetIsValid( ) const override;
+
+	/**
+	 * GetIsIndexed const function
+	 * @note : Get if buffer type has indexed binding points.
+	 * @return : True for uniform and storage stream buffers.
+	 **/
+	bool GetIsIndexed( ) const;
+
+	/**
+	 * GetType const function
+	 * @note : Get buffer type.
+	 * @return : Return buffer type value.
+	 **/
+	const GlwBufferTypes GetType( ) const;
+
+	/**
+	 * GetCapacity const function
+	 * @note : Get capacity of a region in bytes.
+	 * @return : Return region capacity value.
+	 **/
+	uint32_t GetCapacity( ) const;
+
+	/**
+	 * GetRegionCount const function
+	 * @note : Get region count.
+	 * @return : Return region count value.
+	 **/
+	uint32_t GetRegionCount( ) const;
+
+	/**
+	 * GetRegion const function
+	 * @note : Get current region index.
+	 * @return : Return current region index value.
+	 **/
+	uint32_t GetRegion( ) const;
+
+	/**
+	 * GetRegionOffset const function
+	 * @note : Get current region offset from buffer start.
+	 * @return : Return current region offset value.
+	 **/
+	uint32_t GetRegionOffset( ) const;
+
+	/**
+	 * GetUsage const function
+	 * @note : Get bytes used in the current region.
+	 * @return : Return current region usage value.
+	 **/
+	uint32_t GetUsage( ) const;
+
+	/**
+	 * GetFormat const function
+	 * @note : Get vertex format of vertex stream buffer.
+	 * @return : Return pointer to vertex format or nullptr when none is set.
+	 **/
+	GlwVertexFormat* GetFormat( ) const;
+
+	/**
+	 * GetStride const function
+	 * @note : Get vertex stride of vertex stream buffer.
+	 * @return : Return vertex stride value.
+	 **/
+	uint32_t GetStride( ) const;
+
+	/**
+	 * Get const function
+	 * @note : Get OpenGL buffer handle.
+	 * @return : Return OpenGL buffer handle value.
+	 **/
+	const glBuffer Get( ) const;
+
+public:
+	/**
+	 * Cast operator
+	 * @note : Cast stream buffer to OpenGL buffer handle.
+	 * @return : Return Get( ) call value.
+	 **/
+	operator const glBuffer( ) const;
+
+};
@@ -0,0 +1,69 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwBuffer.h"
+
+struct GlwStreamBufferSpecification { 
+
+	GlwBufferTypes Type;
+	uint32_t Capacity;
+	uint32_t RegionCount;
+
+	/**
+	 * Constructor
+	 **/
+	GlwStreamBufferSpecification( );
+
+	/**
+	 * Constructor
+	 * @param type : Type of the buffer.
+	 * @param capacity : Capacity of a frame region in bytes.
+	 **/
+	GlwStreamBufferSpecification( 
+		const GlwBufferTypes type, 
+		const uint32_t capacity
+	);
+
+	/**
+	 * Constructor
+	 * @param type : Type of the buffer.
+	 * @param capacity : Capacity of a frame region in bytes.
+	 * @param region_count : Count of frame region, frames that can be in flight.
+	 **/
+	GlwStreamBufferSpecification( 
+		const GlwBufferTypes type, 
+		const uint32_t capacity,
+		const uint32_t region_count
+	);
+
+};
@@ -31,7 +31,7 @@
 
 #pragma once
 
-#include "../Context/GlwGraphicSpecification.h"
+#include "../Context/GlwBarrierTracker.h"
 
 typedef uint32_t glw_ressource;
 
@@ -38,17 +38,30 @@ GlwRessourceManager::GlwRessourceManager( )
 	: m_meshes{ },
 	m_textures_2d{ },
 	m_cubemaps{ },
-	m_materials{ }
+	m_materials{ },
+	m_stream_buffers{ },
+	m_geometry_pools{ },
+	m_formats{ },
+	m_programs{ },
+	m_pending_materials{ },
+	m_placeholder{ UINT_MAX }
 { }
 
 bool GlwRessourceManager::CreateMesh( const GlwMeshSpecification& specification ) {
-	auto mesh   = GlwMesh{ };
-	auto result = mesh.Create( specification );
+	auto mesh = glw_ressource{ };
 
-	if ( result )
-		m_meshes.emplace_back( mesh );
-	else
-		mesh.Destroy( );
+	return CreateMesh( specification, mesh );
+}
+
+bool GlwRessourceManager::CreateMesh(
+	const GlwMeshSpecification& specification,
+	glw_ressource& mesh
+) {
+	auto instance = GlwMesh{ };
+	auto result   = instance.Create( specification, m_formats ) && m_meshes.Emplace( instance, mesh );
+
+	if ( !result )
+		instance.Destroy( );
 
 	return result;
 }
@@ -56,13 +69,20 @@ bool GlwRessourceManager::CreateMesh( const GlwMeshSpecification& specification
 bool GlwRessourceManager::CreateTexture2D(
 	const GlwTexture2DSpecification& specification 
 ) {
-	auto texture = GlwTexture2D{ };
-	auto result  = texture.Create( specification );
+	auto texture = glw_ressource{ };
 
-	if ( result )
-		m_textures_2d.emplace_back( texture );
-	else
-		texture.Destroy( );
+	return CreateTexture2D( specification, texture );
+}
+
+bool GlwRessourceManager::CreateTexture2D(
+	const GlwTexture2DSpecification& specification,
+	glw_ressource& texture
+) {
+	auto instance = GlwTexture2D{ };
+	auto result   = instance.Create( specification ) && m_textures_2d.Emplace( instance, texture );
+
+	if ( !result )
+		instance.Destroy( );
 
 	return result;
 }
@@ -71,13 +91,22 @@ bool GlwRessourceManager::CreateTexture2D(
 	const GlwTexture2DSpecification& specification,
 	const std::vector<uint8_t>& pixels
 ) {
-	auto texture = GetTexture2DCount( );
-	auto result  = CreateTexture2D( specification );
+	auto texture = glw_ressource{ };
+
+	return CreateTexture2D( specification, pixels, texture );
+}
+
+bool GlwRessourceManager::CreateTexture2D(
+	const GlwTexture2DSpecification& specification,
+	const std::vector<uint8_t>& pixels,
+	glw_ressource& texture
+) {
+	auto result = CreateTexture2D( specification, texture );
 
 	if ( result ) {
 		auto* pixel_data = pixels.data( );
 
-		m_textures_2d[ texture ].Fill( { specification.Width, specification.Height, pixel_data } );
+		m_textures_2d.Get( texture )->Fill( { specification.Width, specification.Height, pixel_data } );
 	}
 
 	return result;
@@ -86,13 +115,20 @@ bool GlwRessourceManager::CreateTexture2D(
 bool GlwRessourceManager::CreateCubemap( 
 	const GlwTextureCubemapSpecification& specification
 ) {
-	auto cubemap = GlwTextureCubemap{ };
-	auto result  = cubemap.Create( specification );
+	auto cubemap = glw_ressource{ };
 
-	if ( result )
-		m_cubemaps.emplace_back( cubemap );
-	else
-		cubemap.Destroy( );
+	return CreateCubemap( specification, cubemap );
+}
+
+bool GlwRessourceManager::CreateCubemap(
+	const GlwTextureCubemapSpecification& specification,
+	glw_ressource& cubemap
+) {
+	auto instance = GlwTextureCubemap{ };
+	auto result   = instance.Create( specification ) && m_cubemaps.Emplace( instance, cubemap );
+
+	if ( !result )
+		instance.Destroy( );
 
 	return result;
 }
@@ -101,48 +137,154 @@ bool GlwRessourceManager::CreateCubemap(
 	const GlwTextureCubemapSpecification& specification,
 	const std::vector<uint8_t> face_pixels[ ]
 ) {
-	auto cubemap = GetCubemapCount( );
-	auto result  = CreateCubemap( specification );
+	auto cubemap = glw_ressource{ };
+
+	return CreateCubemap( specification, face_pixels, cubemap );
+}
+
+bool GlwRessourceManager::CreateCubemap(
+	const GlwTextureCubemapSpecification& specification,
+	const std::vector<uint8_t> face_pixels[ ],
+	glw_ressource& cubemap
+) {
+	auto result = CreateCubemap( specification, cubemap );
 
 	if ( result ) {
+		auto* instance = m_cubemaps.Get( cubemap );
+
 		for ( auto i = 0; i < GlwTextureCubemap::FaceCount; i++ ) {
 			auto* pixel_data = face_pixels[ i ].data( );
 			auto fill_spec   = GlwTextureFillSpecification{ specification.Width, specification.Height, pixel_data };
 			
-			fill_spec.Level = GL_TEXTURE_CUBE_MAP_POSITIVE_X + i;
+			fill_spec.Level = i;
 
-			m_cubemaps[ cubemap ].Fill( fill_spec );
+			instance->Fill( fill_spec );
 		}
 	}
 
 	return result;
 }
 
+bool GlwRessourceManager::CreateProgramCache( const std::string& directory ) {
+	return m_programs.Create( directory );
+}
+
+void GlwRessourceManager::ClearProgramCache( ) {
+	m_programs.Clear( );
+}
+
 bool GlwRessourceManager::CreateMaterial(
 	const GlwMaterialSpecification& specification
 ) {
-	auto material = GlwMaterial{ };
-	auto result   = material.Create( specification );
+	auto material = glw_ressource{ };
 
-	if ( result )
-		m_materials.emplace_back( material );
-	else
-		material.Destroy( );
+	return CreateMaterial( specification, material );
+}
+
+bool GlwRessourceManager::CreateMaterial(
+	const GlwMaterialSpecification& specification,
+	glw_ressource& material
+) {
+	auto instance = GlwMaterial{ };
+	auto result   = instance.Create( specification, m_programs ) && m_materials.Emplace( instance, material );
+
+	if ( !result )
+		instance.Destroy( );
+
+	return result;
+}
+
+bool GlwRessourceManager::SubmitMaterial(
+	const GlwMaterialSpecification& specification,
+	glw_ressource& material
+) {
+	auto instance = GlwMaterial{ };
+	auto result   = instance.Submit( specification, m_programs ) && m_materials.Emplace( instance, material );
+
+	if ( !result )
+		instance.Destroy( );
+	else if ( !instance.GetIsReady( ) )
+		m_pending_materials.emplace_back( material );
+
+	return result;
+}
+
+bool GlwRessourceManager::CreateMaterialVariant(
+	GlwMaterialTemplate& material_template,
+	const GlwMaterialDefines& defines,
+	glw_ressource& material
+) {
+	return EmplaceVariant( material_template, defines, false, material );
+}
+
+bool GlwRessourceManager::SubmitMaterialVariant(
+	GlwMaterialTemplate& material_template,
+	const GlwMaterialDefines& defines,
+	glw_ressource& material
+) {
+	return EmplaceVariant( material_template, defines, true, material );
+}
+
+void GlwRessourceManager::SetPlaceholderMaterial( const glw_ressource material ) {
+	m_placeholder = material;
+}
+
+bool GlwRessourceManager::CreateStreamBuffer(
+	const GlwStreamBufferSpecification& specification,
+	glw_ressource& stream_buffer
+) {
+	return EmplaceStreamBuffer( specification, nullptr, 0, stream_buffer );
+}
+
+bool GlwRessourceManager::CreateStreamBuffer(
+	const GlwStreamBufferSpecification& specification,
+	const std::vector<GlwVertexAttribute>& attributes,
+	glw_ressource& stream_buffer
+) {
+	auto* format = (GlwVertexFormat*)nullptr;
+	auto stride  = (uint32_t)0;
+
+	for ( auto& attribute : attributes ) {
+		if ( attribute.Binding == 0 && attribute.Size > 0 && attribute.Size <= 4 ) {
+			stride = GlwVertexArray::GetStride( attribute );
+
+			break;
+		}
+	}
+
+	if ( specification.Type != GlwBufferTypes::Vertex || stride == 0 || !m_formats.Acquire( attributes, format ) )
+		return false;
+
+	return EmplaceStreamBuffer( specification, format, stride, stream_buffer );
+}
+
+bool GlwRessourceManager::CreateGeometryPool(
+	const GlwGeometryPoolSpecification& specification,
+	glw_ressource& geometry_pool
+) {
+	auto instance = GlwGeometryPool{ };
+	auto result   = instance.Create( specification ) && m_geometry_pools.Emplace( instance, geometry_pool );
+
+	if ( !result )
+		instance.Destroy( );
 
 	return result;
 }
 
 bool GlwRessourceManager::ReplaceMesh(
-	const uint32_t mesh,
+	const glw_ressource mesh,
 	const GlwMeshSpecification& specification
 ) {
 	auto result = false;
 
-	if ( GetMeshExist( mesh ) ) {
+	if ( auto* instance = m_meshes.Get( mesh ) ) {
 		auto new_mesh = GlwMesh{ };
 
-		if ( result = new_mesh.Create( specification ) )
-			m_meshes[ mesh ] = new_mesh;
+		if ( result = new_mesh.Create( specification, m_formats ) ) {
+			*instance = new_mesh;
+
+			m_formats.Invalidate( );
+		}
 	}
 
 	return result;
@@ -154,11 +296,11 @@ bool GlwRessourceManager::ReplaceTexture2D(
 ) {
 	auto result = false;
 
-	if ( GetTexture2DExist( texture ) ) {
+	if ( auto* instance = m_textures_2d.Get( texture ) ) {
 		auto new_texture = GlwTexture2D{ };
 
 		if ( result = new_texture.Create( specification ) )
-			m_textures_2d[ texture ] = new_texture;
+			*instance = new_texture;
 	}
 
 	return result;
@@ -174,7 +316,7 @@ bool GlwRessourceManager::ReplaceTexture2D(
 	if ( result ) {
 		auto* pixel_data = pixels.data( ); 
 		
-		m_textures_2d[ texture ].Fill( { specification.Width, specification.Height, pixel_data } );
+		m_textures_2d.Get( texture )->Fill( { specification.Width, specification.Height, pixel_data } );
 	}
 
 	return result;
@@ -186,11 +328,11 @@ bool GlwRessourceManager::ReplaceCubemap(
 ) {
 	auto result = false;
 
-	if ( GetCubemapExist( cubemap ) ) {
+	if ( auto* instance = m_cubemaps.Get( cubemap ) ) {
 		auto new_cubemap = GlwTextureCubemap{ };
 
 		if ( result = new_cubemap.Create( specification ) )
-			m_cubemaps[ cubemap ] = new_cubemap;
+			*instance = new_cubemap;
 	}
 
 	return result;
@@ -204,13 +346,15 @@ bool GlwRessourceManager::ReplaceCubemap(
 	auto result = ReplaceCubemap( cubemap, specification );
 
 	if ( result ) {
+		auto* instance = m_cubemaps.Get( cubemap );
+
 		for ( auto i = 0; i < GlwTextureCubemap::FaceCount; i++ ) {
 			auto* pixel_data = face_pixels[ i ].data( );
 			auto fill_spec   = GlwTextureFillSpecification{ specification.Width, specification.Height, pixel_data };
 
-			fill_spec.Level = GL_TEXTURE_CUBE_MAP_POSITIVE_X + i;
+			fill_spec.Level = i;
 
-			m_cubemaps[ cubemap ].Fill( fill_spec );
+			instance->Fill( fill_spec );
 		}
 	}
 
@@ -223,115 +367,268 @@ bool GlwRessourceManager::ReplaceMaterial(
 ) {
 	auto result = false;
 
-	if ( GetMaterialExist( material ) ) {
+	if ( auto* instance = m_materials.Get( material ) ) {
 		auto new_material = GlwMaterial{ };
 
-		if ( result = new_material.Create( specification ) )
-			m_materials[ material ] = new_material;
+		if ( result = new_material.Create( specification, m_programs ) )
+			*instance = new_material;
 	}
 
 	return result;
 }
 
-GlwMesh* GlwRessourceManager::UseMesh( const glw_ressource mesh ) {
+GlwMesh* GlwRessourceManager::UseMesh( 
+	GlwStateTracker& state_tracker, 
+	const glw_ressource mesh 
+) {
 	auto* instance = GetMesh( mesh );
 
 	if ( instance != nullptr )
-		instance->Use( );
+		instance->Use( state_tracker );
 
 	return instance;
 }
 
-GlwMaterial* GlwRessourceManager::UseMaterial( const glw_ressource material ) {
-	auto instance = (GlwMaterial*)nullptr;
+GlwMaterial* GlwRessourceManager::UseMaterial( 
+	GlwStateTracker& state_tracker, 
+	const glw_ressource material 
+) {
+	auto* instance = GetMaterial( material );
 
-	if ( GetMaterialExist( material ) )
-		instance = m_materials[ material ].Use( );
+	if ( instance != nullptr )
+		instance->Use( state_tracker );
 
 	return instance;
 }
 
+uint32_t GlwRessourceManager::PollMaterials( ) {
+	auto pending = std::remove_if(
+		m_pending_materials.begin( ), m_pending_materials.end( ),
+		[ this ]( const glw_ressource material ) {
+			auto* instance = m_materials.Get( material );
+
+			if ( instance != nullptr )
+				instance->Poll( );
+
+			return instance == nullptr || instance->GetState( ) != GlwMaterialStates::Pending;
+		}
+	);
+
+	m_pending_materials.erase( pending, m_pending_materials.end( ) );
+
+	return (uint32_t)m_pending_materials.size( );
+}
+
+void GlwRessourceManager::AcquireStreamBuffers( ) {
+	m_stream_buffers.ForEach( 
+		[]( const glw_ressource handle, GlwStreamBuffer& stream_buffer ) { stream_buffer.Acquire( ); }
+	);
+}
+
+void GlwRessourceManager::ReleaseStreamBuffers( ) {
+	m_stream_buffers.ForEach( 
+		[]( const glw_ressource handle, GlwStreamBuffer& stream_buffer ) { stream_buffer.Release( ); }
+	);
+}
+
+bool GlwRessourceManager::DestroyMesh( const glw_ressource mesh ) {
+	auto result = m_meshes.Release( mesh );
+
+	if ( result )
+		m_formats.Invalidate( );
+
+	return result;
+}
+
+bool GlwRessourceManager::DestroyTexture2D( const glw_ressource texture ) {
+	return m_textures_2d.Release( texture );
+}
+
+bool GlwRessourceManager::DestroyCubemap( const glw_ressource cubemap ) {
+	return m_cubemaps.Release( cubemap );
+}
+
+bool GlwRessourceManager::DestroyMaterial( const glw_ressource material ) {
+	return m_materials.Release( material );
+}
+
+bool GlwRessourceManager::DestroyStreamBuffer( const glw_ressource stream_buffer ) {
+	auto result = m_stream_buffers.Release( stream_buffer );
+
+	if ( result )
+		m_formats.Invalidate( );
+
+	return result;
+}
+
+bool GlwRessourceManager::DestroyGeometryPool( const glw_ressource geometry_pool ) {
+	return m_geometry_pools.Release( geometry_pool );
+}
+
 void GlwRessourceManager::Destroy( ) {
-	for ( auto& mesh : m_meshes )
-		mesh.Destroy( );
+	m_meshes.Clear( );
+	m_textures_2d.Clear( );
+	m_cubemaps.Clear( );
+	m_materials.Clear( );
+	m_stream_buffers.Clear( );
+	m_geometry_pools.Clear( );
+	m_formats.Destroy( );
+	m_programs.Destroy( );
+	m_pending_materials.clear( );
+
+	m_placeholder = UINT_MAX;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwRessourceManager::EmplaceStreamBuffer(
+	const GlwStreamBufferSpecification& specification,
+	GlwVertexFormat* format,
+	const uint32_t stride,
+	glw_ressource& stream_buffer
+) {
+	auto instance = GlwStreamBuffer{ };
+	auto result   = instance.Create( specification );
+
+	if ( result ) {
+		instance.SetFormat( format, stride );
+
+		result = m_stream_buffers.Emplace( instance, stream_buffer );
+	}
+
+	if ( !result )
+		instance.Destroy( );
+
+	return result;
+}
+
+bool GlwRessourceManager::EmplaceVariant(
+	GlwMaterialTemplate& material_template,
+	const GlwMaterialDefines& defines,
+	const bool is_async,
+	glw_ressource& material
+) {
+	auto key = defines.GetHash( );
+
+	if ( material_template.GetVariant( key, material ) && m_materials.GetExist( material ) )
+		return true;
 
-	for ( auto& texture : m_textures_2d )
-		texture.Destroy( );
+	auto specification = GlwMaterialSpecification{ };
+	auto result        = material_template.Preprocess( defines, specification );
 
-	for ( auto& cubemap : m_cubemaps )
-		cubemap.Destroy( );
+	if ( result )
+		result = is_async ? SubmitMaterial( specification, material ) : CreateMaterial( specification, material );
 
-	for ( auto& material : m_materials )
-		material.Destroy( );
+	if ( result )
+		material_template.SetVariant( key, material );
+	else
+		material_template.RemoveVariant( key );
+
+	return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 uint32_t GlwRessourceManager::GetMeshCount( ) const {
-	return (uint32_t)m_meshes.size( );
+	return m_meshes.GetCount( );
 }
 
 uint32_t GlwRessourceManager::GetTexture2DCount( ) const {
-	return (uint32_t)m_textures_2d.size( );
+	return m_textures_2d.GetCount( );
 }
 
 uint32_t GlwRessourceManager::GetCubemapCount( ) const {
-	return (uint32_t)m_cubemaps.size( );
+	return m_cubemaps.GetCount( );
 }
 
 uint32_t GlwRessourceManager::GetMaterialCount( ) const {
-	return (uint32_t)m_materials.size( );
+	return m_materials.GetCount( );
+}
+
+uint32_t GlwRessourceManager::GetStreamBufferCount( ) const {
+	return m_stream_buffers.GetCount( );
+}
+
+uint32_t GlwRessourceManager::GetGeometryPoolCount( ) const {
+	return m_geometry_pools.GetCount( );
+}
+
+uint32_t GlwRessourceManager::GetVertexFormatCount( ) const {
+	return m_formats.GetCount( );
 }
 
 bool GlwRessourceManager::GetMeshExist( const glw_ressource mesh ) const {
-	return mesh < (uint32_t)m_meshes.size( );
+	return m_meshes.GetExist( mesh );
 }
 
 bool GlwRessourceManager::GetTexture2DExist( const glw_ressource texture ) const {
-	return texture < (uint32_t)m_textures_2d.size( );
+	return m_textures_2d.GetExist( texture );
 }
 
 bool GlwRessourceManager::GetCubemapExist( const glw_ressource cubemap ) const {
-	return cubemap < (uint32_t)m_cubemaps.size( );
+	return m_cubemaps.GetExist( cubemap );
 }
 
 bool GlwRessourceManager::GetMaterialExist( const glw_ressource material ) const {
-	return material < (uint32_t)m_materials.size( );
+	return m_materials.GetExist( material );
 }
 
-GlwMesh* GlwRessourceManager::GetMesh( const glw_ressource mesh ) {
-	auto* instance = (GlwMesh*)nullptr;
+bool GlwRessourceManager::GetStreamBufferExist( const glw_ressource stream_buffer ) const {
+	return m_stream_buffers.GetExist( stream_buffer );
+}
 
-	if ( GetMeshExist( mesh ) )
-		instance = &m_meshes[ mesh ];
+bool GlwRessourceManager::GetGeometryPoolExist( const glw_ressource geometry_pool ) const {
+	return m_geometry_pools.GetExist( geometry_pool );
+}
 
-	return instance;
+GlwMesh* GlwRessourceManager::GetMesh( const glw_ressource mesh ) {
+	return m_meshes.Get( mesh );
 }
 
 GlwTexture2D* GlwRessourceManager::GetTexture2D( const glw_ressource texture ) {
-	auto* instance = (GlwTexture2D*)nullptr;
+	return m_textures_2d.Get( texture );
+}
 
-	if ( GetTexture2DExist( texture ) )
-		instance = &m_textures_2d[ texture ];
+GlwTextureCubemap* GlwRessourceManager::GetCubemap( const glw_ressource cubemap ) {
+	return m_cubemaps.Get( cubemap );
+}
 
-	return instance;
+uint32_t GlwRessourceManager::GetPendingMaterialCount( ) const {
+	return (uint32_t)m_pending_materials.size( );
 }
 
-GlwTextureCubemap* GlwRessourceManager::GetCubemap( const glw_ressource cubemap ) {
-	auto* instance = ( GlwTextureCubemap* )nullptr;
+glw_ressource GlwRessourceManager::GetPlaceholderMaterial( ) const {
+	return m_placeholder;
+}
+
+GlwMaterial* GlwRessourceManager::GetReadyMaterial( glw_ressource& material ) {
+	auto* instance = m_materials.Get( material );
 
-	if ( GetCubemapExist( cubemap ) )
-		instance = &m_cubemaps[ cubemap ];
+	if ( instance != nullptr && !instance->GetIsReady( ) ) {
+		material = m_placeholder;
+		instance = m_materials.Get( material );
+
+		if ( instance != nullptr && !instance->GetIsReady( ) )
+			instance = nullptr;
+	}
 
 	return instance;
 }
 
+const GlwProgramCache& GlwRessourceManager::GetProgramCache( ) const {
+	return m_programs;
+}
+
 GlwMaterial* GlwRessourceManager::GetMaterial( const glw_ressource material ) {
-	auto* instance = (GlwMaterial*)nullptr;
+	return m_materials.Get( material );
+}
 
-	if ( GetMaterialExist( material ) )
-		instance = &m_materials[ material ];
+GlwStreamBuffer* GlwRessourceManager::GetStreamBuffer( const glw_ressource stream_buffer ) {
+	return m_stream_buffers.Get( stream_buffer );
+}
 
-	return instance;
+GlwGeometryPool* GlwRessourceManager::GetGeometryPool( const glw_ressource geometry_pool ) {
+	return m_geometry_pools.Get( geometry_pool );
 }
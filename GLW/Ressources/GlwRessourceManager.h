@@ -31,15 +31,21 @@
 
 #pragma once
 
-#include "Materials/GlwMaterial.h"
+#include "GlwRessourcePool.h"
 
 class GlwRessourceManager final { 
 
 private:
-	std::vector<GlwMesh> m_meshes;
-	std::vector<GlwTexture2D> m_textures_2d;
-	std::vector<GlwTextureCubemap> m_cubemaps;
-	std::vector<GlwMaterial> m_materials;
+	GlwRessourcePool<GlwMesh> m_meshes;
+	GlwRessourcePool<GlwTexture2D> m_textures_2d;
+	GlwRessourcePool<GlwTextureCubemap> m_cubemaps;
+	GlwRessourcePool<GlwMaterial> m_materials;
+	GlwRessourcePool<GlwStreamBuffer> m_stream_buffers;
+	GlwRessourcePool<GlwGeometryPool> m_geometry_pools;
+	GlwVertexFormatRegistry m_formats;
+	GlwProgramCache m_programs;
+	std::vector<glw_ressource> m_pending_materials;
+	glw_ressource m_placeholder;
 
 public:
 	/**
@@ -60,6 +66,18 @@ public:
 	 **/
 	bool CreateMesh( const GlwMeshSpecification& specification );
 
+	/**
+	 * CreateMesh function
+	 * @note : Create mesh according to query specification.
+	 * @param specification : Query mesh specification.
+	 * @param mesh : Store created mesh handle.
+	 * @return : True when creation succeeded.
+	 **/
+	bool CreateMesh( 
+		const GlwMeshSpecification& specification,
+		glw_ressource& mesh
+	);
+
 	/**
 	 * CreateTexture2D function
 	 * @note : Create texture according to query specification.
@@ -67,6 +85,18 @@ public:
 	 * @return : True when creation succeeded.
 	 **/
 	bool CreateTexture2D( const GlwTexture2DSpecification& specification );
+
+	/**
+	 * CreateTexture2D function
+	 * @note : Create texture according to query specification.
+	 * @param specification : Query texture specification.
+	 * @param texture : Store created texture handle.
+	 * @return : True when creation succeeded.
+	 **/
+	bool CreateTexture2D( 
+		const GlwTexture2DSpecification& specification,
+		glw_ressource& texture
+	);
 	
 	/**
 	 * CreateTexture2D function
@@ -80,6 +110,20 @@ public:
 		const std::vector<uint8_t>& pixels
 	);
 
+	/**
+	 * CreateTexture2D function
+	 * @note : Create texture according to query specification and fill-it width pixels data.
+	 * @param specification : Query texture specification.
+	 * @param pixels : Query texture pixels data as unsigned byte.
+	 * @param texture : Store created texture handle.
+	 * @return : True when creation succeeded.
+	 **/
+	bool CreateTexture2D(
+		const GlwTexture2DSpecification& specification,
+		const std::vector<uint8_t>& pixels,
+		glw_ressource& texture
+	);
+
 	/**
 	 * CreateCubemap function
 	 * @note : Create cubemap texture according to query specification.
@@ -88,6 +132,18 @@ public:
 	 **/
 	bool CreateCubemap( const GlwTextureCubemapSpecification& specification );
 
+	/**
+	 * CreateCubemap function
+	 * @note : Create cubemap texture according to query specification.
+	 * @param specification : Query cubemap texture specification.
+	 * @param cubemap : Store created cubemap handle.
+	 * @return : True when creation succeeded.
+	 **/
+	bool CreateCubemap( 
+		const GlwTextureCubemapSpecification& specification,
+		glw_ressource& cubemap
+	);
+
 	/**
 	 * CreateCubemap function
 	 * @note : Create cubemap texture according to query specification.
@@ -100,6 +156,35 @@ public:
 		const std::vector<uint8_t> face_pixels[ GlwTextureCubemap::FaceCount ]
 	);
 
+	/**
+	 * CreateCubemap function
+	 * @note : Create cubemap texture according to query specification.
+	 * @param specification : Query cubemap texture specification.
+	 * @param face_pixels : Array of the cubemap face texture pixels as unsigned byte.
+	 * @param cubemap : Store created cubemap handle.
+	 * @return : True when creation succeeded.
+	 **/
+	bool CreateCubemap( 
+		const GlwTextureCubemapSpecification& specification,
+		const std::vector<uint8_t> face_pixels[ GlwTextureCubemap::FaceCount ],
+		glw_ressource& cubemap
+	);
+
+	/**
+	 * CreateProgramCache function
+	 * @note : Enable on-disk program binary cache for materials created afterward.
+	 *         Must be called once the OpenGL context is created.
+	 * @param directory : Query cache directory path.
+	 * @return : True when the cache is enabled.
+	 **/
+	bool CreateProgramCache( const std::string& directory );
+
+	/**
+	 * ClearProgramCache method
+	 * @note : Remove every cached program binary and reset cache statistics.
+	 **/
+	void ClearProgramCache( );
+
 	/**
 	 * CreateMaterial function
 	 * @note : Create material according to query specification.
@@ -108,6 +193,107 @@ public:
 	 **/
 	bool CreateMaterial( const GlwMaterialSpecification& specification );
 
+	/**
+	 * CreateMaterial function
+	 * @note : Create material according to query specification.
+	 * @param specification : Query material specification.
+	 * @param material : Store created material handle.
+	 * @return : True when creation succeeded.
+	 **/
+	bool CreateMaterial( 
+		const GlwMaterialSpecification& specification,
+		glw_ressource& material
+	);
+
+	/**
+	 * SubmitMaterial function
+	 * @note : Create material without waiting on the shader compiler, the
+	 *         material is pending until PollMaterials report it ready.
+	 * @param specification : Query material specification.
+	 * @param material : Store created material handle.
+	 * @return : True when submission succeeded.
+	 **/
+	bool SubmitMaterial( 
+		const GlwMaterialSpecification& specification,
+		glw_ressource& material
+	);
+
+	/**
+	 * CreateMaterialVariant function
+	 * @note : Get material of query template variant, the variant is
+	 *         preprocessed and compiled on first request only.
+	 * @param material_template : Query material template.
+	 * @param defines : Query variant defines.
+	 * @param material : Store variant material handle.
+	 * @return : True when variant exist or creation succeeded.
+	 **/
+	bool CreateMaterialVariant(
+		GlwMaterialTemplate& material_template,
+		const GlwMaterialDefines& defines,
+		glw_ressource& material
+	);
+
+	/**
+	 * SubmitMaterialVariant function
+	 * @note : Get material of query template variant like CreateMaterialVariant,
+	 *         a new variant is submitted without waiting on the shader compiler.
+	 * @param material_template : Query material template.
+	 * @param defines : Query variant defines.
+	 * @param material : Store variant material handle.
+	 * @return : True when variant exist or submission succeeded.
+	 **/
+	bool SubmitMaterialVariant(
+		GlwMaterialTemplate& material_template,
+		const GlwMaterialDefines& defines,
+		glw_ressource& material
+	);
+
+	/**
+	 * SetPlaceholderMaterial method
+	 * @note : Set material used in place of pending materials.
+	 * @param material : Query placeholder material.
+	 **/
+	void SetPlaceholderMaterial( const glw_ressource material );
+
+	/**
+	 * CreateStreamBuffer function
+	 * @note : Create stream buffer according to query specification.
+	 * @param specification : Query stream buffer specification.
+	 * @param stream_buffer : Store created stream buffer handle.
+	 * @return : True when creation succeeded.
+	 **/
+	bool CreateStreamBuffer( 
+		const GlwStreamBufferSpecification& specification,
+		glw_ressource& stream_buffer
+	);
+
+	/**
+	 * CreateStreamBuffer function
+	 * @note : Create vertex stream buffer and resolve the vertex format used
+	 *		   to draw it, so drawing it never create OpenGL objects.
+	 * @param specification : Query stream buffer specification.
+	 * @param attributes : Query vertex attribute list, read from binding slot 0.
+	 * @param stream_buffer : Store created stream buffer handle.
+	 * @return : True when creation succeeded.
+	 **/
+	bool CreateStreamBuffer( 
+		const GlwStreamBufferSpecification& specification,
+		const std::vector<GlwVertexAttribute>& attributes,
+		glw_ressource& stream_buffer
+	);
+
+	/**
+	 * CreateGeometryPool function
+	 * @note : Create geometry pool according to query specification.
+	 * @param specification : Query geometry pool specification.
+	 * @param geometry_pool : Store created geometry pool handle.
+	 * @return : True when creation succeeded.
+	 **/
+	bool CreateGeometryPool( 
+		const GlwGeometryPoolSpecification& specification,
+		glw_ressource& geometry_pool
+	);
+
 	/**
 	 * ReplaceMesh function
 	 * @note : Replace mesh according to query specification.
@@ -187,18 +373,87 @@ public:
 	/**
 	 * UseMesh function
 	 * @note : Bind mesh for usage.
+	 * @param state_tracker : Query current state tracker.
 	 * @param mesh : Query mesh.
 	 * @return : Return query mesh instance.
 	 **/
-	GlwMesh* UseMesh( const glw_ressource mesh );
+	GlwMesh* UseMesh( GlwStateTracker& state_tracker, const glw_ressource mesh );
 
 	/**
 	 * UseMaterial function
 	 * @note : Bind material for usage.
+	 * @param state_tracker : Query current state tracker.
 	 * @param material : Query material.
 	 * @return : Return query material instance.
 	 **/
-	GlwMaterial* UseMaterial( const glw_ressource material );
+	GlwMaterial* UseMaterial( GlwStateTracker& state_tracker, const glw_ressource material );
+
+	/**
+	 * PollMaterials function
+	 * @note : Resolve pending materials the driver completed.
+	 * @return : Return count of materials still pending.
+	 **/
+	uint32_t PollMaterials( );
+
+	/**
+	 * AcquireStreamBuffers method
+	 * @note : Move all stream buffers to their next frame region.
+	 **/
+	void AcquireStreamBuffers( );
+
+	/**
+	 * ReleaseStreamBuffers method
+	 * @note : Fence current frame region of all stream buffers.
+	 **/
+	void ReleaseStreamBuffers( );
+
+	/**
+	 * DestroyMesh function
+	 * @note : Destroy mesh and release its handle for reuse.
+	 * @param mesh : Query mesh.
+	 * @return : True when mesh existed.
+	 **/
+	bool DestroyMesh( const glw_ressource mesh );
+
+	/**
+	 * DestroyTexture2D function
+	 * @note : Destroy texture 2D and release its handle for reuse.
+	 * @param texture : Query texture 2D.
+	 * @return : True when texture 2D existed.
+	 **/
+	bool DestroyTexture2D( const glw_ressource texture );
+
+	/**
+	 * DestroyCubemap function
+	 * @note : Destroy cubemap and release its handle for reuse.
+	 * @param cubemap : Query cubemap.
+	 * @return : True when cubemap existed.
+	 **/
+	bool DestroyCubemap( const glw_ressource cubemap );
+
+	/**
+	 * DestroyMaterial function
+	 * @note : Destroy material and release its handle for reuse.
+	 * @param material : Query material.
+	 * @return : True when material existed.
+	 **/
+	bool DestroyMaterial( const glw_ressource material );
+
+	/**
+	 * DestroyStreamBuffer function
+	 * @note : Destroy stream buffer, its handle become stale and its slot is reused.
+	 * @param stream_buffer : Query stream buffer.
+	 * @return : True when stream buffer existed.
+	 **/
+	bool DestroyStreamBuffer( const glw_ressource stream_buffer );
+
+	/**
+	 * DestroyGeometryPool function
+	 * @note : Destroy geometry pool, its handle become stale and its slot is reused.
+	 * @param geometry_pool : Query geometry pool.
+	 * @return : True when geometry pool existed.
+	 **/
+	bool DestroyGeometryPool( const glw_ressource geometry_pool );
 
 	/**
 	 * Destroy method
@@ -206,6 +461,39 @@ public:
 	 **/
 	void Destroy( );
 
+private:
+	/**
+	 * EmplaceStreamBuffer function
+	 * @note : Create stream buffer and store it with its vertex format.
+	 * @param specification : Query stream buffer specification.
+	 * @param format : Query vertex format, nullptr for none.
+	 * @param stride : Query vertex stride.
+	 * @param stream_buffer : Store created stream buffer handle.
+	 * @return : True when creation succeeded.
+	 **/
+	bool EmplaceStreamBuffer(
+		const GlwStreamBufferSpecification& specification,
+		GlwVertexFormat* format,
+		const uint32_t stride,
+		glw_ressource& stream_buffer
+	);
+
+	/**
+	 * EmplaceVariant function
+	 * @note : Find or create material of query template variant.
+	 * @param material_template : Query material template.
+	 * @param defines : Query variant defines.
+	 * @param is_async : Query if a new variant is submitted instead of created.
+	 * @param material : Store variant material handle.
+	 * @return : True when variant exist or creation succeeded.
+	 **/
+	bool EmplaceVariant(
+		GlwMaterialTemplate& material_template,
+		const GlwMaterialDefines& defines,
+		const bool is_async,
+		glw_ressource& material
+	);
+
 public:
 	/**
 	 * CreateMesh template function
@@ -216,13 +504,29 @@ public:
 	 **/
 	template<typename VertexType>
 	bool CreateMesh( const GlwMeshStaticSpecification<VertexType>& specification ) {
-		auto mesh   = GlwMesh{ };
-		auto result = mesh.Create<VertexType>( specification );
+		auto mesh = glw_ressource{ };
 
-		if ( result )
-			m_meshes.emplace_back( mesh );
-		else
-			mesh.Destroy( );
+		return CreateMesh<VertexType>( specification, mesh );
+	};
+
+	/**
+	 * CreateMesh template function
+	 * @note : Create mesh according to query specification.
+	 * @template VertexType : Type of data used for vertex representation.
+	 * @param specification : Query mesh specification.
+	 * @param mesh : Store created mesh handle.
+	 * @return : True when creation succeeded.
+	 **/
+	template<typename VertexType>
+	bool CreateMesh( 
+		const GlwMeshStaticSpecification<VertexType>& specification,
+		glw_ressource& mesh
+	) {
+		auto instance = GlwMesh{ };
+		auto result   = instance.Create<VertexType>( specification, m_formats ) && m_meshes.Emplace( instance, mesh );
+
+		if ( !result )
+			instance.Destroy( );
 
 		return result;
 	};
@@ -242,16 +546,43 @@ public:
 	) {
 		auto result = false;
 
-		if ( GetMeshExist( mesh ) ) {
+		if ( auto* instance = m_meshes.Get( mesh ) ) {
 			auto new_mesh = GlwMesh{ };
 
-			if ( result = new_mesh.Create<VertexType>( specification ) )
-				m_meshes[ mesh ] = new_mesh;
+			if ( result = new_mesh.Create<VertexType>( specification, m_formats ) ) {
+				*instance = new_mesh;
+
+				m_formats.Invalidate( );
+			}
 		}
 
 		return result;
 	};
 
+	/**
+	 * CreateStreamBuffer template function
+	 * @note : Create vertex stream buffer for vertex type declared
+	 *		   GlwVertexLayout and resolve its vertex format.
+	 * @template VertexType : Type of data used for vertex representation.
+	 * @param specification : Query stream buffer specification.
+	 * @param stream_buffer : Store created stream buffer handle.
+	 * @return : True when creation succeeded.
+	 **/
+	template<typename VertexType>
+		requires GlwVertexLayoutDeclared<VertexType>
+	bool CreateStreamBuffer( 
+		const GlwStreamBufferSpecification& specification,
+		glw_ressource& stream_buffer
+	) {
+		auto* format = (GlwVertexFormat*)nullptr;
+		auto stride  = (uint32_t)GlwVertexLayoutTraits<VertexType>::Stride;
+
+		if ( specification.Type != GlwBufferTypes::Vertex || !m_formats.Acquire<VertexType>( format ) )
+			return false;
+
+		return EmplaceStreamBuffer( specification, format, stride, stream_buffer );
+	};
+
 public:
 	/**
 	 * GetMeshCount const function
@@ -281,6 +612,27 @@ public:
 	 **/
 	uint32_t GetMaterialCount( ) const;
 
+	/**
+	 * GetStreamBufferCount const function
+	 * @note : Get stream buffer count.
+	 * @return : Return stream buffer count value.
+	 **/
+	uint32_t GetStreamBufferCount( ) const;
+
+	/**
+	 * GetGeometryPoolCount const function
+	 * @note : Get geometry pool count.
+	 * @return : Return geometry pool count value.
+	 **/
+	uint32_t GetGeometryPoolCount( ) const;
+
+	/**
+	 * GetVertexFormatCount const function
+	 * @note : Get count of vertex formats shared between meshes.
+	 * @return : Return vertex format count value.
+	 **/
+	uint32_t GetVertexFormatCount( ) const;
+
 	/**
 	 * GetMeshExist const function
 	 * @note : Get if a mesh exist.
@@ -313,6 +665,22 @@ public:
 	 **/
 	bool GetMaterialExist( const glw_ressource material ) const;
 
+	/**
+	 * GetStreamBufferExist const function
+	 * @note : Get if a stream buffer exist.
+	 * @param stream_buffer : Query stream buffer.
+	 * @return : Return true when stream buffer is valid.
+	 **/
+	bool GetStreamBufferExist( const glw_ressource stream_buffer ) const;
+
+	/**
+	 * GetGeometryPoolExist const function
+	 * @note : Get if a geometry pool exist.
+	 * @param geometry_pool : Query geometry pool.
+	 * @return : Return true when geometry pool is valid.
+	 **/
+	bool GetGeometryPoolExist( const glw_ressource geometry_pool ) const;
+
 	/**
 	 * GetMesh function
 	 * @note : Get mesh instance.
@@ -337,6 +705,37 @@ public:
 	 **/
 	GlwTextureCubemap* GetCubemap( const glw_ressource cubemap );
 
+	/**
+	 * GetPendingMaterialCount const function
+	 * @note : Get count of submitted materials not resolved yet.
+	 * @return : Return pending material count value.
+	 **/
+	uint32_t GetPendingMaterialCount( ) const;
+
+	/**
+	 * GetPlaceholderMaterial const function
+	 * @note : Get material used in place of pending materials.
+	 * @return : Return placeholder material handle.
+	 **/
+	glw_ressource GetPlaceholderMaterial( ) const;
+
+	/**
+	 * GetReadyMaterial function
+	 * @note : Get material instance when ready, a pending material is replaced
+	 *         by the placeholder material and query handle is updated.
+	 * @param material : Query material, store the material actually used.
+	 * @return : Return pointer to ready material instance or nullptr.
+	 **/
+	GlwMaterial* GetReadyMaterial( glw_ressource& material );
+
+	/**
+	 * GetProgramCache const function
+	 * @note : Get program binary cache, hit, miss and time saved counters are
+	 *         available from its statistics.
+	 * @return : Return program cache instance.
+	 **/
+	const GlwProgramCache& GetProgramCache( ) const;
+
 	/**
 	 * GetMaterial function
 	 * @note : Get material instance.
@@ -345,4 +744,20 @@ public:
 	 **/
 	GlwMaterial* GetMaterial( const glw_ressource material );
 
+	/**
+	 * GetStreamBuffer function
+	 * @note : Get stream buffer instance.
+	 * @param stream_buffer : Query stream buffer.
+	 * @return : Return pointer to query stream buffer instance.
+	 **/
+	GlwStreamBuffer* GetStreamBuffer( const glw_ressource stream_buffer );
+
+	/**
+	 * GetGeometryPool function
+	 * @note : Get geometry pool instance.
+	 * @param geometry_pool : Query geometry pool.
+	 * @return : Return pointer to query geometry pool instance.
+	 **/
+	GlwGeometryPool* GetGeometryPool( const glw_ressource geometry_pool );
+
 };
@@ -0,0 +1,298 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "Materials/GlwMaterial.h"
+
+/**
+ * GlwRessourcePool template class
+ * @note : Generational slot map used to store ressources. Handles encode the
+ *		   slot index in the low bits and the slot generation in the high bits,
+ *		   so a handle to a destroyed ressource is detected as stale even when
+ *		   its slot was reused. Slots are allocated by pages that never move,
+ *		   pointers to ressources stay valid until the ressource is destroyed.
+ *		   Released slots are reused oldest first so churn spreads over all
+ *		   free slots, a slot whose generation reach GenerationMask is retired
+ *		   instead of wrapping so stale handles never alias a live ressource.
+ *		   Lookups can run on recording threads while the OpenGL thread
+ *		   emplace or release ressources, ForEach must run on one thread.
+ * @template RessourceType : Type of ressource stored by the pool.
+ **/
+template<typename RessourceType>
+class GlwRessourcePool final {
+
+public:
+	static const uint32_t IndexBits	      = 20;
+	static const uint32_t IndexMask	      = ( 1u << IndexBits ) - 1;
+	static const uint32_t GenerationMask  = ( 1u << ( 32 - IndexBits ) ) - 1;
+	static const uint32_t PageSize		  = 256;
+	static const uint32_t MaxCapacity	  = IndexMask;
+
+private:
+	struct Page {
+
+		RessourceType Ressources[ PageSize ];
+		uint32_t Generations[ PageSize ];
+		bool Alive[ PageSize ];
+
+	};
+
+private:
+	mutable std::shared_mutex m_mutex;
+	std::vector<std::unique_ptr<Page>> m_pages;
+	std::deque<uint32_t> m_free;
+	uint32_t m_capacity;
+	uint32_t m_count;
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwRessourcePool( )
+		: m_mutex{ },
+		m_pages{ },
+		m_free{ },
+		m_capacity{ 0 },
+		m_count{ 0 }
+	{ };
+
+	/**
+	 * Destructor
+	 **/
+	~GlwRessourcePool( ) = default;
+
+	/**
+	 * Emplace function
+	 * @note : Store a ressource in a free slot, reuse the oldest released slot first.
+	 * @param ressource : Query ressource to store.
+	 * @param handle : Store the handle of the stored ressource.
+	 * @return : True when a slot was available.
+	 **/
+	bool Emplace( const RessourceType& ressource, glw_ressource& handle ) {
+		auto lock  = std::unique_lock<std::shared_mutex>{ m_mutex };
+		auto index = (uint32_t)0;
+
+		if ( m_free.size( ) > 0 ) {
+			index = m_free.front( );
+
+			m_free.pop_front( );
+		} else {
+			if ( m_capacity == MaxCapacity )
+				return false;
+
+			if ( m_capacity % PageSize == 0 ) {
+				auto page = std::make_unique<Page>( );
+
+				for ( auto slot = (uint32_t)0; slot < PageSize; slot++ ) {
+					page->Generations[ slot ] = 0;
+					page->Alive[ slot ]		  = false;
+				}
+
+				m_pages.emplace_back( std::move( page ) );
+			}
+
+			index = m_capacity++;
+		}
+
+		auto& page = *m_pages[ index / PageSize ];
+		auto slot  = index % PageSize;
+
+		page.Ressources[ slot ] = ressource;
+		page.Alive[ slot ]		= true;
+
+		handle   = GetHandle( index, page.Generations[ slot ] );
+		m_count += 1;
+
+		return true;
+	};
+
+	/**
+	 * Release function
+	 * @note : Destroy a ressource and release its slot for reuse, unless its
+	 *		   generation is exhausted.
+	 * @param handle : Query ressource handle.
+	 * @return : True when the handle was valid.
+	 **/
+	bool Release( const glw_ressource handle ) {
+		auto lock = std::unique_lock<std::shared_mutex>{ m_mutex };
+
+		if ( !GetIsAlive( handle ) )
+			return false;
+
+		auto index = handle & IndexMask;
+		auto& page = *m_pages[ index / PageSize ];
+		auto slot  = index % PageSize;
+
+		page.Ressources[ slot ].Destroy( );
+
+		page.Alive[ slot ]		 = false;
+		page.Generations[ slot ] = page.Generations[ slot ] + 1;
+
+		if ( page.Generations[ slot ] < GenerationMask )
+			m_free.emplace_back( index );
+
+		m_count -= 1;
+
+		return true;
+	};
+
+	/**
+	 * Clear method
+	 * @note : Destroy all ressources and invalidate all handles.
+	 **/
+	void Clear( ) {
+		ForEach( [ this ]( const glw_ressource handle, RessourceType& ressource ) { 
+			Release( handle ); 
+		} );
+	};
+
+public:
+	/**
+	 * ForEach template method
+	 * @note : Call query callback for each alive ressource.
+	 * @template Callback : Callable as void( glw_ressource, RessourceType& ).
+	 * @param callback : Query callback.
+	 **/
+	template<typename Callback>
+	void ForEach( Callback&& callback ) {
+		for ( auto index = (uint32_t)0; index < m_capacity; index++ ) {
+			auto& page = *m_pages[ index / PageSize ];
+			auto slot  = index % PageSize;
+
+			if ( page.Alive[ slot ] )
+				callback( GetHandle( index, page.Generations[ slot ] ), page.Ressources[ slot ] );
+		}
+	};
+
+public:
+	/**
+	 * GetCount const function
+	 * @note : Get alive ressource count.
+	 * @return : Return alive ressource count value.
+	 **/
+	uint32_t GetCount( ) const {
+		auto lock = std::shared_lock<std::shared_mutex>{ m_mutex };
+
+		return m_count;
+	};
+
+	/**
+	 * GetExist const function
+	 * @note : Get if a handle reference an alive ressource.
+	 * @param handle : Query ressource handle.
+	 * @return : Return true when handle is alive and not stale.
+	 **/
+	bool GetExist( const glw_ressource handle ) const {
+		auto lock = std::shared_lock<std::shared_mutex>{ m_mutex };
+
+		return GetIsAlive( handle );
+	};
+
+	/**
+	 * Get function
+	 * @note : Get ressource instance.
+	 * @param handle : Query ressource handle.
+	 * @return : Return pointer to ressource instance or nullptr for stale handle.
+	 **/
+	RessourceType* Get( const glw_ressource handle ) {
+		auto lock       = std::shared_lock<std::shared_mutex>{ m_mutex };
+		auto* ressource = (RessourceType*)nullptr;
+
+		if ( GetIsAlive( handle ) ) {
+			auto index = handle & IndexMask;
+
+			ressource = &m_pages[ index / PageSize ]->Ressources[ index % PageSize ];
+		}
+
+		return ressource;
+	};
+
+	/**
+	 * Get const function
+	 * @note : Get ressource instance.
+	 * @param handle : Query ressource handle.
+	 * @return : Return constant pointer to ressource instance or nullptr for stale handle.
+	 **/
+	const RessourceType* Get( const glw_ressource handle ) const {
+		auto lock       = std::shared_lock<std::shared_mutex>{ m_mutex };
+		auto* ressource = (const RessourceType*)nullptr;
+
+		if ( GetIsAlive( handle ) ) {
+			auto index = handle & IndexMask;
+
+			ressource = &m_pages[ index / PageSize ]->Ressources[ index % PageSize ];
+		}
+
+		return ressource;
+	};
+
+	/**
+	 * GetIndex static function
+	 * @note : Get slot index of a handle, stable for the ressource lifetime.
+	 * @param handle : Query ressource handle.
+	 * @return : Return handle slot index value.
+	 **/
+	static uint32_t GetIndex( const glw_ressource handle ) {
+		return handle & IndexMask;
+	};
+
+private:
+	/**
+	 * GetIsAlive const function
+	 * @note : Get if a handle reference an alive ressource, caller hold the lock.
+	 * @param handle : Query ressource handle.
+	 * @return : Return true when handle is alive and not stale.
+	 **/
+	bool GetIsAlive( const glw_ressource handle ) const {
+		auto index = handle & IndexMask;
+
+		if ( index >= m_capacity )
+			return false;
+
+		auto& page = *m_pages[ index / PageSize ];
+		auto slot  = index % PageSize;
+
+		return page.Alive[ slot ] && page.Generations[ slot ] == ( handle >> IndexBits );
+	};
+
+	/**
+	 * GetHandle static function
+	 * @note : Build handle from slot index and generation.
+	 * @param index : Query slot index.
+	 * @param generation : Query slot generation.
+	 * @return : Return handle value.
+	 **/
+	static glw_ressource GetHandle( const uint32_t index, const uint32_t generation ) {
+		return ( generation << IndexBits ) | index;
+	};
+
+};
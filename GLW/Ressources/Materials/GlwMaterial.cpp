@@ -35,68 +35,121 @@
 //      === PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 GlwMaterial::GlwMaterial( )
-    : m_program_id{ GL_NULL } 
+    : m_program_id{ GL_NULL },
+    m_state{ GlwMaterialStates::Invalid },
+    m_state_tracker{ nullptr },
+    m_uniforms{ },
+    m_blocks{ },
+    m_storages{ },
+    m_is_compute{ false },
+    m_work_group_size{ 0 },
+    m_shaders{ GL_SHADER_NULL, GL_SHADER_NULL, GL_SHADER_NULL },
+    m_cache{ nullptr },
+    m_key{ 0 },
+    m_start{ }
 { }
 
 bool GlwMaterial::Create( const GlwMaterialSpecification& specification ) {
-    auto shader_vert = GL_SHADER_NULL;
-    auto shader_frag = GL_SHADER_NULL;
-    auto shader_geom = GL_SHADER_NULL;
-    auto result      = false;
-
-    if (
-        specification.GetIsValid( )                                    &&
-        Compile( GL_VERTEX_SHADER, specification.Vertex, shader_vert ) &&
-        Compile( GL_FRAGMENT_SHADER, specification.Fragment, shader_frag )
-    ) {
-        if ( GetIsSourceValid( specification.Geometry ) )
-            Compile( GL_GEOMETRY_SHADER, specification.Geometry, shader_geom );
+    m_is_compute = specification.GetIsCompute( );
+
+    return Build( specification, false );
+}
+
+bool GlwMaterial::Create( const GlwMaterialSpecification& specification, GlwProgramCache& cache ) {
+    if ( !specification.GetIsValid( ) )
+        return false;
+
+    m_is_compute = specification.GetIsCompute( );
+
+    auto key    = cache.GetKey( specification );
+    auto result = cache.Load( key, m_program_id );
+
+    if ( result ) {
+        Reflect( );
 
-        result = Link( shader_vert, shader_frag, shader_geom );
+        m_state = GlwMaterialStates::Ready;
+    } else {
+        auto start = std::chrono::steady_clock::now( );
 
-        glDeleteShader( shader_vert );
-        glDeleteShader( shader_frag );
+        result = Build( specification, cache.GetIsEnabled( ) );
 
-        if ( glIsValid( shader_geom ) )
-            glDeleteShader( shader_geom );
+        if ( result )
+            cache.Store( key, m_program_id, GlwProgramCache::GetElapsed( start ) );
     }
 
     return result;
 }
 
+bool GlwMaterial::Submit( const GlwMaterialSpecification& specification ) {
+    m_cache      = nullptr;
+    m_is_compute = specification.GetIsCompute( );
+
+    return Enqueue( specification, false );
+}
+
+bool GlwMaterial::Submit( const GlwMaterialSpecification& specification, GlwProgramCache& cache ) {
+    if ( !specification.GetIsValid( ) )
+        return false;
+
+    m_is_compute = specification.GetIsCompute( );
+
+    auto key = cache.GetKey( specification );
+
+    if ( cache.Load( key, m_program_id ) ) {
+        Reflect( );
+
+        m_state = GlwMaterialStates::Ready;
+
+        return true;
+    }
+
+    m_cache = &cache;
+    m_key   = key;
+    m_start = std::chrono::steady_clock::now( );
+
+    return Enqueue( specification, cache.GetIsEnabled( ) );
+}
+
+bool GlwMaterial::Poll( ) {
+    if ( m_state == GlwMaterialStates::Pending && GetIsCompleted( ) )
+        Resolve( );
+
+    return GetIsReady( );
+}
+
 void GlwMaterial::SetUniform( const int32_t location, const int32_t scalar ) {
     if ( !GetIsLocationValid( location ) )
         return;
 
-    glUniform1i( location, scalar );
+    glProgramUniform1i( m_program_id, location, scalar );
 }
 
 void GlwMaterial::SetUniform( const int32_t location, const float scalar ) {
     if ( !GetIsLocationValid( location ) )
         return;
 
-    glUniform1f( location, scalar );
+    glProgramUniform1f( m_program_id, location, scalar );
 }
 
 void GlwMaterial::SetUniform( const int32_t location, const glm::vec2& vector ) {
     if ( !GetIsLocationValid( location ) )
         return;
 
-    glUniform2f( location, vector.x, vector.y );
+    glProgramUniform2f( m_program_id, location, vector.x, vector.y );
 }
 
 void GlwMaterial::SetUniform( const int32_t location, const glm::vec3& vector ) {
     if ( !GetIsLocationValid( location ) )
         return;
 
-    glUniform3f( location, vector.x, vector.y, vector.z );
+    glProgramUniform3f( m_program_id, location, vector.x, vector.y, vector.z );
 }
 
 void GlwMaterial::SetUniform( const int32_t location, const glm::vec4& vector ) {
     if ( !GetIsLocationValid( location ) )
         return;
 
-    glUniform4f( location, vector.x, vector.y, vector.z, vector.w );
+    glProgramUniform4f( m_program_id, location, vector.x, vector.y, vector.z, vector.w );
 }
 
 void GlwMaterial::SetUniform( const int32_t location, const glm::mat3& matrix ) {
@@ -105,7 +158,7 @@ void GlwMaterial::SetUniform( const int32_t location, const glm::mat3& matrix )
 
     auto* gl_matrix = glm::value_ptr( matrix );
 
-    glUniformMatrix3fv( location, 1, GL_FALSE, gl_matrix );
+    glProgramUniformMatrix3fv( m_program_id, location, 1, GL_FALSE, gl_matrix );
 }
 
 void GlwMaterial::SetUniform( const int32_t location, const glm::mat4& matrix ) {
@@ -114,7 +167,7 @@ void GlwMaterial::SetUniform( const int32_t location, const glm::mat4& matrix )
 
     auto* gl_matrix = glm::value_ptr( matrix );
 
-    glUniformMatrix4fv( location, 1, GL_FALSE, gl_matrix );
+    glProgramUniformMatrix4fv( m_program_id, location, 1, GL_FALSE, gl_matrix );
 }
 
 void GlwMaterial::SetUniform( const std::string& name, const int32_t scalar ) {
@@ -159,13 +212,55 @@ void GlwMaterial::SetUniform( const std::string& name, const glm::mat4& matrix )
     SetUniform( location, matrix );
 }
 
+void GlwMaterial::SetUniform( const GlwUniformHash hash, const int32_t scalar ) {
+    auto location = GetUniformLocation( hash );
+
+    SetUniform( location, scalar );
+}
+
+void GlwMaterial::SetUniform( const GlwUniformHash hash, const float scalar ) {
+    auto location = GetUniformLocation( hash );
+
+    SetUniform( location, scalar );
+}
+
+void GlwMaterial::SetUniform( const GlwUniformHash hash, const glm::vec2& vector ) {
+    auto location = GetUniformLocation( hash );
+
+    SetUniform( location, vector );
+}
+
+void GlwMaterial::SetUniform( const GlwUniformHash hash, const glm::vec3& vector ) {
+    auto location = GetUniformLocation( hash );
+
+    SetUniform( location, vector );
+}
+
+void GlwMaterial::SetUniform( const GlwUniformHash hash, const glm::vec4& vector ) {
+    auto location = GetUniformLocation( hash );
+
+    SetUniform( location, vector );
+}
+
+void GlwMaterial::SetUniform( const GlwUniformHash hash, const glm::mat3& matrix ) {
+    auto location = GetUniformLocation( hash );
+
+    SetUniform( location, matrix );
+}
+
+void GlwMaterial::SetUniform( const GlwUniformHash hash, const glm::mat4& matrix ) {
+    auto location = GetUniformLocation( hash );
+
+    SetUniform( location, matrix );
+}
+
 void GlwMaterial::SetUniformBuffer( const int32_t location, const GlwBuffer& buffer ) {
-    if ( !GetIsLocationValid( location) || !buffer.GetIsValid( ) || buffer.GetType( ) != GlwBufferTypes::Uniform )
+    if ( !buffer.GetIsValid( ) || buffer.GetType( ) != GlwBufferTypes::Uniform || !SetUniformBlockBinding( location ) )
         return;
 
     auto gl_buffer = buffer.Get( );
 
-    glUniformBlockBinding( m_program_id, gl_buffer, location );
+    glBindBufferBase( GL_UNIFORM_BUFFER, location, gl_buffer );
 }
 
 void GlwMaterial::SetUniformBuffer( const std::string& name, const GlwBuffer& buffer ) {
@@ -174,49 +269,205 @@ void GlwMaterial::SetUniformBuffer( const std::string& name, const GlwBuffer& bu
     SetUniformBuffer( location, buffer );
 }
 
+void GlwMaterial::SetUniformBuffer( const GlwUniformHash hash, const GlwBuffer& buffer ) {
+    auto location = GetBufferLocation( hash );
+
+    SetUniformBuffer( location, buffer );
+}
+
+bool GlwMaterial::SetUniformBlockBinding( const int32_t location ) {
+    auto result = GetIsLocationValid( location );
+
+    if ( result )
+        glUniformBlockBinding( m_program_id, location, location );
+
+    return result;
+}
+
 void GlwMaterial::SetTexture( 
     const uint32_t slot,
-    const GlwTextureTypes type,
     const GlwTextureFormats format,
     const glTexture texture
 ) {
     if ( !glIsValid( texture ) )
         return;
 
-    auto gl_type = GetTextureType( type );
     auto gl_mode = GetTextureMode( format );
 
-    glActiveTexture( GL_TEXTURE0 + slot );
-    glBindTexture( gl_type, texture );
-
     if ( gl_mode > 0 )
-        glTexParameteri( gl_type, GL_DEPTH_STENCIL_TEXTURE_MODE, gl_mode );
+        glTextureParameteri( texture, GL_DEPTH_STENCIL_TEXTURE_MODE, gl_mode );
+
+    if ( m_state_tracker != nullptr )
+        m_state_tracker->UseTexture( slot, texture );
+    else
+        glBindTextureUnit( slot, texture );
 }
 
-GlwMaterial* GlwMaterial::Use( ) {
-    glUseProgram( m_program_id );
+GlwMaterial* GlwMaterial::Use( GlwStateTracker& state_tracker ) {
+    m_state_tracker = &state_tracker;
+
+    state_tracker.UseProgram( m_program_id );
 
     return this;
 }
 
 void GlwMaterial::Destroy( ) {
-    if ( GetIsValid( ) )
+    if ( GetIsValid( ) ) {
         glDeleteProgram( m_program_id );
+
+        m_program_id = GL_NULL;
+    }
+
+    Release( );
+
+    m_state = GlwMaterialStates::Invalid;
+    m_cache = nullptr;
+
+    m_uniforms.Clear( );
+    m_blocks.Clear( );
+    m_storages.Clear( );
+
+    m_is_compute      = false;
+    m_work_group_size = glm::uvec3{ 0 };
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 //      === PRIVATE ===
 ////////////////////////////////////////////////////////////////////////////////////////////
-bool GlwMaterial::Compile( const uint32_t type, const std::vector<char>& source, glShader& shader_id ) {
+bool GlwMaterial::Build( const GlwMaterialSpecification& specification, const bool is_retrievable ) {
+    glShader shaders[ 3 ] = { GL_SHADER_NULL, GL_SHADER_NULL, GL_SHADER_NULL };
+
+    auto result = specification.GetIsValid( );
+
+    if ( result && specification.GetIsCompute( ) )
+        result = Compile( GL_COMPUTE_SHADER, specification.Compute, shaders[ 0 ] );
+    else if ( result ) {
+        result =
+            Compile( GL_VERTEX_SHADER, specification.Vertex, shaders[ 0 ] ) &&
+            Compile( GL_FRAGMENT_SHADER, specification.Fragment, shaders[ 1 ] );
+
+        if ( result && GetIsSourceValid( specification.Geometry ) )
+            Compile( GL_GEOMETRY_SHADER, specification.Geometry, shaders[ 2 ] );
+    }
+
+    if ( result )
+        result = Link( shaders, is_retrievable );
+
+    for ( auto shader_id : shaders ) {
+        if ( glIsValid( shader_id ) )
+            glDeleteShader( shader_id );
+    }
+
+    m_state = result ? GlwMaterialStates::Ready : GlwMaterialStates::Failed;
+
+    return result;
+}
+
+bool GlwMaterial::Enqueue( const GlwMaterialSpecification& specification, const bool is_retrievable ) {
+    if ( !specification.GetIsValid( ) )
+        return false;
+
+    if ( specification.GetIsCompute( ) )
+        Queue( GL_COMPUTE_SHADER, specification.Compute, m_shaders[ 0 ] );
+    else {
+        Queue( GL_VERTEX_SHADER, specification.Vertex, m_shaders[ 0 ] );
+        Queue( GL_FRAGMENT_SHADER, specification.Fragment, m_shaders[ 1 ] );
+
+        if ( GetIsSourceValid( specification.Geometry ) )
+            Queue( GL_GEOMETRY_SHADER, specification.Geometry, m_shaders[ 2 ] );
+    }
+
+    Attach( m_shaders, is_retrievable );
+
+    m_state = GlwMaterialStates::Pending;
+
+    return true;
+}
+
+void GlwMaterial::Queue( const uint32_t type, const std::vector<char>& source, glShader& shader_id ) {
+    auto* source_data = source.data( );
+
+    shader_id = glCreateShader( type );
+
+    glShaderSource( shader_id, 1, &source_data, NULL );
+    glCompileShader( shader_id );
+}
+
+void GlwMaterial::Attach( const glShader shaders[ 3 ], const bool is_retrievable ) {
+    m_program_id = glCreateProgram( );
+
+    if ( is_retrievable )
+        glProgramParameteri( m_program_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+
+    for ( auto i = (uint32_t)0; i < 3; i++ ) {
+        if ( glIsValid( shaders[ i ] ) )
+            glAttachShader( m_program_id, shaders[ i ] );
+    }
+
+    glLinkProgram( m_program_id );
+}
+
+void GlwMaterial::Resolve( ) {
     auto result = GL_FALSE;
 
-    if ( GetIsSourceValid( source ) ) {
-        auto* source_data = source.data( );
+    glGetProgramiv( m_program_id, GL_LINK_STATUS, &result );
+
+#   ifdef _DEBUG
+    if ( !result ) {
+        char gl_log_data[ 512 ];
+
+        for ( auto shader_id : m_shaders ) {
+            auto status = GL_TRUE;
+
+            if ( glIsValid( shader_id ) )
+                glGetShaderiv( shader_id, GL_COMPILE_STATUS, &status );
+
+            if ( status )
+                continue;
+
+            glGetShaderInfoLog( shader_id, 512, NULL, gl_log_data );
+            printf( "[ GL - ERROR ] Shader Compilation :\n%s\n", gl_log_data );
+        }
 
-        shader_id = glCreateShader( type );
+        glGetProgramInfoLog( m_program_id, 512, NULL, gl_log_data );
+        printf( "[ GL - ERROR ] Shader Linking :\n%s\n", gl_log_data );
+    }
+#   endif
 
-        glShaderSource( shader_id, 1, &source_data, NULL );
-        glCompileShader( shader_id );
+    Release( );
+
+    if ( result == GL_TRUE ) {
+        Reflect( );
+
+        m_state = GlwMaterialStates::Ready;
+
+        if ( m_cache != nullptr )
+            m_cache->Store( m_key, m_program_id, GlwProgramCache::GetElapsed( m_start ) );
+    } else
+        m_state = GlwMaterialStates::Failed;
+
+    m_cache = nullptr;
+}
+
+void GlwMaterial::Release( ) {
+    for ( auto& shader_id : m_shaders ) {
+        if ( !glIsValid( shader_id ) )
+            continue;
+
+        if ( glIsValid( m_program_id ) )
+            glDetachShader( m_program_id, shader_id );
+
+        glDeleteShader( shader_id );
+
+        shader_id = GL_SHADER_NULL;
+    }
+}
+
+bool GlwMaterial::Compile( const uint32_t type, const std::vector<char>& source, glShader& shader_id ) {
+    auto result = GL_FALSE;
+
+    if ( GetIsSourceValid( source ) ) {
+        Queue( type, source, shader_id );
 
         glGetShaderiv( shader_id, GL_COMPILE_STATUS, &result );
 
@@ -234,21 +485,14 @@ bool GlwMaterial::Compile( const uint32_t type, const std::vector<char>& source,
     return result == GL_TRUE;
 }
 
-bool GlwMaterial::Link( const glShader shader_vert, const glShader shader_frag, const glShader shader_geom ) {
+bool GlwMaterial::Link( const glShader shaders[ 3 ], const bool is_retrievable ) {
     auto result = GL_FALSE;
 
-    m_program_id = glCreateProgram( );
+    Attach( shaders, is_retrievable );
 
-    glAttachShader( m_program_id, shader_vert );
-    glAttachShader( m_program_id, shader_frag );
-
-    if ( glIsValid( shader_geom ) )
-        glAttachShader( m_program_id, shader_geom );
-
-    glLinkProgram( m_program_id );
+    glGetProgramiv( m_program_id, GL_LINK_STATUS, &result );
 
 #   ifdef _DEBUG
-    glGetProgramiv( m_program_id, GL_LINK_STATUS, &result );
     if ( !result ) {
         char gl_log_data[ 512 ];
 
@@ -257,9 +501,81 @@ bool GlwMaterial::Link( const glShader shader_vert, const glShader shader_frag,
     }
 #   endif
 
+    if ( result == GL_TRUE )
+        Reflect( );
+
     return result == GL_TRUE;
 }
 
+void GlwMaterial::Reflect( ) {
+    m_uniforms.Clear( );
+    m_blocks.Clear( );
+    m_storages.Clear( );
+
+    Reflect( GL_UNIFORM, m_uniforms );
+    Reflect( GL_UNIFORM_BLOCK, m_blocks );
+    Reflect( GL_SHADER_STORAGE_BLOCK, m_storages );
+
+    if ( m_is_compute ) {
+        GLint work_group_size[ 3 ] = { 0, 0, 0 };
+
+        glGetProgramiv( m_program_id, GL_COMPUTE_WORK_GROUP_SIZE, work_group_size );
+
+        m_work_group_size.x = (uint32_t)work_group_size[ 0 ];
+        m_work_group_size.y = (uint32_t)work_group_size[ 1 ];
+        m_work_group_size.z = (uint32_t)work_group_size[ 2 ];
+    }
+}
+
+void GlwMaterial::Reflect( const uint32_t gl_interface, GlwUniformTable& table ) {
+    auto count      = GLint{ 0 };
+    auto max_length = GLint{ 0 };
+
+    glGetProgramInterfaceiv( m_program_id, gl_interface, GL_ACTIVE_RESOURCES, &count );
+    glGetProgramInterfaceiv( m_program_id, gl_interface, GL_MAX_NAME_LENGTH, &max_length );
+
+    auto name = std::vector<char>( (size_t)max_length + 1, '\0' );
+
+    for ( auto resource = (GLuint)0; resource < (GLuint)count; resource++ ) {
+        auto length = GLsizei{ 0 };
+        auto entry  = GlwUniformEntry{ };
+
+        glGetProgramResourceName( m_program_id, gl_interface, resource, (GLsizei)name.size( ), &length, name.data( ) );
+
+        if ( gl_interface == GL_UNIFORM ) {
+            const GLenum properties[ 3 ] = { GL_LOCATION, GL_TYPE, GL_ARRAY_SIZE };
+            GLint values[ 3 ] = { -1, GL_NONE, 0 };
+
+            glGetProgramResourceiv( m_program_id, gl_interface, resource, 3, properties, 3, NULL, values );
+
+            entry = GlwUniformEntry{ GlwUniformHash{ name.data( ), (uint32_t)length }, values[ 0 ], (uint32_t)values[ 1 ], (uint32_t)values[ 2 ] };
+        } else {
+            const GLenum properties[ 1 ] = { GL_BUFFER_DATA_SIZE };
+            GLint values[ 1 ] = { 0 };
+
+            glGetProgramResourceiv( m_program_id, gl_interface, resource, 1, properties, 1, NULL, values );
+
+            entry = GlwUniformEntry{ GlwUniformHash{ name.data( ), (uint32_t)length }, (int32_t)resource, gl_interface, (uint32_t)values[ 0 ] };
+        }
+
+        if ( !entry.GetIsValid( ) )
+            continue;
+
+        auto is_inserted = table.Insert( entry );
+
+        if ( length > 3 && std::strncmp( name.data( ) + length - 3, "[0]", 3 ) == 0 ) {
+            entry.Hash = GlwUniformHash{ name.data( ), (uint32_t)length - 3 };
+
+            is_inserted = table.Insert( entry ) && is_inserted;
+        }
+
+#       ifdef _DEBUG
+        if ( !is_inserted )
+            printf( "[ GL - WARNING ] Uniform name hash collision : %s\n", name.data( ) );
+#       endif
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //      === PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -267,10 +583,24 @@ bool GlwMaterial::GetIsValid( ) const {
     return glIsValid( m_program_id );
 }
 
-int32_t GlwMaterial::GetUniformLocation( const std::string& name ) const {
-    auto* _name = name.c_str( );
+GlwMaterialStates GlwMaterial::GetState( ) const {
+    return m_state;
+}
 
-    return glGetUniformLocation( m_program_id, _name );
+bool GlwMaterial::GetIsReady( ) const {
+    return m_state == GlwMaterialStates::Ready;
+}
+
+bool GlwMaterial::GetIsCompute( ) const {
+    return m_is_compute;
+}
+
+const glm::uvec3& GlwMaterial::GetWorkGroupSize( ) const {
+    return m_work_group_size;
+}
+
+int32_t GlwMaterial::GetUniformLocation( const std::string& name ) const {
+    return m_uniforms.GetLocation( GlwUniformHash{ name } );
 }
 
 bool GlwMaterial::GetUniformLocation( const std::string& name, int32_t& location ) const {
@@ -279,10 +609,18 @@ bool GlwMaterial::GetUniformLocation( const std::string& name, int32_t& location
     return GetIsLocationValid( location );
 }
 
-int32_t GlwMaterial::GetBufferLocation( const std::string& name ) const {
-    auto* _name = name.c_str( );
+int32_t GlwMaterial::GetUniformLocation( const GlwUniformHash hash ) const {
+    return m_uniforms.GetLocation( hash );
+}
+
+bool GlwMaterial::GetUniformLocation( const GlwUniformHash hash, int32_t& location ) const {
+    location = GetUniformLocation( hash );
 
-    return glGetUniformBlockIndex( m_program_id, _name );
+    return GetIsLocationValid( location );
+}
+
+int32_t GlwMaterial::GetBufferLocation( const std::string& name ) const {
+    return m_blocks.GetLocation( GlwUniformHash{ name } );
 }
 
 bool GlwMaterial::GetBufferLocation( const std::string& name, int32_t& location ) const {
@@ -291,10 +629,32 @@ bool GlwMaterial::GetBufferLocation( const std::string& name, int32_t& location
     return GetIsLocationValid( location );
 }
 
+int32_t GlwMaterial::GetBufferLocation( const GlwUniformHash hash ) const {
+    return m_blocks.GetLocation( hash );
+}
+
+bool GlwMaterial::GetBufferLocation( const GlwUniformHash hash, int32_t& location ) const {
+    location = GetBufferLocation( hash );
+
+    return GetIsLocationValid( location );
+}
+
 bool GlwMaterial::GetIsLocationValid( const int32_t location ) const {
     return location > -1;
 }
 
+const GlwUniformTable& GlwMaterial::GetUniforms( ) const {
+    return m_uniforms;
+}
+
+const GlwUniformTable& GlwMaterial::GetBlocks( ) const {
+    return m_blocks;
+}
+
+const GlwUniformTable& GlwMaterial::GetStorages( ) const {
+    return m_storages;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //      === PRIVATE GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -302,18 +662,6 @@ bool GlwMaterial::GetIsSourceValid( const std::vector<char>& source ) {
     return source.size( ) > 0;
 }
 
-uint32_t GlwMaterial::GetTextureType( const GlwTextureTypes type ) const {
-    auto result = GL_TEXTURE_2D;
-
-    switch ( type ) {
-        case GlwTextureTypes::Cubemap : result = GL_TEXTURE_CUBE_MAP; break;
-
-        default: break;
-    }
-
-    return result;
-}
-
 uint32_t GlwMaterial::GetTextureMode( const GlwTextureFormats format ) const {
     auto result = 0;
 
@@ -327,6 +675,15 @@ uint32_t GlwMaterial::GetTextureMode( const GlwTextureFormats format ) const {
     return result;
 }
 
+bool GlwMaterial::GetIsCompleted( ) const {
+    auto result = GL_TRUE;
+
+    if ( GLEW_KHR_parallel_shader_compile || GLEW_ARB_parallel_shader_compile )
+        glGetProgramiv( m_program_id, GL_COMPLETION_STATUS_KHR, &result );
+
+    return result == GL_TRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	OPERATOR ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -335,6 +692,18 @@ GlwMaterial& GlwMaterial::operator=( const GlwMaterial& other ) {
         Destroy( );
 
         m_program_id = other.m_program_id;
+        m_state      = other.m_state;
+        m_uniforms   = other.m_uniforms;
+        m_blocks     = other.m_blocks;
+        m_storages   = other.m_storages;
+        m_is_compute = other.m_is_compute;
+        m_cache      = other.m_cache;
+        m_key        = other.m_key;
+        m_start      = other.m_start;
+
+        m_work_group_size = other.m_work_group_size;
+
+        std::memcpy( m_shaders, other.m_shaders, sizeof( m_shaders ) );
     }
 
     return *this;
@@ -31,12 +31,23 @@
 
 #pragma once
 
-#include "GlwMaterialSpecification.h"
+#include "GlwMaterialTemplate.h"
 
 class GlwMaterial : public GlwRessource<GlwMaterialSpecification> {
 
 private:
     glProgram m_program_id;
+    GlwMaterialStates m_state;
+    GlwStateTracker* m_state_tracker;
+    GlwUniformTable m_uniforms;
+    GlwUniformTable m_blocks;
+    GlwUniformTable m_storages;
+    bool m_is_compute;
+    glm::uvec3 m_work_group_size;
+    glShader m_shaders[ 3 ];
+    GlwProgramCache* m_cache;
+    uint64_t m_key;
+    std::chrono::steady_clock::time_point m_start;
 
 public:
     /**
@@ -57,6 +68,48 @@ public:
      **/
     virtual bool Create( const GlwMaterialSpecification& specification ) override;
 
+    /**
+     * Create function
+     * @note : Create material according to query specification, the program
+     *         binary is loaded from query cache when present and stored to it
+     *         after a successful compilation otherwise.
+     * @param specification : Query material specification.
+     * @param cache : Query program binary cache.
+     * @return : True when creation succeeded.
+     **/
+    bool Create( const GlwMaterialSpecification& specification, GlwProgramCache& cache );
+
+    /**
+     * Submit function
+     * @note : Submit every compile and the link of query specification without
+     *         waiting on the driver, material stay pending until Poll report it
+     *         ready. With GL_KHR_parallel_shader_compile the driver compile on
+     *         its own threads, otherwise the first Poll wait for completion.
+     * @param specification : Query material specification.
+     * @return : True when submission succeeded.
+     **/
+    bool Submit( const GlwMaterialSpecification& specification );
+
+    /**
+     * Submit function
+     * @note : Submit material like Submit( specification ), a cached program
+     *         binary is loaded instead when present and the material is ready
+     *         immediately.
+     * @param specification : Query material specification.
+     * @param cache : Query program binary cache.
+     * @return : True when submission succeeded.
+     **/
+    bool Submit( const GlwMaterialSpecification& specification, GlwProgramCache& cache );
+
+    /**
+     * Poll function
+     * @note : Resolve a pending material once the driver completed it, never
+     *         block when completion status can be queried. Must be called from
+     *         the thread owning the OpenGL context.
+     * @return : Return true when material is ready.
+     **/
+    bool Poll( );
+
     /**
      * SetUniform method
      * @note : Set material uniform value.
@@ -169,9 +222,67 @@ public:
      **/
     void SetUniform( const std::string& name, const glm::mat4& matrix );
 
+    /**
+     * SetUniform method
+     * @note : Set material uniform value without querying the driver.
+     * @param hash : Query material uniform name hash.
+     * @param scalar : Query uniform value.
+     **/
+    void SetUniform( const GlwUniformHash hash, const int32_t scalar );
+
+    /**
+     * SetUniform method
+     * @note : Set material uniform value without querying the driver.
+     * @param hash : Query material uniform name hash.
+     * @param scalar : Query uniform value.
+     **/
+    void SetUniform( const GlwUniformHash hash, const float scalar );
+
+    /**
+     * SetUniform method
+     * @note : Set material uniform value without querying the driver.
+     * @param hash : Query material uniform name hash.
+     * @param vector : Query uniform value.
+     **/
+    void SetUniform( const GlwUniformHash hash, const glm::vec2& vector );
+
+    /**
+     * SetUniform method
+     * @note : Set material uniform value without querying the driver.
+     * @param hash : Query material uniform name hash.
+     * @param vector : Query uniform value.
+     **/
+    void SetUniform( const GlwUniformHash hash, const glm::vec3& vector );
+
+    /**
+     * SetUniform method
+     * @note : Set material uniform value without querying the driver.
+     * @param hash : Query material uniform name hash.
+     * @param vector : Query uniform value.
+     **/
+    void SetUniform( const GlwUniformHash hash, const glm::vec4& vector );
+
+    /**
+     * SetUniform method
+     * @note : Set material uniform value without querying the driver.
+     * @param hash : Query material uniform name hash.
+     * @param matrix : Query uniform value.
+     **/
+    void SetUniform( const GlwUniformHash hash, const glm::mat3& matrix );
+
+    /**
+     * SetUniform method
+     * @note : Set material uniform value without querying the driver.
+     * @param hash : Query material uniform name hash.
+     * @param matrix : Query uniform value.
+     **/
+    void SetUniform( const GlwUniformHash hash, const glm::mat4& matrix );
+
     /**
      * SetUniformBuffer method
-     * @note : Set material uniform value.
+     * @note : Set material uniform value, the block use its index as binding point.
+     *         Bind is immediate and unseen by the barrier tracker, use
+     *         CmdSetUniformBuffer between draws.
      * @param location : Query material uniform buffer location.
      * @param buffer : Query uniform buffer value.
      **/
@@ -185,27 +296,44 @@ public:
      **/
     void SetUniformBuffer( const std::string& name, const GlwBuffer& buffer );
 
+    /**
+     * SetUniformBuffer method
+     * @note : Set material uniform value without querying the driver.
+     * @param hash : Query material uniform buffer name hash.
+     * @param buffer : Query uniform buffer value.
+     **/
+    void SetUniformBuffer( const GlwUniformHash hash, const GlwBuffer& buffer );
+
+    /**
+     * SetUniformBlockBinding function
+     * @note : Use uniform block index as its binding point.
+     * @param location : Query material uniform buffer location.
+     * @return : True when location is a valid uniform block.
+     **/
+    bool SetUniformBlockBinding( const int32_t location );
+
     /**
      * SetTexture method
-     * @note : Set material texture slot value.
+     * @note : Set material texture slot value. Bind is immediate and unseen
+     *         by the barrier tracker, use CmdUseTexture between draws.
      * @param slot : Query texture slot.
-     * @param type : Query texture type.
      * @param format : Query texture format.
      * @param texture : Query OpenGL texture value.
      **/
     void SetTexture( 
         const uint32_t slot,
-        const GlwTextureTypes type,
         const GlwTextureFormats format,
         const glTexture texture 
     );
 
     /**
      * Use function
-     * @note : Bind material for usage.
+     * @note : Bind material for usage, later texture bindings go through
+     *         the query state tracker.
+     * @param state_tracker : Query current state tracker.
      * @return : Return pointer to current material instance.
      **/
-    GlwMaterial* Use( );
+    GlwMaterial* Use( GlwStateTracker& state_tracker );
 
     /**
      * Destroy method
@@ -214,6 +342,56 @@ public:
     virtual void Destroy( ) override;
 
 private:
+    /**
+     * Build function
+     * @note : Compile and link material from query specification sources.
+     * @param specification : Query material specification.
+     * @param is_retrievable : Query if program binary must be retrievable.
+     * @return : Return true when operation succeeded.
+     **/
+    bool Build( const GlwMaterialSpecification& specification, const bool is_retrievable );
+
+    /**
+     * Enqueue function
+     * @note : Submit compile and link of query specification sources, the
+     *         shaders are kept until Resolve.
+     * @param specification : Query material specification.
+     * @param is_retrievable : Query if program binary must be retrievable.
+     * @return : Return true when operation succeeded.
+     **/
+    bool Enqueue( const GlwMaterialSpecification& specification, const bool is_retrievable );
+
+    /**
+     * Queue method
+     * @note : Submit OpenGL shader compilation without querying its status.
+     * @param type : Shader type value.
+     * @param source : Shader source value.
+     * @param shader_id : Store OpenGL shader value.
+     **/
+    void Queue( const uint32_t type, const std::vector<char>& source, glShader& shader_id );
+
+    /**
+     * Attach method
+     * @note : Create program, attach valid shaders and submit link without
+     *         querying its status.
+     * @param shaders : Query OpenGL shaders, vertex fragment geometry or compute alone.
+     * @param is_retrievable : Query if program binary must be retrievable.
+     **/
+    void Attach( const glShader shaders[ 3 ], const bool is_retrievable );
+
+    /**
+     * Resolve method
+     * @note : Read link status of a completed pending material, reflect it and
+     *         store it in the program cache on success, release its shaders.
+     **/
+    void Resolve( );
+
+    /**
+     * Release method
+     * @note : Detach and delete pending shaders.
+     **/
+    void Release( );
+
     /**
      * Compile function
      * @note : Compile OpenGL shader.
@@ -227,12 +405,27 @@ private:
     /**
      * Link function
      * @note : Link shaders to unique material.
-     * @param shader_vert : OpenGL shader instance.
-     * @param shader_frag : OpenGL shader instance.
-     * @param shader_geom : OpenGL shader instance.
+     * @param shaders : Query OpenGL shaders, vertex fragment geometry or compute alone.
+     * @param is_retrievable : Query if program binary must be retrievable.
      * @return : Return true when operation succeeded.
      **/
-    bool Link( const glShader shader_vert, const glShader shader_frag, const glShader shader_geom );
+    bool Link( const glShader shaders[ 3 ], const bool is_retrievable );
+
+    /**
+     * Reflect method
+     * @note : Fill uniform, uniform block and storage block tables from linked
+     *         program, and work group size of compute materials.
+     **/
+    void Reflect( );
+
+    /**
+     * Reflect method
+     * @note : Fill a table with the active resources of a program interface,
+     *         arrays are also stored without their [0] suffix.
+     * @param gl_interface : Query OpenGL program interface.
+     * @param table : Query table to fill.
+     **/
+    void Reflect( const uint32_t gl_interface, GlwUniformTable& table );
 
 public:
     /**
@@ -250,9 +443,8 @@ public:
 
         auto gl_texture = texture->Get( );
         auto format     = texture->GetFormat( );
-        auto type       = texture->GetType( );
 
-        SetTexture( slot, type, format, gl_texture );
+        SetTexture( slot, format, gl_texture );
     };
 
 public:
@@ -263,9 +455,37 @@ public:
      **/
     virtual bool GetIsValid( ) const override;
 
+    /**
+     * GetState const function
+     * @note : Get material compilation state.
+     * @return : Return m_state value.
+     **/
+    GlwMaterialStates GetState( ) const;
+
+    /**
+     * GetIsReady const function
+     * @note : Get if material is linked and can be used.
+     * @return : Return true when state is ready.
+     **/
+    bool GetIsReady( ) const;
+
+    /**
+     * GetIsCompute const function
+     * @note : Get if material is a compute material.
+     * @return : Return m_is_compute value.
+     **/
+    bool GetIsCompute( ) const;
+
+    /**
+     * GetWorkGroupSize const function
+     * @note : Get compute material local work group size.
+     * @return : Return m_work_group_size value, zero for other materials.
+     **/
+    const glm::uvec3& GetWorkGroupSize( ) const;
+
     /**
      * GetUniformLocation const function
-     * @note : Get uniform location.
+     * @note : Get uniform location from link time table.
      * @param name : Query uniform name.
      * @return : Return OpenGL uniform location value.
      **/
@@ -280,9 +500,26 @@ public:
      **/
     bool GetUniformLocation( const std::string& name, int32_t& location ) const;
 
+    /**
+     * GetUniformLocation const function
+     * @note : Get uniform location from link time table.
+     * @param hash : Query uniform name hash.
+     * @return : Return OpenGL uniform location value, -1 when missing.
+     **/
+    int32_t GetUniformLocation( const GlwUniformHash hash ) const;
+
+    /**
+     * GetUniformLocation const function
+     * @note : Get uniform location from link time table.
+     * @param hash : Query uniform name hash.
+     * @param location : Store OpenGL uniform location value.
+     * @return : Return true when uniform location exist.
+     **/
+    bool GetUniformLocation( const GlwUniformHash hash, int32_t& location ) const;
+
     /**
      * GetBufferLocation const function
-     * @note : Get uniform buffer location.
+     * @note : Get uniform buffer location from link time table.
      * @param name : Query uniform buffer name.
      * @return : Return OpenGL uniform buffer location value.
      **/
@@ -297,6 +534,44 @@ public:
      **/
     bool GetBufferLocation( const std::string& name, int32_t& location ) const;
 
+    /**
+     * GetBufferLocation const function
+     * @note : Get uniform buffer location from link time table.
+     * @param hash : Query uniform buffer name hash.
+     * @return : Return OpenGL uniform buffer location value, -1 when missing.
+     **/
+    int32_t GetBufferLocation( const GlwUniformHash hash ) const;
+
+    /**
+     * GetBufferLocation const function
+     * @note : Get uniform buffer location from link time table.
+     * @param hash : Query uniform buffer name hash.
+     * @param location : Store OpenGL uniform buffer location value.
+     * @return : Return true when uniform buffer location exist.
+     **/
+    bool GetBufferLocation( const GlwUniformHash hash, int32_t& location ) const;
+
+    /**
+     * GetUniforms const function
+     * @note : Get active uniforms, samplers included.
+     * @return : Return constant reference to uniform table.
+     **/
+    const GlwUniformTable& GetUniforms( ) const;
+
+    /**
+     * GetBlocks const function
+     * @note : Get active uniform blocks.
+     * @return : Return constant reference to uniform block table.
+     **/
+    const GlwUniformTable& GetBlocks( ) const;
+
+    /**
+     * GetStorages const function
+     * @note : Get active shader storage blocks.
+     * @return : Return reference to storage block table.
+     **/
+    const GlwUniformTable& GetStorages( ) const;
+
     /**
      * GetIsLocationValid const function
      * @note : Get is a location is valid.
@@ -314,13 +589,6 @@ private:
      **/
     bool GetIsSourceValid( const std::vector<char>& source );
 
-    /**
-     * GetTextureType const function
-     * @note : Get OpenGL texture type.
-     * @return : Return OpenGL texture type value.
-     **/
-    uint32_t GetTextureType( const GlwTextureTypes type ) const;
-
     /**
      * GetTextureMode const function
      * @note : Convert format to OpenGL depth stencil texture mode.
@@ -329,6 +597,14 @@ private:
      **/
     uint32_t GetTextureMode( const GlwTextureFormats format ) const;
 
+    /**
+     * GetIsCompleted const function
+     * @note : Get if driver completed pending material link, always true
+     *         without parallel shader compile support.
+     * @return : Return true when link status can be read without blocking.
+     **/
+    bool GetIsCompleted( ) const;
+
 public:
     /**
      * Assign operator
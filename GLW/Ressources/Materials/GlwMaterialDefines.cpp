@@ -0,0 +1,94 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwMaterialDefines::GlwMaterialDefines( )
+    : m_defines{ }
+{ }
+
+void GlwMaterialDefines::Set( const std::string& name ) {
+    Set( name, "1" );
+}
+
+void GlwMaterialDefines::Set( const std::string& name, const std::string& value ) {
+    auto define = std::lower_bound(
+        m_defines.begin( ), m_defines.end( ), name,
+        []( const GlwShaderDefine& define, const std::string& name ) { return define.Name < name; }
+    );
+
+    if ( define != m_defines.end( ) && define->Name == name )
+        define->Value = value;
+    else
+        m_defines.insert( define, GlwShaderDefine{ name, value } );
+}
+
+bool GlwMaterialDefines::Remove( const std::string& name ) {
+    auto define = std::lower_bound(
+        m_defines.begin( ), m_defines.end( ), name,
+        []( const GlwShaderDefine& define, const std::string& name ) { return define.Name < name; }
+    );
+    auto result = define != m_defines.end( ) && define->Name == name;
+
+    if ( result )
+        m_defines.erase( define );
+
+    return result;
+}
+
+void GlwMaterialDefines::Clear( ) {
+    m_defines.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t GlwMaterialDefines::GetHash( ) const {
+    auto result = GlwProgramCache::HashSeed;
+
+    for ( const auto& define : m_defines ) {
+        result = GlwProgramCache::Hash( result, define.Name.c_str( ), define.Name.size( ) + 1 );
+        result = GlwProgramCache::Hash( result, define.Value.c_str( ), define.Value.size( ) + 1 );
+    }
+
+    return result;
+}
+
+uint32_t GlwMaterialDefines::GetCount( ) const {
+    return (uint32_t)m_defines.size( );
+}
+
+const std::vector<GlwShaderDefine>& GlwMaterialDefines::GetDefines( ) const {
+    return m_defines;
+}
@@ -0,0 +1,108 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwShaderDefine.h"
+
+/**
+ * GlwMaterialDefines final class
+ * @note : Set of preprocessor defines injected in a material template, kept
+ *         sorted by name so the same set always produce the same hash.
+ **/
+class GlwMaterialDefines final {
+
+private:
+    std::vector<GlwShaderDefine> m_defines;
+
+public:
+    /**
+     * Constructor
+     **/
+    GlwMaterialDefines( );
+
+    /**
+     * Destructor
+     **/
+    ~GlwMaterialDefines( ) = default;
+
+    /**
+     * Set method
+     * @note : Add define with value 1 or replace its value.
+     * @param name : Query define name.
+     **/
+    void Set( const std::string& name );
+
+    /**
+     * Set method
+     * @note : Add define or replace its value.
+     * @param name : Query define name.
+     * @param value : Query define value.
+     **/
+    void Set( const std::string& name, const std::string& value );
+
+    /**
+     * Remove function
+     * @note : Remove define.
+     * @param name : Query define name.
+     * @return : Return true when define was present.
+     **/
+    bool Remove( const std::string& name );
+
+    /**
+     * Clear method
+     * @note : Remove every define.
+     **/
+    void Clear( );
+
+public:
+    /**
+     * GetHash const function
+     * @note : Get hash of the define set, used as variant key.
+     * @return : Return define set hash value.
+     **/
+    uint64_t GetHash( ) const;
+
+    /**
+     * GetCount const function
+     * @note : Get define count.
+     * @return : Return define count value.
+     **/
+    uint32_t GetCount( ) const;
+
+    /**
+     * GetDefines const function
+     * @note : Get defines sorted by name.
+     * @return : Return m_defines value.
+     **/
+    const std::vector<GlwShaderDefine>& GetDefines( ) const;
+
+};
@@ -38,6 +38,13 @@ GlwMaterialSpecification::GlwMaterialSpecification( )
     : GlwMaterialSpecification{ { }, { }, { } }
 { }
 
+GlwMaterialSpecification::GlwMaterialSpecification( const std::vector<char>& compute )
+    : Vertex{ },
+    Fragment{ },
+    Geometry{ },
+    Compute{ compute }
+{ }
+
 GlwMaterialSpecification::GlwMaterialSpecification(
     const std::vector<char>& vertex,
     const std::vector<char>& fragment
@@ -52,16 +59,24 @@ GlwMaterialSpecification::GlwMaterialSpecification(
 )
     : Vertex{ vertex },
     Fragment{ fragment },
-    Geometry{ geometry }
+    Geometry{ geometry },
+    Compute{ }
 { }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 //      === PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 bool GlwMaterialSpecification::GetIsValid( )const {
+    if ( GetIsCompute( ) )
+        return Vertex.empty( ) && Fragment.empty( ) && Geometry.empty( );
+
     return Vertex.size( ) > 0 && Fragment.size( ) > 0;
 }
 
+bool GlwMaterialSpecification::GetIsCompute( ) const {
+    return Compute.size( ) > 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //      === OPERATOR ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,19 +31,27 @@
 
 #pragma once
 
-#include "../Meshes/GlwMesh.h"
+#include "GlwUniformTable.h"
 
 struct GlwMaterialSpecification { 
 
     std::vector<char> Vertex;
     std::vector<char> Fragment;
     std::vector<char> Geometry;
+    std::vector<char> Compute;
 
     /**
      * Constrctor 
      **/
     GlwMaterialSpecification( );
 
+    /**
+     * Constrctor
+     * @note : Compute material, it can only be dispatched.
+     * @param compute : Query material compute shader source.
+     **/
+    explicit GlwMaterialSpecification( const std::vector<char>& compute );
+
     /**
      * Constrctor
      * @param vertex : Query material vertex shader source.
@@ -69,10 +77,17 @@ struct GlwMaterialSpecification {
     /**
      * GetIsValid const function
      * @note : Get specification validity.
-     * @return : True when at least vertex and fragment are present.
+     * @return : True when at least vertex and fragment are present, or compute alone.
      **/
     bool GetIsValid( ) const;
 
+    /**
+     * GetIsCompute const function
+     * @note : Get if specification describe a compute material.
+     * @return : True when compute source is present.
+     **/
+    bool GetIsCompute( ) const;
+
     /**
      * Cast operator
      * @note : Cast specification to boolean.
@@ -0,0 +1,115 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwMaterialTemplate::GlwMaterialTemplate( )
+    : m_specification{ },
+    m_preprocessor{ },
+    m_variants{ }
+{ }
+
+bool GlwMaterialTemplate::Create( const GlwMaterialSpecification& specification ) {
+    m_specification = specification;
+
+    m_variants.clear( );
+
+    return m_specification.GetIsValid( );
+}
+
+bool GlwMaterialTemplate::Preprocess(
+    const GlwMaterialDefines& defines,
+    GlwMaterialSpecification& specification
+) const {
+    if ( !GetIsValid( ) )
+        return false;
+
+    specification = GlwMaterialSpecification{ };
+
+    if ( m_specification.GetIsCompute( ) )
+        return m_preprocessor.Process( m_specification.Compute, defines, specification.Compute );
+
+    auto result = 
+        m_preprocessor.Process( m_specification.Vertex, defines, specification.Vertex ) &&
+        m_preprocessor.Process( m_specification.Fragment, defines, specification.Fragment );
+
+    if ( result && m_specification.Geometry.size( ) > 0 )
+        result = m_preprocessor.Process( m_specification.Geometry, defines, specification.Geometry );
+
+    return result;
+}
+
+void GlwMaterialTemplate::SetVariant( const uint64_t key, const glw_ressource material ) {
+    m_variants[ key ] = material;
+}
+
+bool GlwMaterialTemplate::RemoveVariant( const uint64_t key ) {
+    return m_variants.erase( key ) > 0;
+}
+
+void GlwMaterialTemplate::Destroy( ) {
+    m_specification = GlwMaterialSpecification{ };
+
+    m_preprocessor.Clear( );
+    m_variants.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwShaderPreprocessor& GlwMaterialTemplate::GetPreprocessor( ) {
+    return m_preprocessor;
+}
+
+bool GlwMaterialTemplate::GetIsValid( ) const {
+    return m_specification.GetIsValid( );
+}
+
+bool GlwMaterialTemplate::GetVariant( const uint64_t key, glw_ressource& material ) const {
+    auto variant = m_variants.find( key );
+    auto result  = variant != m_variants.end( );
+
+    if ( result )
+        material = variant->second;
+
+    return result;
+}
+
+uint32_t GlwMaterialTemplate::GetVariantCount( ) const {
+    return (uint32_t)m_variants.size( );
+}
+
+const std::unordered_map<uint64_t, glw_ressource>& GlwMaterialTemplate::GetVariants( ) const {
+    return m_variants;
+}
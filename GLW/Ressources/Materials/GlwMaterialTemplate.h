@@ -0,0 +1,141 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwShaderPreprocessor.h"
+
+/**
+ * GlwMaterialTemplate final class
+ * @note : Shader sources shared by every variant of a material. Variants are
+ *         produced on request by injecting a define set and cached by the
+ *         hash of that set, so only requested permutations get compiled.
+ **/
+class GlwMaterialTemplate final {
+
+private:
+    GlwMaterialSpecification m_specification;
+    GlwShaderPreprocessor m_preprocessor;
+    std::unordered_map<uint64_t, glw_ressource> m_variants;
+
+public:
+    /**
+     * Constructor
+     **/
+    GlwMaterialTemplate( );
+
+    /**
+     * Destructor
+     **/
+    ~GlwMaterialTemplate( ) = default;
+
+    /**
+     * Create function
+     * @note : Set template sources and forget previous variants.
+     * @param specification : Query material template sources.
+     * @return : True when specification is valid.
+     **/
+    bool Create( const GlwMaterialSpecification& specification );
+
+    /**
+     * Preprocess function
+     * @note : Produce variant specification of query define set.
+     * @param defines : Query variant defines.
+     * @param specification : Store variant specification.
+     * @return : True when every stage was processed.
+     **/
+    bool Preprocess( 
+        const GlwMaterialDefines& defines, 
+        GlwMaterialSpecification& specification 
+    ) const;
+
+    /**
+     * SetVariant method
+     * @note : Store material created for a define set hash.
+     * @param key : Query define set hash.
+     * @param material : Query variant material.
+     **/
+    void SetVariant( const uint64_t key, const glw_ressource material );
+
+    /**
+     * RemoveVariant function
+     * @note : Forget material created for a define set hash.
+     * @param key : Query define set hash.
+     * @return : Return true when variant existed.
+     **/
+    bool RemoveVariant( const uint64_t key );
+
+    /**
+     * Destroy method
+     * @note : Clear sources, include setup and variants, variant materials
+     *         are owned by the ressource manager and stay alive.
+     **/
+    void Destroy( );
+
+public:
+    /**
+     * GetPreprocessor function
+     * @note : Get template preprocessor to set include directories and sources.
+     * @return : Return m_preprocessor reference.
+     **/
+    GlwShaderPreprocessor& GetPreprocessor( );
+
+    /**
+     * GetIsValid const function
+     * @note : Get template validity.
+     * @return : Return true when template sources are valid.
+     **/
+    bool GetIsValid( ) const;
+
+    /**
+     * GetVariant const function
+     * @note : Get material created for a define set hash.
+     * @param key : Query define set hash.
+     * @param material : Store variant material.
+     * @return : Return true when variant exist.
+     **/
+    bool GetVariant( const uint64_t key, glw_ressource& material ) const;
+
+    /**
+     * GetVariantCount const function
+     * @note : Get count of created variants.
+     * @return : Return variant count value.
+     **/
+    uint32_t GetVariantCount( ) const;
+
+    /**
+     * GetVariants const function
+     * @note : Get variant materials keyed by define set hash.
+     * @return : Return m_variants value.
+     **/
+    const std::unordered_map<uint64_t, glw_ressource>& GetVariants( ) const;
+
+};
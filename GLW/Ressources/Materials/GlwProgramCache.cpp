@@ -0,0 +1,280 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwProgramCache::GlwProgramCache( )
+    : m_directory{ },
+    m_driver{ },
+    m_is_enabled{ false },
+    m_statistics{ }
+{ }
+
+bool GlwProgramCache::Create( const std::string& directory ) {
+    auto error   = std::error_code{ };
+    auto formats = GLint{ 0 };
+
+    Destroy( );
+
+    if ( directory.empty( ) )
+        return false;
+
+    glGetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &formats );
+
+    m_directory = std::filesystem::path{ directory };
+
+    std::filesystem::create_directories( m_directory, error );
+
+    m_is_enabled = formats > 0 && std::filesystem::is_directory( m_directory, error );
+
+    if ( m_is_enabled ) {
+        const GLenum names[ 3 ] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+
+        for ( auto name : names ) {
+            auto* value = (const char*)glGetString( name );
+
+            if ( value != nullptr )
+                m_driver += value;
+
+            m_driver += '\n';
+        }
+    }
+
+    return m_is_enabled;
+}
+
+bool GlwProgramCache::Load( const uint64_t key, glProgram& program ) {
+    if ( !m_is_enabled )
+        return false;
+
+    auto start        = std::chrono::steady_clock::now( );
+    auto path         = GetPath( key );
+    auto file         = std::ifstream{ path, std::ios::binary };
+    auto compile_time = 0.0;
+    auto result       = false;
+
+    if ( file.is_open( ) ) {
+        auto magic      = uint32_t{ 0 };
+        auto version    = uint32_t{ 0 };
+        auto stored_key = uint64_t{ 0 };
+        auto format     = uint32_t{ 0 };
+        auto length     = uint32_t{ 0 };
+
+        file.read( (char*)&magic, sizeof( magic ) );
+        file.read( (char*)&version, sizeof( version ) );
+        file.read( (char*)&stored_key, sizeof( stored_key ) );
+        file.read( (char*)&format, sizeof( format ) );
+        file.read( (char*)&length, sizeof( length ) );
+        file.read( (char*)&compile_time, sizeof( compile_time ) );
+
+        if ( file && magic == Magic && version == Version && stored_key == key && length > 0 ) {
+            auto binary = std::vector<char>( length );
+
+            if ( file.read( binary.data( ), length ) ) {
+                auto status = GL_FALSE;
+
+                program = glCreateProgram( );
+
+                glProgramBinary( program, format, binary.data( ), (GLsizei)length );
+                glGetProgramiv( program, GL_LINK_STATUS, &status );
+
+                result = status == GL_TRUE;
+
+                if ( !result ) {
+                    glDeleteProgram( program );
+
+                    program = GL_NULL;
+                }
+            }
+        }
+
+        file.close( );
+
+        if ( !result ) {
+            auto error = std::error_code{ };
+
+            std::filesystem::remove( path, error );
+        }
+    }
+
+    if ( result ) {
+        auto load_time = GetElapsed( start );
+
+        m_statistics.Hits      += 1;
+        m_statistics.LoadTime  += load_time;
+        m_statistics.SavedTime += std::max( compile_time - load_time, 0.0 );
+    } else
+        m_statistics.Misses += 1;
+
+    return result;
+}
+
+bool GlwProgramCache::Store( const uint64_t key, const glProgram program, const double compile_time ) {
+    if ( !m_is_enabled || !glIsValid( program ) )
+        return false;
+
+    auto length = GLint{ 0 };
+    auto result = false;
+
+    m_statistics.CompileTime += compile_time;
+
+    glGetProgramiv( program, GL_PROGRAM_BINARY_LENGTH, &length );
+
+    if ( length > 0 ) {
+        auto binary  = std::vector<char>( (size_t)length );
+        auto written = GLsizei{ 0 };
+        auto format  = GLenum{ GL_NONE };
+
+        glGetProgramBinary( program, length, &written, &format, binary.data( ) );
+
+        if ( written > 0 ) {
+            auto path      = GetPath( key );
+            auto temporary = std::filesystem::path{ path }.concat( ".tmp" );
+            auto file      = std::ofstream{ temporary, std::ios::binary | std::ios::trunc };
+
+            if ( file.is_open( ) ) {
+                auto magic     = Magic;
+                auto version   = Version;
+                auto gl_format = (uint32_t)format;
+                auto gl_length = (uint32_t)written;
+                auto error     = std::error_code{ };
+
+                file.write( (const char*)&magic, sizeof( magic ) );
+                file.write( (const char*)&version, sizeof( version ) );
+                file.write( (const char*)&key, sizeof( key ) );
+                file.write( (const char*)&gl_format, sizeof( gl_format ) );
+                file.write( (const char*)&gl_length, sizeof( gl_length ) );
+                file.write( (const char*)&compile_time, sizeof( compile_time ) );
+                file.write( binary.data( ), written );
+                file.close( );
+
+                if ( file )
+                    std::filesystem::rename( temporary, path, error );
+
+                result = file && !error;
+
+                if ( !result )
+                    std::filesystem::remove( temporary, error );
+            }
+        }
+    }
+
+    if ( result )
+        m_statistics.Stores += 1;
+
+    return result;
+}
+
+void GlwProgramCache::Clear( ) {
+    auto error = std::error_code{ };
+
+    if ( m_is_enabled ) {
+        for ( const auto& entry : std::filesystem::directory_iterator{ m_directory, error } ) {
+            if ( entry.path( ).extension( ) == ".glwp" )
+                std::filesystem::remove( entry.path( ), error );
+        }
+    }
+
+    m_statistics = GlwProgramCacheStatistics{ };
+}
+
+void GlwProgramCache::Destroy( ) {
+    m_directory.clear( );
+    m_driver.clear( );
+
+    m_is_enabled = false;
+}
+
+uint64_t GlwProgramCache::Hash( const uint64_t hash, const char* data, const size_t length ) {
+    auto result = hash;
+
+    for ( auto i = (size_t)0; i < length; i++ ) {
+        result ^= (uint8_t)data[ i ];
+        result *= 0x100000001B3ull;
+    }
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+double GlwProgramCache::GetElapsed( const std::chrono::steady_clock::time_point start ) {
+    auto elapsed = std::chrono::steady_clock::now( ) - start;
+
+    return std::chrono::duration<double, std::milli>( elapsed ).count( );
+}
+
+uint64_t GlwProgramCache::GetKey( const GlwMaterialSpecification& specification ) const {
+    const std::vector<char>* sources[ 4 ] = {
+        &specification.Vertex,
+        &specification.Fragment,
+        &specification.Geometry,
+        &specification.Compute
+    };
+
+    auto result = Hash( HashSeed, m_driver.data( ), m_driver.size( ) );
+
+    for ( auto* source : sources ) {
+        auto length = (uint64_t)source->size( );
+
+        result = Hash( result, (const char*)&length, sizeof( length ) );
+        result = Hash( result, source->data( ), source->size( ) );
+    }
+
+    return result;
+}
+
+bool GlwProgramCache::GetIsEnabled( ) const {
+    return m_is_enabled;
+}
+
+const std::filesystem::path& GlwProgramCache::GetDirectory( ) const {
+    return m_directory;
+}
+
+const GlwProgramCacheStatistics& GlwProgramCache::GetStatistics( ) const {
+    return m_statistics;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+std::filesystem::path GlwProgramCache::GetPath( const uint64_t key ) const {
+    char name[ 32 ];
+
+    snprintf( name, sizeof( name ), "%016" PRIx64 ".glwp", key );
+
+    return m_directory / name;
+}
@@ -0,0 +1,162 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwProgramCacheStatistics.h"
+
+class GlwProgramCache final {
+
+public:
+    static const uint32_t Magic    = 0x50574C47;
+    static const uint32_t Version  = 1;
+    static const uint64_t HashSeed = 0xCBF29CE484222325ull;
+
+private:
+    std::filesystem::path m_directory;
+    std::string m_driver;
+    bool m_is_enabled;
+    GlwProgramCacheStatistics m_statistics;
+
+public:
+    /**
+     * Constructor
+     **/
+    GlwProgramCache( );
+
+    /**
+     * Destructor
+     **/
+    ~GlwProgramCache( ) = default;
+
+    /**
+     * Create function
+     * @note : Enable the cache on query directory, the directory is created when
+     *         missing. Must be called with a current OpenGL context, the driver
+     *         vendor, renderer and version strings are part of every key so a
+     *         driver update never loads a stale binary.
+     * @param directory : Query cache directory path.
+     * @return : True when the driver support program binaries and the directory is usable.
+     **/
+    bool Create( const std::string& directory );
+
+    /**
+     * Load function
+     * @note : Create a program from the binary stored for query key. A missing,
+     *         corrupted or driver rejected binary count as a miss and is removed
+     *         from the directory, caller must then compile from source.
+     * @param key : Query program key.
+     * @param program : Store loaded program.
+     * @return : True when the program was loaded and linked.
+     **/
+    bool Load( const uint64_t key, glProgram& program );
+
+    /**
+     * Store function
+     * @note : Retrieve query program binary and write it to the cache directory.
+     *         The program must have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT.
+     * @param key : Query program key.
+     * @param program : Query linked program.
+     * @param compile_time : Query time spent compiling and linking the program, in milliseconds.
+     * @return : True when the binary was written.
+     **/
+    bool Store( const uint64_t key, const glProgram program, const double compile_time );
+
+    /**
+     * Clear method
+     * @note : Remove every binary from the cache directory and reset statistics.
+     **/
+    void Clear( );
+
+    /**
+     * Destroy method
+     * @note : Disable the cache, stored binaries are kept on disk.
+     **/
+    void Destroy( );
+
+public:
+    /**
+     * Hash static function
+     * @note : Accumulate query data into a FNV-1a 64 bits hash.
+     * @param hash : Query current hash value.
+     * @param data : Query data to hash.
+     * @param length : Query data length.
+     * @return : Return accumulated hash value.
+     **/
+    static uint64_t Hash( const uint64_t hash, const char* data, const size_t length );
+
+    /**
+     * GetElapsed static function
+     * @note : Get time elapsed since query start point.
+     * @param start : Query start time point.
+     * @return : Return elapsed time in milliseconds.
+     **/
+    static double GetElapsed( const std::chrono::steady_clock::time_point start );
+
+    /**
+     * GetKey const function
+     * @note : Get cache key of query specification for the current driver.
+     * @param specification : Query material specification.
+     * @return : Return specification key.
+     **/
+    uint64_t GetKey( const GlwMaterialSpecification& specification ) const;
+
+    /**
+     * GetIsEnabled const function
+     * @note : Get if the cache is enabled.
+     * @return : Return true when Create succeeded.
+     **/
+    bool GetIsEnabled( ) const;
+
+    /**
+     * GetDirectory const function
+     * @note : Get cache directory path.
+     * @return : Return m_directory value.
+     **/
+    const std::filesystem::path& GetDirectory( ) const;
+
+    /**
+     * GetStatistics const function
+     * @note : Get cache hit, miss and timing counters.
+     * @return : Return m_statistics value.
+     **/
+    const GlwProgramCacheStatistics& GetStatistics( ) const;
+
+private:
+    /**
+     * GetPath const function
+     * @note : Get binary file path of query key.
+     * @param key : Query program key.
+     * @return : Return binary file path.
+     **/
+    std::filesystem::path GetPath( const uint64_t key ) const;
+
+};
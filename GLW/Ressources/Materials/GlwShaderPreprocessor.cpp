@@ -0,0 +1,268 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwShaderPreprocessor::GlwShaderPreprocessor( )
+    : m_directories{ },
+    m_sources{ }
+{ }
+
+void GlwShaderPreprocessor::AddDirectory( const std::filesystem::path& directory ) {
+    m_directories.emplace_back( directory );
+}
+
+void GlwShaderPreprocessor::AddSource( const std::string& name, const std::string& source ) {
+    m_sources[ name ] = source;
+}
+
+bool GlwShaderPreprocessor::Process(
+    const std::vector<char>& source,
+    const GlwMaterialDefines& defines,
+    std::vector<char>& output
+) const {
+    auto length   = strnlen( source.data( ), source.size( ) );
+    auto text     = std::string{ source.data( ), length };
+    auto expanded = std::string{ };
+    auto included = std::vector<std::string>{ };
+    auto* pending = &defines;
+    auto result   = Expand( text, { }, pending, included, 0, expanded );
+
+    if ( result ) {
+        if ( pending != nullptr ) {
+            auto header = std::string{ };
+
+            Inject( defines, header );
+
+            expanded = header + "#line 1\n" + expanded;
+        }
+
+        output.assign( expanded.begin( ), expanded.end( ) );
+        output.emplace_back( '\0' );
+    }
+
+    return result;
+}
+
+void GlwShaderPreprocessor::Clear( ) {
+    m_directories.clear( );
+    m_sources.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwShaderPreprocessor::Expand(
+    const std::string& source,
+    const std::filesystem::path& directory,
+    const GlwMaterialDefines*& defines,
+    std::vector<std::string>& included,
+    const uint32_t depth,
+    std::string& output
+) const {
+    if ( depth > MaxDepth ) {
+#       ifdef _DEBUG
+        printf( "[ GLW - ERROR ] Shader include depth exceed %u\n", MaxDepth );
+#       endif
+
+        return false;
+    }
+
+    auto line_number = (uint32_t)0;
+    auto start       = (size_t)0;
+    auto result      = true;
+
+    while ( result && start < source.size( ) ) {
+        auto end = source.find( '\n', start );
+
+        if ( end == std::string::npos )
+            end = source.size( );
+
+        auto line     = source.substr( start, end - start );
+        auto argument = std::string{ };
+
+        start        = end + 1;
+        line_number += 1;
+
+        if ( defines != nullptr && GetDirective( line, "version", argument ) ) {
+            output += line + '\n';
+
+            Inject( *defines, output );
+
+            output += "#line " + std::to_string( line_number + 1 ) + '\n';
+            defines = nullptr;
+        } else if ( GetDirective( line, "include", argument ) ) {
+            auto name    = std::string{ };
+            auto key     = std::string{ };
+            auto parent  = std::filesystem::path{ };
+            auto include = std::string{ };
+
+            result = GetIncludeName( argument, name ) && Resolve( name, directory, key, parent, include );
+
+            if ( !result ) {
+#               ifdef _DEBUG
+                printf( "[ GLW - ERROR ] Shader include not found : %s\n", argument.c_str( ) );
+#               endif
+
+                break;
+            }
+
+            if ( std::find( included.begin( ), included.end( ), key ) == included.end( ) ) {
+                auto* nested = (const GlwMaterialDefines*)nullptr;
+
+                included.emplace_back( key );
+
+                output += "#line 1\n";
+                result  = Expand( include, parent, nested, included, depth + 1, output );
+                output += "#line " + std::to_string( line_number + 1 ) + '\n';
+            } else
+                output += '\n';
+        } else if ( GetDirective( line, "pragma", argument ) && argument == "once" )
+            output += '\n';
+        else
+            output += line + '\n';
+    }
+
+    return result;
+}
+
+bool GlwShaderPreprocessor::Resolve(
+    const std::string& name,
+    const std::filesystem::path& directory,
+    std::string& key,
+    std::filesystem::path& parent,
+    std::string& source
+) const {
+    auto registered = m_sources.find( name );
+
+    if ( registered != m_sources.end( ) ) {
+        key    = name;
+        source = registered->second;
+
+        parent.clear( );
+
+        return true;
+    }
+
+    auto candidates = std::vector<std::filesystem::path>{ };
+    auto error      = std::error_code{ };
+
+    if ( !directory.empty( ) )
+        candidates.emplace_back( directory / name );
+
+    for ( const auto& include_directory : m_directories )
+        candidates.emplace_back( include_directory / name );
+
+    for ( const auto& candidate : candidates ) {
+        if ( !std::filesystem::is_regular_file( candidate, error ) )
+            continue;
+
+        auto file = std::ifstream{ candidate, std::ios::binary };
+
+        if ( !file.is_open( ) )
+            continue;
+
+        auto path = std::filesystem::weakly_canonical( candidate, error );
+
+        if ( error )
+            path = candidate;
+
+        key    = path.string( );
+        parent = path.parent_path( );
+        source = std::string{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{ } };
+
+        return true;
+    }
+
+    return false;
+}
+
+void GlwShaderPreprocessor::Inject( const GlwMaterialDefines& defines, std::string& output ) {
+    for ( const auto& define : defines.GetDefines( ) )
+        output += "#define " + define.Name + ' ' + define.Value + '\n';
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwShaderPreprocessor::GetDirective( 
+    const std::string& line, 
+    const char* directive, 
+    std::string& argument 
+) {
+    auto hash = line.find_first_not_of( " \t" );
+
+    if ( hash == std::string::npos || line[ hash ] != '#' )
+        return false;
+
+    auto name   = line.find_first_not_of( " \t", hash + 1 );
+    auto length = strlen( directive );
+
+    if ( name == std::string::npos || line.compare( name, length, directive ) != 0 )
+        return false;
+
+    auto next = name + length;
+
+    if ( next < line.size( ) && line[ next ] != ' ' && line[ next ] != '\t' && line[ next ] != '\r' )
+        return false;
+
+    auto first = line.find_first_not_of( " \t\r", next );
+    auto last  = line.find_last_not_of( " \t\r" );
+
+    if ( first != std::string::npos && last >= first )
+        argument = line.substr( first, last - first + 1 );
+    else
+        argument.clear( );
+
+    return true;
+}
+
+bool GlwShaderPreprocessor::GetIncludeName( const std::string& argument, std::string& name ) {
+    if ( argument.size( ) < 2 )
+        return false;
+
+    auto close = ( argument[ 0 ] == '<' ) ? '>' : '"';
+
+    if ( argument[ 0 ] != '<' && argument[ 0 ] != '"' )
+        return false;
+
+    auto end = argument.find( close, 1 );
+
+    if ( end == std::string::npos || end == 1 )
+        return false;
+
+    name = argument.substr( 1, end - 1 );
+
+    return true;
+}
@@ -0,0 +1,168 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwMaterialDefines.h"
+
+/**
+ * GlwShaderPreprocessor final class
+ * @note : Resolve #include directives and inject define sets in shader
+ *         sources before they reach the driver. Includes are looked up in
+ *         registered sources, then next to the including file, then in
+ *         include directories, and are expanded once per shader. #line
+ *         directives keep driver error line numbers relative to each file.
+ **/
+class GlwShaderPreprocessor final {
+
+public:
+    static const uint32_t MaxDepth = 32;
+
+private:
+    std::vector<std::filesystem::path> m_directories;
+    std::unordered_map<std::string, std::string> m_sources;
+
+public:
+    /**
+     * Constructor
+     **/
+    GlwShaderPreprocessor( );
+
+    /**
+     * Destructor
+     **/
+    ~GlwShaderPreprocessor( ) = default;
+
+    /**
+     * AddDirectory method
+     * @note : Add directory searched by #include directives.
+     * @param directory : Query include directory path.
+     **/
+    void AddDirectory( const std::filesystem::path& directory );
+
+    /**
+     * AddSource method
+     * @note : Register in-memory source available to #include directives
+     *         under query name, registered sources take precedence over files.
+     * @param name : Query include name.
+     * @param source : Query include source.
+     **/
+    void AddSource( const std::string& name, const std::string& source );
+
+    /**
+     * Process function
+     * @note : Expand includes of query source and inject query defines right
+     *         after its #version directive, or on top when it has none.
+     * @param source : Query shader source.
+     * @param defines : Query defines to inject.
+     * @param output : Store processed source, null terminated.
+     * @return : Return false when an include is missing or nested too deep.
+     **/
+    bool Process( 
+        const std::vector<char>& source, 
+        const GlwMaterialDefines& defines, 
+        std::vector<char>& output 
+    ) const;
+
+    /**
+     * Clear method
+     * @note : Remove every include directory and registered source.
+     **/
+    void Clear( );
+
+private:
+    /**
+     * Expand function
+     * @note : Copy query source to output, expanding its includes recursively.
+     * @param source : Query source text.
+     * @param directory : Query directory of the source file, empty for registered sources.
+     * @param defines : Query defines to inject on #version, set to nullptr once injected.
+     * @param included : Query include keys already expanded.
+     * @param depth : Query include depth.
+     * @param output : Store expanded text.
+     * @return : Return true when operation succeeded.
+     **/
+    bool Expand(
+        const std::string& source,
+        const std::filesystem::path& directory,
+        const GlwMaterialDefines*& defines,
+        std::vector<std::string>& included,
+        const uint32_t depth,
+        std::string& output
+    ) const;
+
+    /**
+     * Resolve function
+     * @note : Find include source from its name.
+     * @param name : Query include name.
+     * @param directory : Query directory of the including file.
+     * @param key : Store unique include key.
+     * @param parent : Store directory of the include file.
+     * @param source : Store include source.
+     * @return : Return true when include was found.
+     **/
+    bool Resolve(
+        const std::string& name,
+        const std::filesystem::path& directory,
+        std::string& key,
+        std::filesystem::path& parent,
+        std::string& source
+    ) const;
+
+    /**
+     * Inject static method
+     * @note : Append define directives to output.
+     * @param defines : Query defines.
+     * @param output : Store define directives.
+     **/
+    static void Inject( const GlwMaterialDefines& defines, std::string& output );
+
+private:
+    /**
+     * GetDirective static function
+     * @note : Get if query line is a query preprocessor directive.
+     * @param line : Query source line.
+     * @param directive : Query directive name without #.
+     * @param argument : Store trimmed directive argument.
+     * @return : Return true when line is the directive.
+     **/
+    static bool GetDirective( const std::string& line, const char* directive, std::string& argument );
+
+    /**
+     * GetIncludeName static function
+     * @note : Get include name from an #include argument.
+     * @param argument : Query directive argument, "name" or <name>.
+     * @param name : Store include name.
+     * @return : Return true when argument is well formed.
+     **/
+    static bool GetIncludeName( const std::string& argument, std::string& name );
+
+};
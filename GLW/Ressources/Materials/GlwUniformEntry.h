@@ -0,0 +1,71 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwUniformHash.h"
+
+struct GlwUniformEntry {
+
+    GlwUniformHash Hash;
+    int32_t Location;
+    uint32_t Type;
+    uint32_t Size;
+
+    /**
+     * Constructor
+     * @note : Empty entry, Location is -1.
+     **/
+    GlwUniformEntry( );
+
+    /**
+     * Constructor
+     * @param hash : Query name hash.
+     * @param location : Query uniform location or block index.
+     * @param type : Query OpenGL uniform type, block interface for blocks.
+     * @param size : Query array element count, data size for blocks.
+     **/
+    GlwUniformEntry(
+        const GlwUniformHash hash,
+        const int32_t location,
+        const uint32_t type,
+        const uint32_t size
+    );
+
+    /**
+     * GetIsValid const function
+     * @note : Get if entry is used.
+     * @return : Return true when Location is not negative.
+     **/
+    bool GetIsValid( ) const;
+
+};
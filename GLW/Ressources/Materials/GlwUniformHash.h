@@ -0,0 +1,98 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "../Meshes/GlwGeometryPool.h"
+
+struct GlwUniformHash {
+
+    uint32_t Value;
+
+    /**
+     * Constructor
+     **/
+    constexpr GlwUniformHash( )
+        : Value{ 0 }
+    { };
+
+    /**
+     * Constructor
+     * @note : Hash is computed at compile time for constant names.
+     * @param name : Query null terminated uniform name.
+     **/
+    explicit constexpr GlwUniformHash( const char* name )
+        : Value{ Compute( name, UINT32_MAX ) }
+    { };
+
+    /**
+     * Constructor
+     * @param name : Query uniform name.
+     * @param length : Query name character count.
+     **/
+    constexpr GlwUniformHash( const char* name, const uint32_t length )
+        : Value{ Compute( name, length ) }
+    { };
+
+    /**
+     * Constructor
+     * @param name : Query uniform name.
+     **/
+    explicit GlwUniformHash( const std::string& name );
+
+    /**
+     * Compute static function
+     * @note : 32 bits FNV-1a hash of a name.
+     * @param name : Query name.
+     * @param length : Query character count, stop earlier on null character.
+     * @return : Return name hash.
+     **/
+    static constexpr uint32_t Compute( const char* name, const uint32_t length ) {
+        auto result = 2166136261u;
+
+        for ( auto index = (uint32_t)0; name != nullptr && index < length && name[ index ] != '\0'; index++ )
+            result = ( result ^ (uint8_t)name[ index ] ) * 16777619u;
+
+        return result;
+    };
+
+    /**
+     * Equal operator
+     * @note : Compare hash values.
+     * @param other : Query other hash.
+     * @return : Return true when values are equal.
+     **/
+    constexpr bool operator==( const GlwUniformHash& other ) const {
+        return Value == other.Value;
+    };
+
+};
@@ -0,0 +1,118 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwUniformTable::GlwUniformTable( )
+    : m_entries{ },
+    m_count{ 0 }
+{ }
+
+void GlwUniformTable::Clear( ) {
+    m_entries.clear( );
+
+    m_count = 0;
+}
+
+bool GlwUniformTable::Insert( const GlwUniformEntry& entry ) {
+    if ( !entry.GetIsValid( ) || Find( entry.Hash ) != nullptr )
+        return false;
+
+    if ( ( m_count + 1 ) * 2 > m_entries.size( ) )
+        Grow( std::max( (uint32_t)m_entries.size( ) * 2, MinimumCapacity ) );
+
+    auto mask  = (uint32_t)m_entries.size( ) - 1;
+    auto index = entry.Hash.Value & mask;
+
+    while ( m_entries[ index ].GetIsValid( ) )
+        index = ( index + 1 ) & mask;
+
+    m_entries[ index ] = entry;
+    m_count           += 1;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void GlwUniformTable::Grow( const uint32_t capacity ) {
+    auto entries = std::vector<GlwUniformEntry>( capacity );
+    auto mask    = capacity - 1;
+
+    for ( auto& entry : m_entries ) {
+        if ( !entry.GetIsValid( ) )
+            continue;
+
+        auto index = entry.Hash.Value & mask;
+
+        while ( entries[ index ].GetIsValid( ) )
+            index = ( index + 1 ) & mask;
+
+        entries[ index ] = entry;
+    }
+
+    m_entries = std::move( entries );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//      === PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+const GlwUniformEntry* GlwUniformTable::Find( const GlwUniformHash hash ) const {
+    if ( m_entries.empty( ) )
+        return nullptr;
+
+    auto mask  = (uint32_t)m_entries.size( ) - 1;
+    auto index = hash.Value & mask;
+
+    while ( m_entries[ index ].GetIsValid( ) ) {
+        if ( m_entries[ index ].Hash == hash )
+            return &m_entries[ index ];
+
+        index = ( index + 1 ) & mask;
+    }
+
+    return nullptr;
+}
+
+int32_t GlwUniformTable::GetLocation( const GlwUniformHash hash ) const {
+    auto* entry = Find( hash );
+
+    return ( entry != nullptr ) ? entry->Location : -1;
+}
+
+uint32_t GlwUniformTable::GetCount( ) const {
+    return m_count;
+}
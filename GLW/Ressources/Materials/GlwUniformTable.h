@@ -0,0 +1,108 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwUniformEntry.h"
+
+/**
+ * GlwUniformTable final class
+ * @note : Flat open addressing table of program resources keyed by name 
+ *         hash, filled once at link time so lookups never reach the driver.
+ **/
+class GlwUniformTable final {
+
+public:
+    static const uint32_t MinimumCapacity = 16;
+
+private:
+    std::vector<GlwUniformEntry> m_entries;
+    uint32_t m_count;
+
+public:
+    /**
+     * Constructor
+     **/
+    GlwUniformTable( );
+
+    /**
+     * Destructor
+     **/
+    ~GlwUniformTable( ) = default;
+
+    /**
+     * Clear method
+     * @note : Remove every entry.
+     **/
+    void Clear( );
+
+    /**
+     * Insert function
+     * @note : Add entry, table grows to stay at most half full.
+     * @param entry : Query entry.
+     * @return : Return false when entry is invalid or hash already exist.
+     **/
+    bool Insert( const GlwUniformEntry& entry );
+
+private:
+    /**
+     * Grow method
+     * @note : Reinsert entries in a larger table.
+     * @param capacity : Query new capacity, power of 2.
+     **/
+    void Grow( const uint32_t capacity );
+
+public:
+    /**
+     * Find const function
+     * @note : Find entry by name hash.
+     * @param hash : Query name hash.
+     * @return : Return entry pointer, nullptr when missing.
+     **/
+    const GlwUniformEntry* Find( const GlwUniformHash hash ) const;
+
+    /**
+     * GetLocation const function
+     * @note : Get entry location by name hash.
+     * @param hash : Query name hash.
+     * @return : Return location, -1 when missing.
+     **/
+    int32_t GetLocation( const GlwUniformHash hash ) const;
+
+    /**
+     * GetCount const function
+     * @note : Get entry count.
+     * @return : Return entry count value.
+     **/
+    uint32_t GetCount( ) const;
+
+};
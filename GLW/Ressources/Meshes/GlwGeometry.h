@@ -0,0 +1,65 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwGeometryAllocator.h"
+
+/**
+ * GlwGeometry struct
+ * @note : Vertex and index ranges of a mesh stored in a geometry pool, 
+ *		   indexes are relative to the first vertex of the mesh.
+ **/
+struct GlwGeometry {
+
+	GlwGeometryRange Vertices;
+	GlwGeometryRange Indexes;
+
+	/**
+	 * Constructor
+	 **/
+	GlwGeometry( );
+
+	/**
+	 * Constructor
+	 * @param vertices : Query vertex range.
+	 * @param indexes : Query index range.
+	 **/
+	GlwGeometry( const GlwGeometryRange& vertices, const GlwGeometryRange& indexes );
+
+	/**
+	 * GetIsValid const function
+	 * @note : Get if geometry own a vertex range.
+	 * @return : True when geometry is allocated.
+	 **/
+	bool GetIsValid( ) const;
+
+};
@@ -0,0 +1,145 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwGeometryAllocator::GlwGeometryAllocator( )
+	: m_free{ },
+	m_capacity{ 0 },
+	m_used{ 0 }
+{ }
+
+void GlwGeometryAllocator::Create( const uint32_t capacity ) {
+	m_free.clear( );
+
+	if ( capacity > 0 )
+		m_free.emplace_back( 0, capacity );
+
+	m_capacity = capacity;
+	m_used     = 0;
+}
+
+bool GlwGeometryAllocator::Allocate( const uint32_t length, GlwGeometryRange& range ) {
+	if ( length == 0 )
+		return false;
+
+	for ( auto free = m_free.begin( ); free < m_free.end( ); free++ ) {
+		if ( free->Length < length )
+			continue;
+
+		range = { free->Offset, length };
+
+		free->Offset += length;
+		free->Length -= length;
+
+		if ( free->Length == 0 )
+			m_free.erase( free );
+
+		m_used += length;
+
+		return true;
+	}
+
+	return false;
+}
+
+void GlwGeometryAllocator::Release( const GlwGeometryRange& range ) {
+	if ( range.Length == 0 )
+		return;
+
+	auto next = std::lower_bound( 
+		m_free.begin( ), m_free.end( ), range, 
+		[]( const GlwGeometryRange& free, const GlwGeometryRange& query ) { return free.Offset < query.Offset; } 
+	);
+
+	auto index    = (uint32_t)( next - m_free.begin( ) );
+	auto merged   = range;
+	auto has_prev = index > 0 && m_free[ index - 1 ].GetEnd( ) == merged.Offset;
+
+	if ( next < m_free.end( ) && merged.GetEnd( ) == next->Offset ) {
+		merged.Length += next->Length;
+
+		m_free.erase( next );
+	}
+
+	if ( has_prev )
+		m_free[ index - 1 ].Length += merged.Length;
+	else
+		m_free.insert( m_free.begin( ) + index, merged );
+
+	m_used -= range.Length;
+}
+
+bool GlwGeometryAllocator::Grow( const uint32_t capacity ) {
+	auto result = capacity > m_capacity;
+
+	if ( result ) {
+		if ( m_free.size( ) > 0 && m_free.back( ).GetEnd( ) == m_capacity )
+			m_free.back( ).Length += capacity - m_capacity;
+		else
+			m_free.emplace_back( m_capacity, capacity - m_capacity );
+
+		m_capacity = capacity;
+	}
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t GlwGeometryAllocator::GetCapacity( ) const {
+	return m_capacity;
+}
+
+uint32_t GlwGeometryAllocator::GetUsed( ) const {
+	return m_used;
+}
+
+uint32_t GlwGeometryAllocator::GetFreeCount( ) const {
+	return (uint32_t)m_free.size( );
+}
+
+uint32_t GlwGeometryAllocator::GetLargestFree( ) const {
+	auto result = (uint32_t)0;
+
+	for ( auto& free : m_free )
+		result = std::max( result, free.Length );
+
+	return result;
+}
+
+bool GlwGeometryAllocator::GetIsCompact( ) const {
+	return m_free.size( ) == 0 || ( m_free.size( ) == 1 && m_free.back( ).GetEnd( ) == m_capacity );
+}
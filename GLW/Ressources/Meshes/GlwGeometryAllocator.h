@@ -0,0 +1,126 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwGeometryRange.h"
+
+/**
+ * GlwGeometryAllocator final class
+ * @note : First fit free list allocator of element ranges, free ranges are
+ *		   kept sorted by offset and merged with their neighbours on release.
+ **/
+class GlwGeometryAllocator final {
+
+private:
+	std::vector<GlwGeometryRange> m_free;
+	uint32_t m_capacity;
+	uint32_t m_used;
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwGeometryAllocator( );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwGeometryAllocator( ) = default;
+
+	/**
+	 * Create method
+	 * @note : Reset allocator to a single free range of query capacity.
+	 * @param capacity : Query element capacity.
+	 **/
+	void Create( const uint32_t capacity );
+
+	/**
+	 * Allocate function
+	 * @note : Allocate a range from the first free range large enough.
+	 * @param length : Query element count.
+	 * @param range : Store allocated range.
+	 * @return : True when a free range was large enough.
+	 **/
+	bool Allocate( const uint32_t length, GlwGeometryRange& range );
+
+	/**
+	 * Release method
+	 * @note : Give back a previously allocated range.
+	 * @param range : Query allocated range.
+	 **/
+	void Release( const GlwGeometryRange& range );
+
+	/**
+	 * Grow function
+	 * @note : Extend capacity, new elements are appended to the free list.
+	 * @param capacity : Query new element capacity.
+	 * @return : True when capacity is greater than current capacity.
+	 **/
+	bool Grow( const uint32_t capacity );
+
+public:
+	/**
+	 * GetCapacity const function
+	 * @note : Get element capacity.
+	 * @return : Return element capacity value.
+	 **/
+	uint32_t GetCapacity( ) const;
+
+	/**
+	 * GetUsed const function
+	 * @note : Get allocated element count.
+	 * @return : Return allocated element count value.
+	 **/
+	uint32_t GetUsed( ) const;
+
+	/**
+	 * GetFreeCount const function
+	 * @note : Get free range count.
+	 * @return : Return free range count value.
+	 **/
+	uint32_t GetFreeCount( ) const;
+
+	/**
+	 * GetLargestFree const function
+	 * @note : Get length of the largest free range.
+	 * @return : Return largest free range length value.
+	 **/
+	uint32_t GetLargestFree( ) const;
+
+	/**
+	 * GetIsCompact const function
+	 * @note : Get if allocated ranges are packed at the start of the capacity.
+	 * @return : True when no free range sit between allocated ranges.
+	 **/
+	bool GetIsCompact( ) const;
+
+};
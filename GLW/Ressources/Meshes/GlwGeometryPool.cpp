@@ -0,0 +1,271 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwGeometryPool::GlwGeometryPool( )
+	: m_vao{ },
+	m_vbo{ },
+	m_ibo{ },
+	m_vertices{ },
+	m_indexes{ },
+	m_stride{ 0 },
+	m_attributes{ },
+	m_geometries{ },
+	m_free{ }
+{ }
+
+bool GlwGeometryPool::Create( const GlwGeometryPoolSpecification& specification ) {
+	auto vertex = GlwBufferSpecification{ GlwBufferTypes::Vertex, specification.Mode };
+	auto index  = GlwBufferSpecification{ GlwBufferTypes::Index, specification.Mode };
+	auto result = specification.VertexStride > 0 && m_vao.Create( ) && m_vbo.Create( vertex ) && m_ibo.Create( index );
+
+	if ( result ) {
+		m_stride     = specification.VertexStride;
+		m_attributes = specification.Attributes;
+
+		m_vertices.Create( 0 );
+		m_indexes.Create( 0 );
+
+		result = Reserve( m_vbo, m_vertices, m_stride, std::max( specification.VertexCapacity, 1u ) ) && 
+				 Reserve( m_ibo, m_indexes, sizeof( uint32_t ), std::max( specification.IndexCapacity, 1u ) );
+	}
+
+	return result;
+}
+
+bool GlwGeometryPool::Allocate(
+	const uint32_t vertice_count,
+	const void* vertices,
+	const uint32_t index_count,
+	const uint32_t* indexes,
+	uint32_t& geometry
+) {
+	if ( !GetIsValid( ) || vertice_count == 0 || vertices == nullptr || index_count == 0 || indexes == nullptr )
+		return false;
+
+	auto instance = GlwGeometry{ };
+	auto result   = m_vertices.Allocate( vertice_count, instance.Vertices );
+
+	if ( !result )
+		result = Reserve( m_vbo, m_vertices, m_stride, vertice_count ) && m_vertices.Allocate( vertice_count, instance.Vertices );
+
+	if ( result && !m_indexes.Allocate( index_count, instance.Indexes ) )
+		result = Reserve( m_ibo, m_indexes, sizeof( uint32_t ), index_count ) && m_indexes.Allocate( index_count, instance.Indexes );
+
+	if ( result ) {
+		result = m_vbo.Update( instance.Vertices.Offset * m_stride, vertice_count * m_stride, vertices ) &&
+				 m_ibo.Update( instance.Indexes.Offset * sizeof( uint32_t ), index_count * sizeof( uint32_t ), indexes );
+	}
+
+	if ( !result ) {
+		m_vertices.Release( instance.Vertices );
+		m_indexes.Release( instance.Indexes );
+
+		return false;
+	}
+
+	if ( m_free.size( ) > 0 ) {
+		geometry = m_free.back( );
+
+		m_free.pop_back( );
+
+		m_geometries[ geometry ] = instance;
+	} else {
+		geometry = (uint32_t)m_geometries.size( );
+
+		m_geometries.emplace_back( instance );
+	}
+
+	return true;
+}
+
+bool GlwGeometryPool::Release( const uint32_t geometry ) {
+	auto result = geometry < m_geometries.size( ) && m_geometries[ geometry ].GetIsValid( );
+
+	if ( result ) {
+		auto& instance = m_geometries[ geometry ];
+
+		m_vertices.Release( instance.Vertices );
+		m_indexes.Release( instance.Indexes );
+		m_free.emplace_back( geometry );
+
+		instance = { };
+	}
+
+	return result;
+}
+
+bool GlwGeometryPool::Defragment( ) {
+	if ( !GetIsValid( ) )
+		return false;
+
+	if ( m_vertices.GetIsCompact( ) && m_indexes.GetIsCompact( ) )
+		return true;
+
+	auto vbo      = GlwBuffer{ };
+	auto ibo      = GlwBuffer{ };
+	auto vertices = GlwGeometryAllocator{ };
+	auto indexes  = GlwGeometryAllocator{ };
+	auto result   = vbo.Create( { GlwBufferTypes::Vertex, (GlwBufferModes)m_vbo.GetMode( ), m_vbo.GetUpdate( ) } ) && vbo.Fill( m_vbo.GetSize( ), nullptr ) &&
+					ibo.Create( { GlwBufferTypes::Index, (GlwBufferModes)m_ibo.GetMode( ), m_ibo.GetUpdate( ) } ) && ibo.Fill( m_ibo.GetSize( ), nullptr );
+
+	vertices.Create( m_vertices.GetCapacity( ) );
+	indexes.Create( m_indexes.GetCapacity( ) );
+
+	for ( auto& geometry : m_geometries ) {
+		if ( !result || !geometry.GetIsValid( ) )
+			continue;
+
+		auto packed = GlwGeometry{ };
+
+		result = vertices.Allocate( geometry.Vertices.Length, packed.Vertices ) &&
+				 indexes.Allocate( geometry.Indexes.Length, packed.Indexes ) &&
+				 vbo.Copy( m_vbo, geometry.Vertices.Offset * m_stride, packed.Vertices.Offset * m_stride, geometry.Vertices.Length * m_stride ) &&
+				 ibo.Copy( m_ibo, geometry.Indexes.Offset * sizeof( uint32_t ), packed.Indexes.Offset * sizeof( uint32_t ), geometry.Indexes.Length * sizeof( uint32_t ) );
+
+		if ( result )
+			geometry = packed;
+	}
+
+	if ( !result ) {
+		vbo.Destroy( );
+		ibo.Destroy( );
+
+		return false;
+	}
+
+	m_vbo.Destroy( );
+	m_ibo.Destroy( );
+
+	m_vbo	   = vbo;
+	m_ibo	   = ibo;
+	m_vertices = vertices;
+	m_indexes  = indexes;
+
+	Link( );
+
+	return true;
+}
+
+void GlwGeometryPool::Use( GlwStateTracker& state_tracker ) {
+	m_vao.Use( state_tracker );
+}
+
+void GlwGeometryPool::Destroy( ) {
+	m_vbo.Destroy( );
+	m_ibo.Destroy( );
+	m_vao.Destroy( );
+
+	m_geometries.clear( );
+	m_free.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwGeometryPool::Reserve(
+	GlwBuffer& buffer,
+	GlwGeometryAllocator& allocator,
+	const uint32_t element_size,
+	const uint32_t length
+) {
+	auto capacity = std::max( allocator.GetCapacity( ) * 2, allocator.GetCapacity( ) + length );
+	auto instance = GlwBuffer{ };
+	auto result   = instance.Create( { buffer.GetType( ), (GlwBufferModes)buffer.GetMode( ), buffer.GetUpdate( ) } ) && instance.Fill( capacity * element_size, nullptr );
+
+	if ( result && buffer.GetSize( ) > 0 )
+		result = instance.Copy( buffer, 0, 0, buffer.GetSize( ) );
+
+	if ( result ) {
+		buffer.Destroy( );
+
+		buffer = instance;
+
+		allocator.Grow( capacity );
+
+		Link( );
+	} else
+		instance.Destroy( );
+
+	return result;
+}
+
+void GlwGeometryPool::Link( ) {
+	m_vao.Link( m_attributes, m_vbo, m_ibo );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwGeometryPool::GetIsValid( ) const {
+	return glIsValid( m_vao ) && m_vbo.GetIsValid( ) && m_ibo.GetIsValid( );
+}
+
+uint32_t GlwGeometryPool::GetGeometryCount( ) const {
+	return (uint32_t)( m_geometries.size( ) - m_free.size( ) );
+}
+
+const GlwGeometry* GlwGeometryPool::GetGeometry( const uint32_t geometry ) const {
+	auto* instance = (const GlwGeometry*)nullptr;
+
+	if ( geometry < m_geometries.size( ) && m_geometries[ geometry ].GetIsValid( ) )
+		instance = &m_geometries[ geometry ];
+
+	return instance;
+}
+
+uint32_t GlwGeometryPool::GetVertexStride( ) const {
+	return m_stride;
+}
+
+const GlwGeometryAllocator& GlwGeometryPool::GetVertexAllocator( ) const {
+	return m_vertices;
+}
+
+const GlwGeometryAllocator& GlwGeometryPool::GetIndexAllocator( ) const {
+	return m_indexes;
+}
+
+const GlwVertexArray& GlwGeometryPool::GetVAO( ) const {
+	return m_vao;
+}
+
+const GlwBuffer& GlwGeometryPool::GetVBO( ) const {
+	return m_vbo;
+}
+
+const GlwBuffer& GlwGeometryPool::GetIBO( ) const {
+	return m_ibo;
+}
@@ -0,0 +1,235 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwGeometryPoolSpecification.h"
+
+/**
+ * GlwGeometryPool class
+ * @note : Store meshes sharing a vertex format in one vertex buffer and one
+ *		   index buffer bound to a single vertex array, meshes are drawn with
+ *		   base vertex offsets so switching between them need no bind.
+ **/
+class GlwGeometryPool : public GlwRessource<GlwGeometryPoolSpecification> {
+
+protected:
+	GlwVertexArray m_vao;
+	GlwBuffer m_vbo;
+	GlwBuffer m_ibo;
+	GlwGeometryAllocator m_vertices;
+	GlwGeometryAllocator m_indexes;
+	uint32_t m_stride;
+	std::vector<GlwVertexAttribute> m_attributes;
+	std::vector<GlwGeometry> m_geometries;
+	std::vector<uint32_t> m_free;
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwGeometryPool( );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwGeometryPool( ) = default;
+
+	/**
+	 * Create function
+	 * @note : Create geometry pool according to query specification.
+	 * @param specification : Query geometry pool specification.
+	 * @return : True when creation succeeded.
+	 **/
+	virtual bool Create( const GlwGeometryPoolSpecification& specification ) override;
+
+	/**
+	 * Allocate function
+	 * @note : Allocate and upload a mesh, buffers grow when no free range is 
+	 *		   large enough, allocated meshes keep their ranges while growing.
+	 * @param vertice_count : Query vertex count.
+	 * @param vertices : Pointer to vertices, vertex stride bytes each.
+	 * @param index_count : Query index count.
+	 * @param indexes : Pointer to indexes, relative to first mesh vertex.
+	 * @param geometry : Store allocated geometry handle.
+	 * @return : True when operation succeeded.
+	 **/
+	bool Allocate(
+		const uint32_t vertice_count,
+		const void* vertices,
+		const uint32_t index_count,
+		const uint32_t* indexes,
+		uint32_t& geometry
+	);
+
+	/**
+	 * Release function
+	 * @note : Release geometry ranges, handle is reused by next allocation.
+	 * @param geometry : Query geometry handle.
+	 * @return : True when geometry was allocated.
+	 **/
+	bool Release( const uint32_t geometry );
+
+	/**
+	 * Defragment function
+	 * @note : Pack allocated meshes at the start of the buffers by copying them
+	 *		   on the GPU into new buffers, geometry ranges change so commands 
+	 *		   recorded before must be submitted first.
+	 * @return : True when operation succeeded.
+	 **/
+	bool Defragment( );
+
+	/**
+	 * Use method
+	 * @note : Bind pool vertex array for usage.
+	 * @param state_tracker : Query current state tracker.
+	 **/
+	void Use( GlwStateTracker& state_tracker );
+
+	/**
+	 * Destroy method
+	 * @note : Destroy geometry pool.
+	 **/
+	virtual void Destroy( ) override;
+
+private:
+	/**
+	 * Reserve function
+	 * @note : Grow a buffer and its allocator to fit at least length more 
+	 *		   elements, content is copied on the GPU.
+	 * @param buffer : Query buffer to grow.
+	 * @param allocator : Query buffer allocator.
+	 * @param element_size : Query size of an element in bytes.
+	 * @param length : Query element count to fit.
+	 * @return : True when operation succeeded.
+	 **/
+	bool Reserve( 
+		GlwBuffer& buffer, 
+		GlwGeometryAllocator& allocator, 
+		const uint32_t element_size, 
+		const uint32_t length 
+	);
+
+	/**
+	 * Link method
+	 * @note : Link vertex array to current buffers.
+	 **/
+	void Link( );
+
+public:
+	/**
+	 * Allocate template function
+	 * @note : Allocate and upload a mesh.
+	 * @template VertexType : Type of data used for vertex representation.
+	 * @param vertices : Vertex list.
+	 * @param indexes : Index list.
+	 * @param geometry : Store allocated geometry handle.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename VertexType>
+	bool Allocate(
+		const std::vector<VertexType>& vertices,
+		const std::vector<uint32_t>& indexes,
+		uint32_t& geometry
+	) {
+		auto vertice_count = (uint32_t)vertices.size( );
+		auto index_count   = (uint32_t)indexes.size( );
+
+		return  sizeof( VertexType ) == m_stride &&
+				Allocate( vertice_count, vertices.data( ), index_count, indexes.data( ), geometry );
+	};
+
+public:
+	/**
+	 * GetIsValid const function
+	 * @note : Get geometry pool validity.
+	 * @return : Return true when geometry pool is valid.
+	 **/
+	virtual bool GetIsValid( ) const override;
+
+	/**
+	 * GetGeometryCount const function
+	 * @note : Get allocated geometry count.
+	 * @return : Return allocated geometry count value.
+	 **/
+	uint32_t GetGeometryCount( ) const;
+
+	/**
+	 * GetGeometry const function
+	 * @note : Get geometry ranges.
+	 * @param geometry : Query geometry handle.
+	 * @return : Return pointer to geometry or nullptr when not allocated.
+	 **/
+	const GlwGeometry* GetGeometry( const uint32_t geometry ) const;
+
+	/**
+	 * GetVertexStride const function
+	 * @note : Get size of a vertex in bytes.
+	 * @return : Return vertex stride value.
+	 **/
+	uint32_t GetVertexStride( ) const;
+
+	/**
+	 * GetVertexAllocator const function
+	 * @note : Get vertex range allocator.
+	 * @return : Constant reference to vertex allocator.
+	 **/
+	const GlwGeometryAllocator& GetVertexAllocator( ) const;
+
+	/**
+	 * GetIndexAllocator const function
+	 * @note : Get index range allocator.
+	 * @return : Constant reference to index allocator.
+	 **/
+	const GlwGeometryAllocator& GetIndexAllocator( ) const;
+
+	/**
+	 * GetVAO const function
+	 * @note : Get shared vertex array instance.
+	 * @return : Constant reference to vertex array.
+	 **/
+	const GlwVertexArray& GetVAO( ) const;
+
+	/**
+	 * GetVBO const function
+	 * @note : Get shared vertex buffer instance.
+	 * @return : Constant reference to vertex buffer.
+	 **/
+	const GlwBuffer& GetVBO( ) const;
+
+	/**
+	 * GetIBO const function
+	 * @note : Get shared index buffer instance.
+	 * @return : Constant reference to index buffer.
+	 **/
+	const GlwBuffer& GetIBO( ) const;
+
+};
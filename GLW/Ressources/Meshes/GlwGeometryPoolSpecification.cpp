@@ -0,0 +1,62 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwGeometryPoolSpecification::GlwGeometryPoolSpecification( )
+	: GlwGeometryPoolSpecification{ 0, 0, 0, { } }
+{ }
+
+GlwGeometryPoolSpecification::GlwGeometryPoolSpecification(
+	const uint32_t vertex_stride,
+	const uint32_t vertex_capacity,
+	const uint32_t index_capacity,
+	const std::vector<GlwVertexAttribute>& attributes
+)
+	: GlwGeometryPoolSpecification{ GlwBufferModes::Static_Draw, vertex_stride, vertex_capacity, index_capacity, attributes }
+{ }
+
+GlwGeometryPoolSpecification::GlwGeometryPoolSpecification(
+	const GlwBufferModes mode,
+	const uint32_t vertex_stride,
+	const uint32_t vertex_capacity,
+	const uint32_t index_capacity,
+	const std::vector<GlwVertexAttribute>& attributes
+)
+	: Mode{ mode },
+	VertexStride{ vertex_stride },
+	VertexCapacity{ vertex_capacity },
+	IndexCapacity{ index_capacity },
+	Attributes{ attributes }
+{ }
@@ -36,20 +36,35 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 GlwMesh::GlwMesh( )
 	: m_vao{ },
+	m_format{ nullptr },
+	m_bindings{ },
 	m_vbo{ },
-	m_ibo{ }
+	m_ibo{ },
+	m_instances{ },
+	m_index_request{ GlwIndexTypes::Automatic },
+	m_index_type{ GlwIndexTypes::Unsigned_Int },
+	m_statistics{ },
+	m_lods{ },
+	m_bounds{ }
 { }
 
 bool GlwMesh::Create( const GlwMeshSpecification& specification ) {
-	auto result = m_vao.Create( ) && m_vbo.Create( specification.Vertex );
-
-	if ( result && specification.UseIndex )
-		result = m_ibo.Create( specification.Index );
+	auto result = m_vao.Create( ) && CreateBuffers( specification );
 
 	if ( result )
-		m_vao.Link( specification.Attributes );
+		m_vao.Link( specification.Attributes, m_vbo, m_instances, m_ibo );
 
-	glBindVertexArray( GL_NULL );
+	return result;
+}
+
+bool GlwMesh::Create(
+	const GlwMeshSpecification& specification,
+	GlwVertexFormatRegistry& formats
+) {
+	auto result = CreateBuffers( specification ) && formats.Acquire( specification.Attributes, m_format );
+
+	if ( result )
+		LinkBindings( specification.Attributes );
 
 	return result;
 }
@@ -63,6 +78,14 @@ bool GlwMesh::FillVertex( const uint32_t length, const void* vertices ) {
 	return result;
 }
 
+bool GlwMesh::UpdateVertex(
+	const uint32_t offset,
+	const uint32_t length,
+	const void* vertices
+) {
+	return m_vbo.Update( offset, length, vertices );
+}
+
 bool GlwMesh::FillIndex( const std::vector<uint32_t>& indexes ) {
 	auto* data  = indexes.data( );
 	auto length = (uint32_t)( indexes.size( ) * sizeof( uint32_t ) );
@@ -71,37 +94,244 @@ bool GlwMesh::FillIndex( const std::vector<uint32_t>& indexes ) {
 }
 
 bool GlwMesh::FillIndex( const uint32_t length, const uint32_t* indexes ) {
-	auto result = length > 0 && indexes != nullptr;
+	auto count  = length / (uint32_t)sizeof( uint32_t );
+	auto result = count > 0 && indexes != nullptr;
+
+	if ( !result )
+		return false;
+
+	auto maximum = *std::max_element( indexes, indexes + count );
+
+	m_index_type = GetIndexType( m_index_request, maximum );
+
+	m_lods.assign( 1, GlwMeshLod{ 0, count, 0.f } );
+
+	switch ( m_index_type ) {
+		case GlwIndexTypes::Unsigned_Byte : {
+			auto narrowed = std::vector<uint8_t>( indexes, indexes + count );
+
+			m_ibo.Fill( count, narrowed.data( ) );
+		} break;
+
+		case GlwIndexTypes::Unsigned_Short : {
+			auto narrowed = std::vector<uint16_t>( indexes, indexes + count );
+
+			m_ibo.Fill( count * (uint32_t)sizeof( uint16_t ), narrowed.data( ) );
+		} break;
+
+		default : m_ibo.Fill( count * (uint32_t)sizeof( uint32_t ), indexes ); break;
+	}
+
+	return result;
+}
+
+bool GlwMesh::FillInstance( const uint32_t length, const void* instances ) {
+	auto result = m_instances.GetIsValid( ) && length > 0 && instances != nullptr;
 
 	if ( result )
-		m_ibo.Fill( length, indexes );
+		m_instances.Fill( length, instances );
 
 	return result;
 }
 
-void GlwMesh::Use( ) {
-	m_vao.Use( );
+bool GlwMesh::UpdateInstance(
+	const uint32_t offset,
+	const uint32_t length,
+	const void* instances
+) {
+	return m_instances.Update( offset, length, instances );
+}
+
+void GlwMesh::SetBounds( const GlwMeshBounds& bounds ) {
+	m_bounds = bounds;
+}
+
+void GlwMesh::Use( GlwStateTracker& state_tracker ) {
+	if ( m_format == nullptr ) {
+		m_vao.Use( state_tracker );
+
+		return;
+	}
+
+	for ( auto& binding : m_bindings ) {
+		auto buffer = binding.Instanced ? m_instances.Get( ) : m_vbo.Get( );
+
+		m_format->Bind( binding.Binding, buffer, binding.Stride );
+	}
+
+	if ( m_ibo.GetIsValid( ) )
+		m_format->BindIndex( m_ibo );
+
+	m_format->Use( state_tracker );
 }
 
 void GlwMesh::Destroy( ) {
+	m_format = nullptr;
+	m_bounds = { };
+
+	m_bindings.clear( );
+	m_lods.clear( );
 	m_vbo.Destroy( );
 	m_ibo.Destroy( );
+	m_instances.Destroy( );
 	m_vao.Destroy( );
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwMesh::CreateBuffers( const GlwMeshSpecification& specification ) {
+	auto result = m_vbo.Create( specification.Vertex );
+
+	if ( result && specification.UseIndex )
+		result = m_ibo.Create( specification.Index );
+
+	if ( result && specification.UseInstance )
+		result = m_instances.Create( specification.Instance );
+
+	if ( result )
+		m_index_request = specification.IndexType;
+
+	return result;
+}
+
+void GlwMesh::LinkBindings( const std::vector<GlwVertexAttribute>& attributes ) {
+	m_bindings.clear( );
+
+	for ( auto& attribute : attributes ) {
+		if ( attribute.Size == 0 || attribute.Size > 4 )
+			continue;
+
+		auto is_linked = std::any_of( 
+			m_bindings.begin( ), m_bindings.end( ), 
+			[ &attribute ]( const GlwVertexBinding& binding ) { return binding.Binding == attribute.Binding; }
+		);
+
+		if ( is_linked )
+			continue;
+
+		auto is_instanced = attribute.GetIsInstanced( ) && m_instances.GetIsValid( );
+
+		m_bindings.emplace_back( attribute.Binding, GlwVertexArray::GetStride( attribute ), is_instanced );
+	}
+}
+
+void GlwMesh::BuildLods(
+	const GlwMeshLodSpecification& specification,
+	const bool optimize_cache,
+	const uint32_t stride,
+	const uint32_t position_offset,
+	const uint32_t vertex_count,
+	const void* vertices,
+	std::vector<uint32_t>& indexes,
+	std::vector<GlwMeshLod>& lods
+) {
+	if ( !GlwMeshSimplifier::Build( specification, stride, position_offset, vertex_count, vertices, indexes, lods ) || !optimize_cache )
+		return;
+
+	for ( auto lod = lods.begin( ) + 1; lod < lods.end( ); lod++ ) {
+		auto begin = indexes.begin( ) + lod->FirstIndex;
+		auto range = std::vector<uint32_t>( begin, begin + lod->IndexCount );
+
+		GlwMeshOptimizer::OptimizeVertexCache( vertex_count, range );
+
+		std::copy( range.begin( ), range.end( ), begin );
+	}
+}
+
+void GlwMesh::LinkBounds(
+	const uint32_t stride,
+	const uint32_t position_offset,
+	const uint32_t vertex_count,
+	const void* vertices,
+	const std::vector<uint32_t>& indexes
+) {
+	m_bounds = GlwMeshBounds::Compute( stride, position_offset, vertex_count, vertices );
+
+	for ( auto& lod : m_lods ) {
+		if ( lod.FirstIndex + lod.IndexCount <= (uint32_t)indexes.size( ) )
+			lod.Bounds = GlwMeshBounds::Compute( stride, position_offset, vertices, lod.IndexCount, indexes.data( ) + lod.FirstIndex );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwIndexTypes GlwMesh::GetIndexType( const GlwIndexTypes request, const uint32_t maximum ) {
+	auto result = GlwIndexTypes::Unsigned_Int;
+
+	if ( request == GlwIndexTypes::Unsigned_Byte && maximum <= UINT8_MAX )
+		result = GlwIndexTypes::Unsigned_Byte;
+	else if ( request != GlwIndexTypes::Unsigned_Int && maximum <= UINT16_MAX )
+		result = GlwIndexTypes::Unsigned_Short;
+
+	return result;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 bool GlwMesh::GetIsValid( ) const {
-	return glIsValid( m_vao ) && m_vbo.GetIsValid( );
+	return ( glIsValid( m_vao ) || m_format != nullptr ) && m_vbo.GetIsValid( );
 }
 
 bool GlwMesh::GetHasIndex( ) const {
 	return m_ibo.GetIsValid( );
 }
 
+bool GlwMesh::GetHasInstance( ) const {
+	return m_instances.GetIsValid( );
+}
+
+GlwIndexTypes GlwMesh::GetIndexType( ) const {
+	return m_index_type;
+}
+
+uint32_t GlwMesh::GetIndexSize( ) const {
+	auto result = (uint32_t)sizeof( uint32_t );
+
+	switch ( m_index_type ) {
+		case GlwIndexTypes::Unsigned_Byte  : result = sizeof( uint8_t ); break;
+		case GlwIndexTypes::Unsigned_Short : result = sizeof( uint16_t ); break;
+
+		default : break;
+	}
+
+	return result;
+}
+
+bool GlwMesh::GetIsShared( ) const {
+	return m_format != nullptr;
+}
+
+const GlwMeshOptimizerStatistics& GlwMesh::GetStatistics( ) const {
+	return m_statistics;
+}
+
+GlwMeshLod GlwMesh::GetLod( const float screen_size, const float pixel_error ) const {
+	auto result = GlwMeshLod{ };
+
+	for ( auto lod = m_lods.rbegin( ); lod != m_lods.rend( ); lod++ ) {
+		if ( lod->Error * screen_size <= pixel_error || lod + 1 == m_lods.rend( ) ) {
+			result = *lod;
+
+			break;
+		}
+	}
+
+	return result;
+}
+
+const std::vector<GlwMeshLod>& GlwMesh::GetLods( ) const {
+	return m_lods;
+}
+
+const GlwMeshBounds& GlwMesh::GetBounds( ) const {
+	return m_bounds;
+}
+
 const GlwVertexArray& GlwMesh::GetVAO( ) const {
-	return m_vao;
+	return GetIsShared( ) ? m_format->GetVAO( ) : m_vao;
 }
 
 const GlwBuffer& GlwMesh::GetVBO( ) const {
@@ -112,6 +342,10 @@ const GlwBuffer& GlwMesh::GetIBO( ) const {
 	return m_ibo;
 }
 
+const GlwBuffer& GlwMesh::GetInstanceBuffer( ) const {
+	return m_instances;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	OPERATOR ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -119,9 +353,18 @@ GlwMesh& GlwMesh::operator=( const GlwMesh& other ) {
 	if ( other.GetIsValid( ) ) {
 		Destroy( );
 
-		m_vao = other.GetVAO( );
-		m_vbo = other.GetVBO( );
-		m_ibo = other.GetIBO( );
+		m_vao       = other.m_vao;
+		m_format    = other.m_format;
+		m_bindings  = other.m_bindings;
+		m_vbo       = other.GetVBO( );
+		m_ibo       = other.GetIBO( );
+		m_instances = other.GetInstanceBuffer( );
+
+		m_index_request = other.m_index_request;
+		m_index_type    = other.GetIndexType( );
+		m_statistics    = other.GetStatistics( );
+		m_lods          = other.GetLods( );
+		m_bounds        = other.GetBounds( );
 	}
 
 	return *this;
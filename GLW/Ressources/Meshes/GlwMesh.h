@@ -31,14 +31,22 @@
 
 #pragma once
 
-#include "GlwMeshStaticSpecification.h"
+#include "GlwMeshSimplifier.h"
 
 class GlwMesh : public GlwRessource<GlwMeshSpecification> {
 
 protected:
 	GlwVertexArray m_vao;
+	GlwVertexFormat* m_format;
+	std::vector<GlwVertexBinding> m_bindings;
 	GlwBuffer m_vbo;
 	GlwBuffer m_ibo;
+	GlwBuffer m_instances;
+	GlwIndexTypes m_index_request;
+	GlwIndexTypes m_index_type;
+	GlwMeshOptimizerStatistics m_statistics;
+	std::vector<GlwMeshLod> m_lods;
+	GlwMeshBounds m_bounds;
 
 public:
 	/**
@@ -59,6 +67,17 @@ public:
 	 **/
 	virtual bool Create( const GlwMeshSpecification& specification ) override;
 
+	/**
+	 * Create function
+	 * @note : Create mesh according to query specification, the vertex array
+	 *		   is shared with every mesh of the same format and only buffers
+	 *		   are rebound when the mesh is used.
+	 * @param specification : Query mesh specification.
+	 * @param formats : Query vertex format registry.
+	 * @return : True when creation succeeded.
+	 **/
+	bool Create( const GlwMeshSpecification& specification, GlwVertexFormatRegistry& formats );
+
 	/**
 	 * FillVertex function
 	 * @note : Fill vertex buffer.
@@ -68,6 +87,16 @@ public:
 	 **/
 	bool FillVertex( const uint32_t length, const void* vertices );
 
+	/**
+	 * UpdateVertex function
+	 * @note : Update a range of the vertex buffer without re-specifying its storage.
+	 * @param offset : Offset of the range in bytes.
+	 * @param length : Length of the range in bytes.
+	 * @param vertices : Pointer to range vertices.
+	 * @return : True when operation succeeded.
+	 **/
+	bool UpdateVertex( const uint32_t offset, const uint32_t length, const void* vertices );
+
 	/**
 	 * FillIndex function
 	 * @note : Fill index buffer.
@@ -78,18 +107,47 @@ public:
 
 	/**
 	 * FillIndex function
-	 * @note : Fill index buffer.
+	 * @note : Fill index buffer, indexes are narrowed to the smallest type 
+	 *		   allowed by the specification index type that hold the largest index.
+	 *		   Mesh is reset to a single level of detail covering all indexes.
 	 * @param length : Length of index buffer in bytes.
 	 * @param vertices : Pointer to index buffer.
 	 * @return : True when operation succeeded.
 	 **/
 	bool FillIndex( const uint32_t length, const uint32_t* indexes );
 
+	/**
+	 * FillInstance function
+	 * @note : Fill instance buffer.
+	 * @param length : Length of instance buffer in bytes.
+	 * @param instances : Pointer to instance buffer.
+	 * @return : True when operation succeeded.
+	 **/
+	bool FillInstance( const uint32_t length, const void* instances );
+
+	/**
+	 * UpdateInstance function
+	 * @note : Update a range of the instance buffer according to its update mode.
+	 * @param offset : Offset of the range in bytes.
+	 * @param length : Length of the range in bytes.
+	 * @param instances : Pointer to range instances.
+	 * @return : True when operation succeeded.
+	 **/
+	bool UpdateInstance( const uint32_t offset, const uint32_t length, const void* instances );
+
+	/**
+	 * SetBounds method
+	 * @note : Set object space bounds of meshes filled with raw vertices.
+	 * @param bounds : Query mesh bounds.
+	 **/
+	void SetBounds( const GlwMeshBounds& bounds );
+
 	/**
 	 * Use method
 	 * @note : Bind mesh for usage. 
+	 * @param state_tracker : Query current state tracker.
 	 **/
-	void Use( );
+	void Use( GlwStateTracker& state_tracker );
 
 	/**
 	 * Destroy method
@@ -97,10 +155,78 @@ public:
 	 **/
 	virtual void Destroy( ) override;
 
+private:
+	/**
+	 * CreateBuffers function
+	 * @note : Create mesh buffers according to query specification.
+	 * @param specification : Query mesh specification.
+	 * @return : True when creation succeeded.
+	 **/
+	bool CreateBuffers( const GlwMeshSpecification& specification );
+
+	/**
+	 * LinkBindings method
+	 * @note : Store binding slots read by attributes for shared format usage.
+	 * @param attributes : Query attribute list.
+	 **/
+	void LinkBindings( const std::vector<GlwVertexAttribute>& attributes );
+
+	/**
+	 * BuildLods method
+	 * @note : Append simplified levels of detail to indexes.
+	 * @param specification : Query level of detail specification.
+	 * @param optimize_cache : Query vertex cache optimization of each level.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param position_offset : Query offset of 3 float position in vertex.
+	 * @param vertex_count : Query vertex count.
+	 * @param vertices : Query vertices.
+	 * @param indexes : Query full detail indexes, store all levels indexes.
+	 * @param lods : Store index range of each level.
+	 **/
+	void BuildLods(
+		const GlwMeshLodSpecification& specification,
+		const bool optimize_cache,
+		const uint32_t stride,
+		const uint32_t position_offset,
+		const uint32_t vertex_count,
+		const void* vertices,
+		std::vector<uint32_t>& indexes,
+		std::vector<GlwMeshLod>& lods
+	);
+
+	/**
+	 * LinkBounds method
+	 * @note : Compute bounds of the mesh and of each level of detail.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param position_offset : Query offset of 3 float position in vertex.
+	 * @param vertex_count : Query vertex count.
+	 * @param vertices : Query vertices.
+	 * @param indexes : Query indexes of all levels.
+	 **/
+	void LinkBounds(
+		const uint32_t stride,
+		const uint32_t position_offset,
+		const uint32_t vertex_count,
+		const void* vertices,
+		const std::vector<uint32_t>& indexes
+	);
+
+	/**
+	 * GetIndexType static function
+	 * @note : Get smallest index type holding query index, Automatic narrow
+	 *		   to 16 bits at most since 8 bits indexes are emulated by most GPUs.
+	 * @param request : Query preferred index type.
+	 * @param maximum : Query largest index.
+	 * @return : Return index type value.
+	 **/
+	static GlwIndexTypes GetIndexType( const GlwIndexTypes request, const uint32_t maximum );
+
 public:
 	/**
 	 * Create template function
-	 * @note : Create 'static' mesh according to query specification.
+	 * @note : Create 'static' mesh according to query specification, when a
+	 *		   GlwVertexLayout is declared for the vertex type the vertex array 
+	 *		   is linked from it and specification attributes are ignored.
 	 * @template VertexType : Type of data used for vertex representation.
 	 * @param specification : Query 'static' mesh specification.
 	 * @return : True when creation succeeded.
@@ -108,10 +234,45 @@ public:
 	template<typename VertexType>
 	bool Create( const GlwMeshStaticSpecification<VertexType>& specification ) {
 		auto mesh_spec = specification.GetMeshSpec( );
+		auto result    = Create( mesh_spec );
 
-		return  Create( mesh_spec )								 &&
-				FillVertex<VertexType>( specification.Vertices ) &&
-				FillIndex( specification.Indexes );
+		if constexpr ( GlwVertexLayoutDeclared<VertexType> ) {
+			if ( result )
+				m_vao.Link<VertexType>( m_vbo, m_ibo );
+		}
+
+		return result && FillStatic<VertexType>( specification );
+	};
+
+	/**
+	 * Create template function
+	 * @note : Create 'static' mesh according to query specification using a
+	 *		   shared vertex format, taken from GlwVertexLayout when declared
+	 *		   for the vertex type.
+	 * @template VertexType : Type of data used for vertex representation.
+	 * @param specification : Query 'static' mesh specification.
+	 * @param formats : Query vertex format registry.
+	 * @return : True when creation succeeded.
+	 **/
+	template<typename VertexType>
+	bool Create( 
+		const GlwMeshStaticSpecification<VertexType>& specification,
+		GlwVertexFormatRegistry& formats
+	) {
+		auto mesh_spec = specification.GetMeshSpec( );
+		auto result    = false;
+
+		if constexpr ( GlwVertexLayoutDeclared<VertexType> ) {
+			result = CreateBuffers( mesh_spec ) && formats.Acquire<VertexType>( m_format );
+
+			if ( result ) {
+				m_bindings.clear( );
+				m_bindings.emplace_back( 0, GlwVertexLayoutTraits<VertexType>::Stride, false );
+			}
+		} else
+			result = Create( mesh_spec, formats );
+
+		return result && FillStatic<VertexType>( specification );
 	};
 
 	/**
@@ -129,6 +290,55 @@ public:
 		return FillVertex( length, data );
 	};
 
+	/**
+	 * UpdateVertex template function
+	 * @note : Update a range of the vertex buffer.
+	 * @template VertexType : Type of data used for vertex representation.
+	 * @param vertex : Index of the first vertex to update.
+	 * @param vertices : Vertex list.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename VertexType>
+	bool UpdateVertex( const uint32_t vertex, const std::vector<VertexType>& vertices ) {
+		auto* data  = (void*)vertices.data( );
+		auto offset = (uint32_t)( vertex * sizeof( VertexType ) );
+		auto length = (uint32_t)( vertices.size( ) * sizeof( VertexType ) );
+
+		return UpdateVertex( offset, length, data );
+	};
+
+	/**
+	 * FillInstance template function
+	 * @note : Fill instance buffer.
+	 * @template InstanceType : Type of data used for instance representation.
+	 * @param instances : Instance list.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename InstanceType>
+	bool FillInstance( const std::vector<InstanceType>& instances ) {
+		auto* data  = (const void*)instances.data( );
+		auto length = (uint32_t)( instances.size( ) * sizeof( InstanceType ) );
+
+		return FillInstance( length, data );
+	};
+
+	/**
+	 * UpdateInstance template function
+	 * @note : Update a range of the instance buffer.
+	 * @template InstanceType : Type of data used for instance representation.
+	 * @param instance : Index of the first instance to update.
+	 * @param instances : Instance list.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename InstanceType>
+	bool UpdateInstance( const uint32_t instance, const std::vector<InstanceType>& instances ) {
+		auto* data  = (const void*)instances.data( );
+		auto offset = (uint32_t)( instance * sizeof( InstanceType ) );
+		auto length = (uint32_t)( instances.size( ) * sizeof( InstanceType ) );
+
+		return UpdateInstance( offset, length, data );
+	};
+
 	/**
 	 * Fill template function
 	 * @note : Fill vertex and index buffer.
@@ -145,6 +355,85 @@ public:
 		return FillVertex<VertexType>( vertices ) && FillIndex( indexes );
 	};
 
+private:
+	/**
+	 * FillStatic template function
+	 * @note : Fill vertex and index buffer from 'static' mesh specification, 
+	 *		   running requested optimizations and level of detail generation
+	 *		   on a copy of its data first, then compute mesh and levels bounds.
+	 *		   Overdraw optimization, level of detail generation and bounds are
+	 *		   skipped when no 3 floats position is found at specification
+	 *		   position location.
+	 * @template VertexType : Type of data used for vertex representation.
+	 * @param specification : Query 'static' mesh specification.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename VertexType>
+	bool FillStatic( const GlwMeshStaticSpecification<VertexType>& specification ) {
+		auto stride          = (uint32_t)sizeof( VertexType );
+		auto position_offset = (uint32_t)0;
+		auto has_position    = GetPositionOffset<VertexType>( specification, position_offset );
+		auto is_optimized    = specification.Optimizer.GetIsEnabled( );
+		auto is_lod          = has_position && specification.Lod.GetIsEnabled( );
+
+		if ( !( is_optimized || is_lod ) || specification.Indexes.empty( ) ) {
+			auto result = FillVertex<VertexType>( specification.Vertices ) && FillIndex( specification.Indexes );
+
+			if ( result && has_position )
+				LinkBounds( stride, position_offset, (uint32_t)specification.Vertices.size( ), specification.Vertices.data( ), specification.Indexes );
+
+			return result;
+		}
+
+		auto optimizer    = specification.Optimizer;
+		auto vertices     = specification.Vertices;
+		auto indexes      = specification.Indexes;
+		auto lods         = std::vector<GlwMeshLod>( );
+		auto vertex_count = (uint32_t)vertices.size( );
+
+		if ( is_optimized ) {
+			optimizer.Overdraw = optimizer.Overdraw && has_position;
+
+			vertex_count = GlwMeshOptimizer::Optimize( optimizer, stride, position_offset, vertex_count, vertices.data( ), indexes, m_statistics );
+		}
+
+		if ( is_lod )
+			BuildLods( specification.Lod, optimizer.VertexCache, stride, position_offset, vertex_count, vertices.data( ), indexes, lods );
+
+		vertices.resize( vertex_count );
+
+		auto result = FillVertex<VertexType>( vertices ) && FillIndex( indexes );
+
+		if ( result && lods.size( ) > 1 )
+			m_lods = lods;
+
+		if ( result && has_position )
+			LinkBounds( stride, position_offset, vertex_count, vertices.data( ), indexes );
+
+		return result;
+	};
+
+	/**
+	 * GetPositionOffset template function
+	 * @note : Find 3 floats position of 'static' mesh specification at its 
+	 *		   position location, from GlwVertexLayout when declared for the 
+	 *		   vertex type.
+	 * @template VertexType : Type of data used for vertex representation.
+	 * @param specification : Query 'static' mesh specification.
+	 * @param offset : Store position offset in vertex.
+	 * @return : Return true when position exist.
+	 **/
+	template<typename VertexType>
+	bool GetPositionOffset(
+		const GlwMeshStaticSpecification<VertexType>& specification,
+		uint32_t& offset
+	) const {
+		if constexpr ( GlwVertexLayoutDeclared<VertexType> )
+			return GlwMeshOptimizer::GetPositionOffset<VertexType>( specification.PositionLocation, offset );
+		else
+			return GlwMeshOptimizer::GetPositionOffset( specification.Attributes, specification.PositionLocation, offset );
+	};
+
 public:
 	/**
 	 * GetIsValid const function
@@ -160,9 +449,72 @@ public:
 	 **/
 	bool GetHasIndex( ) const;
 
+	/**
+	 * GetHasInstance const function
+	 * @note : Get if current mesh use an instance buffer.
+	 * @return : True when mesh instance buffer is valid.
+	 **/
+	bool GetHasInstance( ) const;
+
+	/**
+	 * GetIndexType const function
+	 * @note : Get type of current index buffer elements.
+	 * @return : Return index type value.
+	 **/
+	GlwIndexTypes GetIndexType( ) const;
+
+	/**
+	 * GetIndexSize const function
+	 * @note : Get size of current index buffer elements.
+	 * @return : Return index size in bytes.
+	 **/
+	uint32_t GetIndexSize( ) const;
+
+	/**
+	 * GetIsShared const function
+	 * @note : Get if current mesh use a shared vertex format.
+	 * @return : True when mesh vertex array is owned by a vertex format.
+	 **/
+	bool GetIsShared( ) const;
+
+	/**
+	 * GetStatistics const function
+	 * @note : Get vertex cache statistics of mesh optimization, empty when
+	 *		   no optimization was requested.
+	 * @return : Return ACMR and ATVR before and after optimization.
+	 **/
+	const GlwMeshOptimizerStatistics& GetStatistics( ) const;
+
+	/**
+	 * GetLod const function
+	 * @note : Get coarsest level of detail whose error projected on screen
+	 *		   stay under query pixel error.
+	 * @param screen_size : Query projected mesh diameter in pixels, see 
+	 *						GlwMeshLod::GetScreenSize.
+	 * @param pixel_error : Query allowed error in pixels.
+	 * @return : Return level of detail index range.
+	 **/
+	GlwMeshLod GetLod( const float screen_size, const float pixel_error ) const;
+
+	/**
+	 * GetLods const function
+	 * @note : Get levels of detail, full detail first.
+	 * @return : Return constant reference to level of detail list.
+	 **/
+	const std::vector<GlwMeshLod>& GetLods( ) const;
+
+	/**
+	 * GetBounds const function
+	 * @note : Get object space bounding box and sphere, computed when mesh is
+	 *		   created from a 'static' specification.
+	 * @return : Return constant reference to mesh bounds.
+	 **/
+	const GlwMeshBounds& GetBounds( ) const;
+
 	/**
 	 * GetVAO const function
-	 * @note : Get current vertex array instance.
+	 * @note : Get current vertex array instance, shared one when mesh use 
+	 *		   a vertex format.
 	 * @return : Constant reference to vertex array.
 	 **/
 	const GlwVertexArray& GetVAO( ) const;
@@ -181,6 +533,13 @@ public:
 	 **/
 	const GlwBuffer& GetIBO( ) const;
 
+	/**
+	 * GetInstanceBuffer const function
+	 * @note : Get current instance buffer instance.
+	 * @return : Constant reference to instance buffer.
+	 **/
+	const GlwBuffer& GetInstanceBuffer( ) const;
+
 public:
 	/**
 	 * Assign operator
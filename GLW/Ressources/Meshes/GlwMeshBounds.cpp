@@ -0,0 +1,162 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwMeshBounds::GlwMeshBounds( )
+	: GlwMeshBounds{ glm::vec3{ FLT_MAX }, glm::vec3{ -FLT_MAX }, glm::vec3{ 0.f }, 0.f }
+{ }
+
+GlwMeshBounds::GlwMeshBounds(
+	const glm::vec3& minimum,
+	const glm::vec3& maximum,
+	const glm::vec3& center,
+	const float radius
+)
+	: Minimum{ minimum },
+	Maximum{ maximum },
+	Center{ center },
+	Radius{ radius }
+{ }
+
+GlwMeshBounds GlwMeshBounds::Transform( const glm::mat4& transform ) const {
+	if ( !GetIsValid( ) )
+		return { };
+
+	auto box_center = ( Minimum + Maximum ) * .5f;
+	auto extent     = GetExtent( );
+	auto result     = GlwMeshBounds{ };
+	auto scale      = 0.f;
+
+	for ( auto row = 0; row < 3; row++ ) {
+		auto world_center = transform[ 3 ][ row ];
+		auto world_extent = 0.f;
+		auto sphere       = transform[ 3 ][ row ];
+
+		for ( auto column = 0; column < 3; column++ ) {
+			world_center += transform[ column ][ row ] * box_center[ column ];
+			world_extent += std::abs( transform[ column ][ row ] ) * extent[ column ];
+			sphere       += transform[ column ][ row ] * Center[ column ];
+		}
+
+		result.Minimum[ row ] = world_center - world_extent;
+		result.Maximum[ row ] = world_center + world_extent;
+		result.Center[ row ]  = sphere;
+	}
+
+	for ( auto column = 0; column < 3; column++ ) {
+		auto axis = glm::vec3{ transform[ column ][ 0 ], transform[ column ][ 1 ], transform[ column ][ 2 ] };
+
+		scale = std::max( scale, glm::length( axis ) );
+	}
+
+	result.Radius = Radius * scale;
+
+	return result;
+}
+
+GlwMeshBounds GlwMeshBounds::Compute(
+	const uint32_t stride,
+	const uint32_t position_offset,
+	const uint32_t vertex_count,
+	const void* vertices
+) {
+	auto result = GlwMeshBounds{ };
+
+	if ( vertices == nullptr )
+		return result;
+
+	for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ ) {
+		auto position = GlwMeshOptimizer::GetPosition( stride, position_offset, vertices, vertex );
+
+		result.Minimum = glm::min( result.Minimum, position );
+		result.Maximum = glm::max( result.Maximum, position );
+	}
+
+	if ( result.GetIsValid( ) ) {
+		result.Center = ( result.Minimum + result.Maximum ) * .5f;
+
+		for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ ) {
+			auto position = GlwMeshOptimizer::GetPosition( stride, position_offset, vertices, vertex );
+
+			result.Radius = std::max( result.Radius, glm::distance( result.Center, position ) );
+		}
+	}
+
+	return result;
+}
+
+GlwMeshBounds GlwMeshBounds::Compute(
+	const uint32_t stride,
+	const uint32_t position_offset,
+	const void* vertices,
+	const uint32_t index_count,
+	const uint32_t* indexes
+) {
+	auto result = GlwMeshBounds{ };
+
+	if ( vertices == nullptr || indexes == nullptr )
+		return result;
+
+	for ( auto index = (uint32_t)0; index < index_count; index++ ) {
+		auto position = GlwMeshOptimizer::GetPosition( stride, position_offset, vertices, indexes[ index ] );
+
+		result.Minimum = glm::min( result.Minimum, position );
+		result.Maximum = glm::max( result.Maximum, position );
+	}
+
+	if ( result.GetIsValid( ) ) {
+		result.Center = ( result.Minimum + result.Maximum ) * .5f;
+
+		for ( auto index = (uint32_t)0; index < index_count; index++ ) {
+			auto position = GlwMeshOptimizer::GetPosition( stride, position_offset, vertices, indexes[ index ] );
+
+			result.Radius = std::max( result.Radius, glm::distance( result.Center, position ) );
+		}
+	}
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwMeshBounds::GetIsValid( ) const {
+	return Minimum.x <= Maximum.x && Minimum.y <= Maximum.y && Minimum.z <= Maximum.z;
+}
+
+glm::vec3 GlwMeshBounds::GetExtent( ) const {
+	return GetIsValid( ) ? ( Maximum - Minimum ) * .5f : glm::vec3{ 0.f };
+}
@@ -0,0 +1,121 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwMeshOptimizerSpecification.h"
+
+struct GlwMeshBounds {
+
+	glm::vec3 Minimum;
+	glm::vec3 Maximum;
+	glm::vec3 Center;
+	float Radius;
+
+	/**
+	 * Constructor
+	 * @note : Empty bounds, Minimum is greater than Maximum.
+	 **/
+	GlwMeshBounds( );
+
+	/**
+	 * Constructor
+	 * @param minimum : Query bounding box minimum.
+	 * @param maximum : Query bounding box maximum.
+	 * @param center : Query bounding sphere center.
+	 * @param radius : Query bounding sphere radius.
+	 **/
+	GlwMeshBounds(
+		const glm::vec3& minimum,
+		const glm::vec3& maximum,
+		const glm::vec3& center,
+		const float radius
+	);
+
+	/**
+	 * Transform const function
+	 * @note : Get bounds enclosing current bounds transformed by query matrix,
+	 *		   sphere radius is scaled by the largest axis scale.
+	 * @param transform : Query object to world matrix.
+	 * @return : Return transformed bounds.
+	 **/
+	GlwMeshBounds Transform( const glm::mat4& transform ) const;
+
+	/**
+	 * Compute static function
+	 * @note : Get bounds of vertex positions, sphere is centered on the box.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param position_offset : Query offset of 3 float position in vertex.
+	 * @param vertex_count : Query vertex count.
+	 * @param vertices : Query vertices.
+	 * @return : Return vertex bounds.
+	 **/
+	static GlwMeshBounds Compute(
+		const uint32_t stride,
+		const uint32_t position_offset,
+		const uint32_t vertex_count,
+		const void* vertices
+	);
+
+	/**
+	 * Compute static function
+	 * @note : Get bounds of vertices referenced by an index range.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param position_offset : Query offset of 3 float position in vertex.
+	 * @param vertices : Query vertices.
+	 * @param index_count : Query index count.
+	 * @param indexes : Query indexes.
+	 * @return : Return bounds of referenced vertices.
+	 **/
+	static GlwMeshBounds Compute(
+		const uint32_t stride,
+		const uint32_t position_offset,
+		const void* vertices,
+		const uint32_t index_count,
+		const uint32_t* indexes
+	);
+
+	/**
+	 * GetIsValid const function
+	 * @note : Get if bounds enclose at least one point.
+	 * @return : Return true when Minimum is lower or equal to Maximum.
+	 **/
+	bool GetIsValid( ) const;
+
+	/**
+	 * GetExtent const function
+	 * @note : Get bounding box half size.
+	 * @return : Return half size on each axis.
+	 **/
+	glm::vec3 GetExtent( ) const;
+
+};
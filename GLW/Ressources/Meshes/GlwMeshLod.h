@@ -0,0 +1,73 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwMeshBounds.h"
+
+struct GlwMeshLod {
+
+	uint32_t FirstIndex;
+	uint32_t IndexCount;
+	float Error;
+	GlwMeshBounds Bounds;
+
+	/**
+	 * Constructor
+	 **/
+	GlwMeshLod( );
+
+	/**
+	 * Constructor
+	 * @param first_index : Query first index of the level in mesh index buffer.
+	 * @param index_count : Query index count of the level.
+	 * @param error : Query simplification error relative to mesh diameter.
+	 **/
+	GlwMeshLod( const uint32_t first_index, const uint32_t index_count, const float error );
+
+	/**
+	 * GetScreenSize static function
+	 * @note : Get projected diameter of a bounding sphere in pixels.
+	 * @param radius : Query bounding sphere radius.
+	 * @param distance : Query distance from camera to sphere center.
+	 * @param fov_y : Query vertical field of view in radians.
+	 * @param viewport_height : Query viewport height in pixels.
+	 * @return : Return projected diameter in pixels.
+	 **/
+	static float GetScreenSize(
+		const float radius,
+		const float distance,
+		const float fov_y,
+		const float viewport_height
+	);
+
+};
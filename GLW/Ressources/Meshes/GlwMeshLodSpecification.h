@@ -0,0 +1,75 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwMeshLod.h"
+
+struct GlwMeshLodSpecification {
+
+	uint32_t Levels;
+	float Ratio;
+	float MaxError;
+
+	/**
+	 * Constructor
+	 **/
+	GlwMeshLodSpecification( );
+
+	/**
+	 * Constructor
+	 * @note : Each level keep half the indexes of the previous one, with at
+	 *		   most 5% of mesh diameter error.
+	 * @param levels : Query count of simplified levels after full detail.
+	 **/
+	GlwMeshLodSpecification( const uint32_t levels );
+
+	/**
+	 * Constructor
+	 * @param levels : Query count of simplified levels after full detail.
+	 * @param ratio : Query index count ratio between two levels.
+	 * @param max_error : Query maximum error relative to mesh diameter.
+	 **/
+	GlwMeshLodSpecification(
+		const uint32_t levels,
+		const float ratio,
+		const float max_error
+	);
+
+	/**
+	 * GetIsEnabled const function
+	 * @note : Get if level of details must be generated.
+	 * @return : Return true when levels and ratio are valid.
+	 **/
+	bool GetIsEnabled( ) const;
+
+};
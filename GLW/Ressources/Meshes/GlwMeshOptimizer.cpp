@@ -0,0 +1,416 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t GlwMeshOptimizer::Optimize(
+	const GlwMeshOptimizerSpecification& specification,
+	const uint32_t stride,
+	const uint32_t position_offset,
+	const uint32_t vertex_count,
+	void* vertices,
+	std::vector<uint32_t>& indexes,
+	GlwMeshOptimizerStatistics& statistics
+) {
+	auto result = vertex_count;
+
+	if ( !GetIsIndexValid( vertex_count, indexes ) )
+		return result;
+
+	statistics.Before = GetVertexCacheStatistics( vertex_count, specification.CacheSize, indexes );
+
+	if ( specification.VertexCache )
+		OptimizeVertexCache( vertex_count, indexes );
+
+	if ( specification.Overdraw )
+		OptimizeOverdraw( vertex_count, stride, position_offset, vertices, specification.CacheSize, specification.OverdrawThreshold, indexes );
+
+	if ( specification.VertexFetch )
+		result = OptimizeVertexFetch( vertex_count, stride, vertices, indexes );
+
+	statistics.After = GetVertexCacheStatistics( result, specification.CacheSize, indexes );
+
+	return result;
+}
+
+void GlwMeshOptimizer::OptimizeVertexCache( const uint32_t vertex_count, std::vector<uint32_t>& indexes ) {
+	if ( !GetIsIndexValid( vertex_count, indexes ) )
+		return;
+
+	auto triangle_count = (uint32_t)( indexes.size( ) / 3 );
+	auto remaining      = std::vector<uint32_t>( vertex_count, 0 );
+	auto offsets        = std::vector<uint32_t>( vertex_count + 1, 0 );
+	auto adjacency      = std::vector<uint32_t>( indexes.size( ) );
+
+	for ( auto index : indexes )
+		remaining[ index ] += 1;
+
+	for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ )
+		offsets[ vertex + 1 ] = offsets[ vertex ] + remaining[ vertex ];
+
+	auto cursors = offsets;
+
+	for ( auto index = (uint32_t)0; index < (uint32_t)indexes.size( ); index++ )
+		adjacency[ cursors[ indexes[ index ] ]++ ] = index / 3;
+
+	auto cache_positions = std::vector<int32_t>( vertex_count, -1 );
+	auto vertex_scores   = std::vector<float>( vertex_count );
+	auto triangle_scores = std::vector<float>( triangle_count );
+	auto emitted         = std::vector<bool>( triangle_count, false );
+
+	for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ )
+		vertex_scores[ vertex ] = GetVertexScore( -1, remaining[ vertex ] );
+
+	auto best       = (uint32_t)0;
+	auto best_score = -1.f;
+
+	for ( auto triangle = (uint32_t)0; triangle < triangle_count; triangle++ ) {
+		auto* corners = indexes.data( ) + triangle * 3;
+
+		triangle_scores[ triangle ] = vertex_scores[ corners[ 0 ] ] + vertex_scores[ corners[ 1 ] ] + vertex_scores[ corners[ 2 ] ];
+
+		if ( triangle_scores[ triangle ] > best_score ) {
+			best       = triangle;
+			best_score = triangle_scores[ triangle ];
+		}
+	}
+
+	auto result     = std::vector<uint32_t>( );
+	auto cache      = std::vector<uint32_t>( );
+	auto next_cache = std::vector<uint32_t>( );
+	auto cursor     = (uint32_t)0;
+
+	result.reserve( indexes.size( ) );
+	cache.reserve( ForsythCacheSize + 3 );
+	next_cache.reserve( ForsythCacheSize + 3 );
+
+	while ( result.size( ) < indexes.size( ) ) {
+		if ( best == UINT32_MAX ) {
+			while ( emitted[ cursor ] )
+				cursor += 1;
+
+			best = cursor;
+		}
+
+		auto* corners = indexes.data( ) + best * 3;
+
+		emitted[ best ] = true;
+
+		result.insert( result.end( ), corners, corners + 3 );
+		next_cache.clear( );
+
+		for ( auto corner = 0; corner < 3; corner++ ) {
+			auto vertex = corners[ corner ];
+			auto begin  = adjacency.begin( ) + offsets[ vertex ];
+			auto end    = begin + remaining[ vertex ];
+
+			*std::find( begin, end, best ) = *( end - 1 );
+			remaining[ vertex ] -= 1;
+
+			if ( std::find( next_cache.begin( ), next_cache.end( ), vertex ) == next_cache.end( ) )
+				next_cache.emplace_back( vertex );
+		}
+
+		for ( auto vertex : cache ) {
+			if ( vertex != corners[ 0 ] && vertex != corners[ 1 ] && vertex != corners[ 2 ] )
+				next_cache.emplace_back( vertex );
+		}
+
+		for ( auto position = (uint32_t)0; position < (uint32_t)next_cache.size( ); position++ ) {
+			auto vertex = next_cache[ position ];
+
+			cache_positions[ vertex ] = position < ForsythCacheSize ? (int32_t)position : -1;
+			vertex_scores[ vertex ]   = GetVertexScore( cache_positions[ vertex ], remaining[ vertex ] );
+		}
+
+		best       = UINT32_MAX;
+		best_score = -1.f;
+
+		for ( auto vertex : next_cache ) {
+			auto begin = adjacency.begin( ) + offsets[ vertex ];
+			auto end   = begin + remaining[ vertex ];
+
+			for ( auto triangle = begin; triangle < end; triangle++ ) {
+				auto* others = indexes.data( ) + *triangle * 3;
+				auto score   = vertex_scores[ others[ 0 ] ] + vertex_scores[ others[ 1 ] ] + vertex_scores[ others[ 2 ] ];
+
+				triangle_scores[ *triangle ] = score;
+
+				if ( score > best_score ) {
+					best       = *triangle;
+					best_score = score;
+				}
+			}
+		}
+
+		if ( next_cache.size( ) > ForsythCacheSize )
+			next_cache.resize( ForsythCacheSize );
+
+		std::swap( cache, next_cache );
+	}
+
+	indexes = std::move( result );
+}
+
+void GlwMeshOptimizer::OptimizeOverdraw(
+	const uint32_t vertex_count,
+	const uint32_t stride,
+	const uint32_t position_offset,
+	const void* vertices,
+	const uint32_t cache_size,
+	const float threshold,
+	std::vector<uint32_t>& indexes
+) {
+	if ( vertices == nullptr || cache_size == 0 || !GetIsIndexValid( vertex_count, indexes ) )
+		return;
+
+	auto triangle_count = (uint32_t)( indexes.size( ) / 3 );
+	auto mesh_acmr      = GetVertexCacheStatistics( vertex_count, cache_size, indexes ).ACMR;
+	auto timestamps     = std::vector<uint32_t>( vertex_count, 0 );
+	auto time           = cache_size + 1;
+	auto clusters       = std::vector<uint32_t>{ 0 };
+	auto cluster_misses = (uint32_t)0;
+
+	for ( auto triangle = (uint32_t)0; triangle < triangle_count; triangle++ ) {
+		auto misses = (uint32_t)0;
+
+		for ( auto corner = 0; corner < 3; corner++ ) {
+			auto vertex = indexes[ triangle * 3 + corner ];
+
+			if ( time - timestamps[ vertex ] > cache_size ) {
+				timestamps[ vertex ] = time++;
+				misses += 1;
+			}
+		}
+
+		if ( misses == 3 && triangle > clusters.back( ) ) {
+			clusters.emplace_back( triangle );
+			cluster_misses = 0;
+		}
+
+		cluster_misses += misses;
+
+		auto cluster_triangles = triangle + 1 - clusters.back( );
+
+		if ( triangle + 1 < triangle_count && (float)cluster_misses / (float)cluster_triangles <= mesh_acmr * threshold ) {
+			clusters.emplace_back( triangle + 1 );
+			cluster_misses = 0;
+		}
+	}
+
+	auto mesh_centroid = glm::vec3{ 0.f };
+
+	for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ )
+		mesh_centroid += GetPosition( stride, position_offset, vertices, vertex );
+
+	mesh_centroid /= (float)vertex_count;
+
+	auto cluster_count = (uint32_t)clusters.size( );
+	auto sort_keys     = std::vector<float>( cluster_count );
+	auto order         = std::vector<uint32_t>( cluster_count );
+
+	clusters.emplace_back( triangle_count );
+
+	for ( auto cluster = (uint32_t)0; cluster < cluster_count; cluster++ ) {
+		auto centroid = glm::vec3{ 0.f };
+		auto normal   = glm::vec3{ 0.f };
+		auto area     = 0.f;
+
+		for ( auto triangle = clusters[ cluster ]; triangle < clusters[ cluster + 1 ]; triangle++ ) {
+			auto a = GetPosition( stride, position_offset, vertices, indexes[ triangle * 3 + 0 ] );
+			auto b = GetPosition( stride, position_offset, vertices, indexes[ triangle * 3 + 1 ] );
+			auto c = GetPosition( stride, position_offset, vertices, indexes[ triangle * 3 + 2 ] );
+			auto n = glm::cross( b - a, c - a );
+			auto s = glm::length( n );
+
+			centroid += ( a + b + c ) * ( s / 3.f );
+			normal   += n;
+			area     += s;
+		}
+
+		auto normal_length = glm::length( normal );
+
+		if ( area > 0.f && normal_length > 0.f )
+			sort_keys[ cluster ] = glm::dot( centroid / area - mesh_centroid, normal / normal_length );
+		else
+			sort_keys[ cluster ] = 0.f;
+
+		order[ cluster ] = cluster;
+	}
+
+	std::stable_sort( 
+		order.begin( ), order.end( ), 
+		[ &sort_keys ]( const uint32_t left, const uint32_t right ) { return sort_keys[ left ] > sort_keys[ right ]; }
+	);
+
+	auto result = std::vector<uint32_t>( );
+
+	result.reserve( indexes.size( ) );
+
+	for ( auto cluster : order ) {
+		auto begin = indexes.begin( ) + clusters[ cluster ] * 3;
+		auto end   = indexes.begin( ) + clusters[ cluster + 1 ] * 3;
+
+		result.insert( result.end( ), begin, end );
+	}
+
+	indexes = std::move( result );
+}
+
+uint32_t GlwMeshOptimizer::OptimizeVertexFetch(
+	const uint32_t vertex_count,
+	const uint32_t stride,
+	void* vertices,
+	std::vector<uint32_t>& indexes
+) {
+	if ( vertices == nullptr || stride == 0 || !GetIsIndexValid( vertex_count, indexes ) )
+		return vertex_count;
+
+	auto remap  = std::vector<uint32_t>( vertex_count, UINT32_MAX );
+	auto result = (uint32_t)0;
+
+	for ( auto& index : indexes ) {
+		if ( remap[ index ] == UINT32_MAX )
+			remap[ index ] = result++;
+
+		index = remap[ index ];
+	}
+
+	auto* source = (uint8_t*)vertices;
+	auto copy    = std::vector<uint8_t>( source, source + vertex_count * stride );
+
+	for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ ) {
+		if ( remap[ vertex ] != UINT32_MAX )
+			std::memcpy( source + remap[ vertex ] * stride, copy.data( ) + vertex * stride, stride );
+	}
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+float GlwMeshOptimizer::GetVertexScore( const int32_t cache_position, const uint32_t remaining ) {
+	if ( remaining == 0 )
+		return -1.f;
+
+	auto result = 0.f;
+
+	if ( cache_position >= 3 ) {
+		auto scaler = 1.f - (float)( cache_position - 3 ) / (float)( ForsythCacheSize - 3 );
+
+		result = std::pow( scaler, 1.5f );
+	} else if ( cache_position >= 0 )
+		result = 0.75f;
+
+	return result + 2.f / std::sqrt( (float)remaining );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwMeshOptimizer::GetIsIndexValid( const uint32_t vertex_count, const std::vector<uint32_t>& indexes ) {
+	auto result = vertex_count > 0 && indexes.size( ) >= 3 && indexes.size( ) % 3 == 0;
+
+	if ( result )
+		result = *std::max_element( indexes.begin( ), indexes.end( ) ) < vertex_count;
+
+	return result;
+}
+
+GlwVertexCacheStatistics GlwMeshOptimizer::GetVertexCacheStatistics(
+	const uint32_t vertex_count,
+	const uint32_t cache_size,
+	const std::vector<uint32_t>& indexes
+) {
+	if ( cache_size == 0 || !GetIsIndexValid( vertex_count, indexes ) )
+		return { };
+
+	auto timestamps = std::vector<uint32_t>( vertex_count, 0 );
+	auto used       = std::vector<bool>( vertex_count, false );
+	auto time       = cache_size + 1;
+	auto misses     = (uint32_t)0;
+	auto unique     = (uint32_t)0;
+
+	for ( auto index : indexes ) {
+		if ( time - timestamps[ index ] > cache_size ) {
+			timestamps[ index ] = time++;
+			misses += 1;
+		}
+
+		if ( !used[ index ] ) {
+			used[ index ] = true;
+			unique += 1;
+		}
+	}
+
+	auto acmr = (float)misses / (float)( indexes.size( ) / 3 );
+	auto atvr = (float)misses / (float)unique;
+
+	return { misses, acmr, atvr };
+}
+
+glm::vec3 GlwMeshOptimizer::GetPosition(
+	const uint32_t stride,
+	const uint32_t position_offset,
+	const void* vertices,
+	const uint32_t vertex
+) {
+	auto result = glm::vec3{ };
+
+	std::memcpy( &result, (const uint8_t*)vertices + vertex * stride + position_offset, sizeof( glm::vec3 ) );
+
+	return result;
+}
+
+bool GlwMeshOptimizer::GetPositionOffset(
+	const std::vector<GlwVertexAttribute>& attributes,
+	const uint32_t location,
+	uint32_t& offset
+) {
+	auto result = false;
+
+	for ( auto& attribute : attributes ) {
+		if ( attribute.Location != location || attribute.Type != GL_FLOAT || attribute.Size < 3 || attribute.GetIsInstanced( ) )
+			continue;
+
+		offset = attribute.Offset;
+		result = true;
+
+		break;
+	}
+
+	return result;
+}
@@ -0,0 +1,214 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwVertexFormatRegistry.h"
+
+/**
+ * GlwMeshOptimizer final class
+ * @note : Reorder mesh data for the GPU, indexes for the post-transform vertex
+ *		   cache using Tom Forsyth linear speed algorithm, triangle clusters
+ *		   front to back to reduce overdraw and vertices by first use to 
+ *		   improve vertex fetch locality.
+ **/
+class GlwMeshOptimizer final {
+
+private:
+	static const uint32_t ForsythCacheSize = 32;
+
+public:
+	/**
+	 * Optimize static function
+	 * @note : Run requested optimizations in order vertex cache, overdraw and
+	 *		   vertex fetch. Vertex count can shrink as unused vertices are 
+	 *		   dropped by vertex fetch optimization.
+	 * @param specification : Query optimizer specification.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param position_offset : Query offset of 3 float position in vertex.
+	 * @param vertex_count : Query vertex count.
+	 * @param vertices : Query vertices to reorder.
+	 * @param indexes : Query indexes to reorder.
+	 * @param statistics : Store vertex cache statistics before and after.
+	 * @return : Return vertex count after optimization.
+	 **/
+	static uint32_t Optimize(
+		const GlwMeshOptimizerSpecification& specification,
+		const uint32_t stride,
+		const uint32_t position_offset,
+		const uint32_t vertex_count,
+		void* vertices,
+		std::vector<uint32_t>& indexes,
+		GlwMeshOptimizerStatistics& statistics
+	);
+
+	/**
+	 * OptimizeVertexCache static method
+	 * @note : Reorder triangles to maximize post-transform vertex cache hits.
+	 * @param vertex_count : Query vertex count.
+	 * @param indexes : Query triangle list indexes.
+	 **/
+	static void OptimizeVertexCache( const uint32_t vertex_count, std::vector<uint32_t>& indexes );
+
+	/**
+	 * OptimizeOverdraw static method
+	 * @note : Split cache optimized indexes in clusters and sort them so 
+	 *		   outward facing clusters are drawn first, clusters are split 
+	 *		   where the cache restarts or where their ACMR fall below 
+	 *		   threshold times the mesh ACMR.
+	 * @param vertex_count : Query vertex count.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param position_offset : Query offset of 3 float position in vertex.
+	 * @param vertices : Query vertices.
+	 * @param cache_size : Query simulated cache size.
+	 * @param threshold : Query allowed ACMR ratio.
+	 * @param indexes : Query triangle list indexes.
+	 **/
+	static void OptimizeOverdraw(
+		const uint32_t vertex_count,
+		const uint32_t stride,
+		const uint32_t position_offset,
+		const void* vertices,
+		const uint32_t cache_size,
+		const float threshold,
+		std::vector<uint32_t>& indexes
+	);
+
+	/**
+	 * OptimizeVertexFetch static function
+	 * @note : Reorder vertices by first use in indexes and remap indexes, 
+	 *		   vertices never referenced are dropped.
+	 * @param vertex_count : Query vertex count.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param vertices : Query vertices to reorder.
+	 * @param indexes : Query indexes to remap.
+	 * @return : Return referenced vertex count.
+	 **/
+	static uint32_t OptimizeVertexFetch(
+		const uint32_t vertex_count,
+		const uint32_t stride,
+		void* vertices,
+		std::vector<uint32_t>& indexes
+	);
+
+private:
+	/**
+	 * GetVertexScore static function
+	 * @note : Get Forsyth score of a vertex.
+	 * @param cache_position : Query position in simulated LRU cache, -1 when outside.
+	 * @param remaining : Query count of triangles left to emit using the vertex.
+	 * @return : Return vertex score, -1 when vertex is no longer used.
+	 **/
+	static float GetVertexScore( const int32_t cache_position, const uint32_t remaining );
+
+public:
+	/**
+	 * GetIsIndexValid static function
+	 * @note : Get if indexes form triangles of existing vertices.
+	 * @param vertex_count : Query vertex count.
+	 * @param indexes : Query indexes.
+	 * @return : Return true when indexes can be optimized.
+	 **/
+	static bool GetIsIndexValid( const uint32_t vertex_count, const std::vector<uint32_t>& indexes );
+
+	/**
+	 * GetVertexCacheStatistics static function
+	 * @note : Simulate a FIFO post-transform cache of query size.
+	 * @param vertex_count : Query vertex count.
+	 * @param cache_size : Query simulated cache size.
+	 * @param indexes : Query triangle list indexes.
+	 * @return : Return ACMR and ATVR of indexes.
+	 **/
+	static GlwVertexCacheStatistics GetVertexCacheStatistics(
+		const uint32_t vertex_count,
+		const uint32_t cache_size,
+		const std::vector<uint32_t>& indexes
+	);
+
+	/**
+	 * GetPosition static function
+	 * @note : Read vertex position.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param position_offset : Query offset of 3 float position in vertex.
+	 * @param vertices : Query vertices.
+	 * @param vertex : Query vertex index.
+	 * @return : Return vertex position.
+	 **/
+	static glm::vec3 GetPosition(
+		const uint32_t stride,
+		const uint32_t position_offset,
+		const void* vertices,
+		const uint32_t vertex
+	);
+
+	/**
+	 * GetPositionOffset static function
+	 * @note : Find 3 or 4 components GL_FLOAT attribute at query location.
+	 * @param attributes : Query attribute list.
+	 * @param location : Query position location.
+	 * @param offset : Store position offset in vertex.
+	 * @return : Return true when position attribute exist.
+	 **/
+	static bool GetPositionOffset(
+		const std::vector<GlwVertexAttribute>& attributes,
+		const uint32_t location,
+		uint32_t& offset
+	);
+
+	/**
+	 * GetPositionOffset template function
+	 * @note : Find 3 or 4 components GL_FLOAT element at query location of a
+	 *		   declared GlwVertexLayout.
+	 * @template VertexType : Type of data used for vertex representation.
+	 * @param location : Query position location.
+	 * @param offset : Store position offset in vertex.
+	 * @return : Return true when position element exist.
+	 **/
+	template<typename VertexType>
+		requires GlwVertexLayoutDeclared<VertexType>
+	static bool GetPositionOffset( const uint32_t location, uint32_t& offset ) {
+		auto result = false;
+
+		for ( auto& element : GlwVertexLayout<VertexType>::Elements ) {
+			if ( element.Location != location || element.Type != GL_FLOAT || element.Size < 3 )
+				continue;
+
+			offset = element.Offset;
+			result = true;
+
+			break;
+		}
+
+		return result;
+	};
+
+};
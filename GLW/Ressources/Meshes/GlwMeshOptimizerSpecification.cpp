@@ -0,0 +1,69 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwMeshOptimizerSpecification::GlwMeshOptimizerSpecification( )
+	: GlwMeshOptimizerSpecification{ false, false, false }
+{ }
+
+GlwMeshOptimizerSpecification::GlwMeshOptimizerSpecification(
+	const bool vertex_cache,
+	const bool vertex_fetch,
+	const bool overdraw
+)
+	: GlwMeshOptimizerSpecification{ vertex_cache, vertex_fetch, overdraw, 1.05f, 16 }
+{ }
+
+GlwMeshOptimizerSpecification::GlwMeshOptimizerSpecification(
+	const bool vertex_cache,
+	const bool vertex_fetch,
+	const bool overdraw,
+	const float overdraw_threshold,
+	const uint32_t cache_size
+)
+	: VertexCache{ vertex_cache },
+	VertexFetch{ vertex_fetch },
+	Overdraw{ overdraw },
+	OverdrawThreshold{ overdraw_threshold },
+	CacheSize{ cache_size }
+{ }
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwMeshOptimizerSpecification::GetIsEnabled( ) const {
+	return VertexCache || VertexFetch || Overdraw;
+}
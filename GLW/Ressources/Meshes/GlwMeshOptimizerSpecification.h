@@ -0,0 +1,85 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwMeshOptimizerStatistics.h"
+
+struct GlwMeshOptimizerSpecification {
+
+	bool VertexCache;
+	bool VertexFetch;
+	bool Overdraw;
+	float OverdrawThreshold;
+	uint32_t CacheSize;
+
+	/**
+	 * Constructor
+	 **/
+	GlwMeshOptimizerSpecification( );
+
+	/**
+	 * Constructor
+	 * @param vertex_cache : Query post-transform vertex cache ordering of indexes.
+	 * @param vertex_fetch : Query vertex reordering by first use.
+	 * @param overdraw : Query front to back ordering of triangle clusters.
+	 **/
+	GlwMeshOptimizerSpecification(
+		const bool vertex_cache,
+		const bool vertex_fetch,
+		const bool overdraw
+	);
+
+	/**
+	 * Constructor
+	 * @param vertex_cache : Query post-transform vertex cache ordering of indexes.
+	 * @param vertex_fetch : Query vertex reordering by first use.
+	 * @param overdraw : Query front to back ordering of triangle clusters.
+	 * @param overdraw_threshold : Query allowed ACMR increase for cluster split, 1.05 allow 5%.
+	 * @param cache_size : Query simulated FIFO cache size used for statistics and clusters.
+	 **/
+	GlwMeshOptimizerSpecification(
+		const bool vertex_cache,
+		const bool vertex_fetch,
+		const bool overdraw,
+		const float overdraw_threshold,
+		const uint32_t cache_size
+	);
+
+	/**
+	 * GetIsEnabled const function
+	 * @note : Get if any optimization is requested.
+	 * @return : Return true when mesh must be processed.
+	 **/
+	bool GetIsEnabled( ) const;
+
+};
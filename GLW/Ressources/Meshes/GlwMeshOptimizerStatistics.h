@@ -0,0 +1,68 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwMeshSpecification.h"
+
+struct GlwVertexCacheStatistics {
+
+	uint32_t Misses;
+	float ACMR;
+	float ATVR;
+
+	/**
+	 * Constructor
+	 **/
+	GlwVertexCacheStatistics( );
+
+	/**
+	 * Constructor
+	 * @param misses : Query post-transform cache miss count.
+	 * @param acmr : Query average cache miss ratio, misses per triangle.
+	 * @param atvr : Query average transformed vertex ratio, misses per vertex.
+	 **/
+	GlwVertexCacheStatistics( const uint32_t misses, const float acmr, const float atvr );
+
+};
+
+struct GlwMeshOptimizerStatistics {
+
+	GlwVertexCacheStatistics Before;
+	GlwVertexCacheStatistics After;
+
+	/**
+	 * Constructor
+	 **/
+	GlwMeshOptimizerStatistics( );
+
+};
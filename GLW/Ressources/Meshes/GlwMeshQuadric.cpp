@@ -0,0 +1,115 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwMeshQuadric::GlwMeshQuadric( )
+	: A00{ 0.f },
+	A11{ 0.f },
+	A22{ 0.f },
+	A01{ 0.f },
+	A02{ 0.f },
+	A12{ 0.f },
+	B0{ 0.f },
+	B1{ 0.f },
+	B2{ 0.f },
+	C{ 0.f },
+	Weight{ 0.f }
+{ }
+
+GlwMeshQuadric::GlwMeshQuadric( 
+	const glm::vec3& normal, 
+	const float distance, 
+	const float weight 
+)
+	: A00{ normal.x * normal.x * weight },
+	A11{ normal.y * normal.y * weight },
+	A22{ normal.z * normal.z * weight },
+	A01{ normal.x * normal.y * weight },
+	A02{ normal.x * normal.z * weight },
+	A12{ normal.y * normal.z * weight },
+	B0{ normal.x * distance * weight },
+	B1{ normal.y * distance * weight },
+	B2{ normal.z * distance * weight },
+	C{ distance * distance * weight },
+	Weight{ weight }
+{ }
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+float GlwMeshQuadric::GetError( const glm::vec3& point ) const {
+	if ( Weight <= 0.f )
+		return 0.f;
+
+	auto x = point.x;
+	auto y = point.y;
+	auto z = point.z;
+
+	auto result = A00 * x * x + A11 * y * y + A22 * z * z;
+
+	result += 2.f * ( A01 * x * y + A02 * x * z + A12 * y * z );
+	result += 2.f * ( B0 * x + B1 * y + B2 * z ) + C;
+
+	return std::max( result, 0.f ) / Weight;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	OPERATOR ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwMeshQuadric& GlwMeshQuadric::operator+=( const GlwMeshQuadric& other ) {
+	A00 += other.A00;
+	A11 += other.A11;
+	A22 += other.A22;
+	A01 += other.A01;
+	A02 += other.A02;
+	A12 += other.A12;
+	B0  += other.B0;
+	B1  += other.B1;
+	B2  += other.B2;
+	C   += other.C;
+
+	Weight += other.Weight;
+
+	return *this;
+}
+
+GlwMeshQuadric GlwMeshQuadric::operator+( const GlwMeshQuadric& other ) const {
+	auto result = *this;
+
+	result += other;
+
+	return result;
+}
@@ -0,0 +1,87 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwMeshOptimizer.h"
+
+struct GlwMeshQuadric {
+
+	float A00;
+	float A11;
+	float A22;
+	float A01;
+	float A02;
+	float A12;
+	float B0;
+	float B1;
+	float B2;
+	float C;
+	float Weight;
+
+	/**
+	 * Constructor
+	 **/
+	GlwMeshQuadric( );
+
+	/**
+	 * Constructor
+	 * @note : Quadric of squared distance to a plane.
+	 * @param normal : Query unit plane normal.
+	 * @param distance : Query plane distance, dot( normal, point ) + distance = 0.
+	 * @param weight : Query quadric weight, usually triangle area.
+	 **/
+	GlwMeshQuadric( const glm::vec3& normal, const float distance, const float weight );
+
+	/**
+	 * GetError const function
+	 * @note : Get weighted average of squared distances to accumulated planes.
+	 * @param point : Query point.
+	 * @return : Return squared distance.
+	 **/
+	float GetError( const glm::vec3& point ) const;
+
+	/**
+	 * Accumulate operator
+	 * @param other : Query other quadric.
+	 * @return : Return reference to current quadric.
+	 **/
+	GlwMeshQuadric& operator+=( const GlwMeshQuadric& other );
+
+	/**
+	 * Add operator
+	 * @param other : Query other quadric.
+	 * @return : Return sum of current and other quadric.
+	 **/
+	GlwMeshQuadric operator+( const GlwMeshQuadric& other ) const;
+
+};
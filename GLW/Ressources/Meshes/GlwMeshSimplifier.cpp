@@ -0,0 +1,361 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwMeshSimplifier::Build(
+	const GlwMeshLodSpecification& specification,
+	const uint32_t stride,
+	const uint32_t position_offset,
+	const uint32_t vertex_count,
+	const void* vertices,
+	std::vector<uint32_t>& indexes,
+	std::vector<GlwMeshLod>& lods
+) {
+	lods.clear( );
+	lods.emplace_back( 0, (uint32_t)indexes.size( ), 0.f );
+
+	if ( !specification.GetIsEnabled( ) || vertices == nullptr || !GlwMeshOptimizer::GetIsIndexValid( vertex_count, indexes ) )
+		return false;
+
+	auto source   = indexes;
+	auto previous = (uint32_t)source.size( );
+	auto lod      = std::vector<uint32_t>( );
+	auto error    = 0.f;
+
+	for ( auto level = (uint32_t)0; level < specification.Levels; level++ ) {
+		auto target = (uint32_t)( (float)previous * specification.Ratio ) / 3 * 3;
+
+		if ( target < 3 || !Simplify( stride, position_offset, vertex_count, vertices, source, target, specification.MaxError, lod, error ) )
+			break;
+
+		if ( lod.empty( ) || (float)lod.size( ) > (float)previous * .95f )
+			break;
+
+		lods.emplace_back( (uint32_t)indexes.size( ), (uint32_t)lod.size( ), error );
+		indexes.insert( indexes.end( ), lod.begin( ), lod.end( ) );
+
+		previous = (uint32_t)lod.size( );
+	}
+
+	return lods.size( ) > 1;
+}
+
+bool GlwMeshSimplifier::Simplify(
+	const uint32_t stride,
+	const uint32_t position_offset,
+	const uint32_t vertex_count,
+	const void* vertices,
+	const std::vector<uint32_t>& indexes,
+	const uint32_t target_index_count,
+	const float target_error,
+	std::vector<uint32_t>& destination,
+	float& error
+) {
+	destination = indexes;
+	error       = 0.f;
+
+	if ( vertices == nullptr || !GlwMeshOptimizer::GetIsIndexValid( vertex_count, indexes ) )
+		return false;
+
+	auto bounds    = GlwMeshBounds::Compute( stride, position_offset, vertex_count, vertices );
+	auto scale     = bounds.Radius > 0.f ? .5f / bounds.Radius : 1.f;
+	auto positions = std::vector<glm::vec3>( vertex_count );
+
+	for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ )
+		positions[ vertex ] = ( GlwMeshOptimizer::GetPosition( stride, position_offset, vertices, vertex ) - bounds.Center ) * scale;
+
+	auto seams    = std::vector<bool>( );
+	auto locked   = GetLockedVertices( positions, indexes, seams );
+	auto quadrics = std::vector<GlwMeshQuadric>( vertex_count );
+
+	for ( auto corner = (size_t)0; corner < indexes.size( ); corner += 3 ) {
+		auto& a     = positions[ indexes[ corner + 0 ] ];
+		auto normal = glm::cross( positions[ indexes[ corner + 1 ] ] - a, positions[ indexes[ corner + 2 ] ] - a );
+		auto length = glm::length( normal );
+
+		if ( length <= 0.f )
+			continue;
+
+		normal /= length;
+
+		auto quadric = GlwMeshQuadric{ normal, -glm::dot( normal, a ), length * .5f };
+
+		quadrics[ indexes[ corner + 0 ] ] += quadric;
+		quadrics[ indexes[ corner + 1 ] ] += quadric;
+		quadrics[ indexes[ corner + 2 ] ] += quadric;
+	}
+
+	auto error_limit = target_error * target_error;
+	auto max_error   = 0.f;
+	auto remap       = std::vector<uint32_t>( vertex_count );
+	auto offsets     = std::vector<uint32_t>( vertex_count + 1 );
+	auto adjacency   = std::vector<uint32_t>( );
+	auto candidates  = std::vector<uint64_t>( );
+	auto costs       = std::vector<float>( );
+	auto order       = std::vector<uint32_t>( );
+	auto pass_locked = std::vector<bool>( );
+
+	for ( auto pass = (uint32_t)0; pass < MaxPasses && destination.size( ) > target_index_count; pass++ ) {
+		auto triangle_count = (uint32_t)( destination.size( ) / 3 );
+
+		std::fill( offsets.begin( ), offsets.end( ), 0 );
+
+		for ( auto index : destination )
+			offsets[ index + 1 ] += 1;
+
+		for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ )
+			offsets[ vertex + 1 ] += offsets[ vertex ];
+
+		auto cursors = offsets;
+
+		adjacency.resize( destination.size( ) );
+
+		for ( auto corner = (uint32_t)0; corner < (uint32_t)destination.size( ); corner++ )
+			adjacency[ cursors[ destination[ corner ] ]++ ] = corner / 3;
+
+		candidates.clear( );
+
+		for ( auto corner = (uint32_t)0; corner < (uint32_t)destination.size( ); corner++ ) {
+			auto a = destination[ corner ];
+			auto b = destination[ corner - corner % 3 + ( corner + 1 ) % 3 ];
+
+			if ( !locked[ a ] && !seams[ b ] )
+				candidates.emplace_back( ( (uint64_t)a << 32 ) | b );
+
+			if ( !locked[ b ] && !seams[ a ] )
+				candidates.emplace_back( ( (uint64_t)b << 32 ) | a );
+		}
+
+		std::sort( candidates.begin( ), candidates.end( ) );
+		candidates.erase( std::unique( candidates.begin( ), candidates.end( ) ), candidates.end( ) );
+
+		costs.resize( candidates.size( ) );
+		order.resize( candidates.size( ) );
+
+		for ( auto candidate = (uint32_t)0; candidate < (uint32_t)candidates.size( ); candidate++ ) {
+			auto source = (uint32_t)( candidates[ candidate ] >> 32 );
+			auto target = (uint32_t)candidates[ candidate ];
+
+			costs[ candidate ] = ( quadrics[ source ] + quadrics[ target ] ).GetError( positions[ target ] );
+			order[ candidate ] = candidate;
+		}
+
+		std::sort( 
+			order.begin( ), order.end( ),
+			[ &costs ]( const uint32_t left, const uint32_t right ) { return costs[ left ] < costs[ right ]; }
+		);
+
+		for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ )
+			remap[ vertex ] = vertex;
+
+		pass_locked.assign( vertex_count, false );
+
+		auto target_triangles = target_index_count / 3;
+		auto collapses        = (uint32_t)0;
+
+		for ( auto candidate : order ) {
+			if ( costs[ candidate ] > error_limit || triangle_count <= target_triangles )
+				break;
+
+			auto source = (uint32_t)( candidates[ candidate ] >> 32 );
+			auto target = (uint32_t)candidates[ candidate ];
+
+			if ( pass_locked[ source ] || pass_locked[ target ] )
+				continue;
+
+			auto removed    = (uint32_t)0;
+			auto is_flipped = false;
+
+			for ( auto adjacent = offsets[ source ]; adjacent < offsets[ source + 1 ] && !is_flipped; adjacent++ ) {
+				auto* corners = destination.data( ) + adjacency[ adjacent ] * 3;
+
+				if ( corners[ 0 ] == target || corners[ 1 ] == target || corners[ 2 ] == target ) {
+					removed += 1;
+
+					continue;
+				}
+
+				auto moved = corners[ 0 ] == source ? 0 : ( corners[ 1 ] == source ? 1 : 2 );
+
+				is_flipped = GetIsFlipped( 
+					positions[ corners[ 0 ] ], positions[ corners[ 1 ] ], positions[ corners[ 2 ] ], 
+					moved, positions[ target ] 
+				);
+			}
+
+			if ( is_flipped )
+				continue;
+
+			for ( auto adjacent = offsets[ source ]; adjacent < offsets[ source + 1 ]; adjacent++ ) {
+				auto* corners = destination.data( ) + adjacency[ adjacent ] * 3;
+
+				pass_locked[ corners[ 0 ] ] = true;
+				pass_locked[ corners[ 1 ] ] = true;
+				pass_locked[ corners[ 2 ] ] = true;
+			}
+
+			remap[ source ]     = target;
+			quadrics[ target ] += quadrics[ source ];
+			max_error           = std::max( max_error, costs[ candidate ] );
+			triangle_count     -= std::min( removed, triangle_count );
+			collapses          += 1;
+		}
+
+		if ( collapses == 0 )
+			break;
+
+		auto write = (size_t)0;
+
+		for ( auto corner = (size_t)0; corner < destination.size( ); corner += 3 ) {
+			auto a = remap[ destination[ corner + 0 ] ];
+			auto b = remap[ destination[ corner + 1 ] ];
+			auto c = remap[ destination[ corner + 2 ] ];
+
+			if ( a == b || b == c || c == a )
+				continue;
+
+			destination[ write++ ] = a;
+			destination[ write++ ] = b;
+			destination[ write++ ] = c;
+		}
+
+		destination.resize( write );
+	}
+
+	error = std::sqrt( max_error );
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+std::vector<bool> GlwMeshSimplifier::GetLockedVertices(
+	const std::vector<glm::vec3>& positions,
+	const std::vector<uint32_t>& indexes,
+	std::vector<bool>& seams
+) {
+	auto vertex_count = (uint32_t)positions.size( );
+	auto sorted       = std::vector<uint32_t>( vertex_count );
+	auto canonical    = std::vector<uint32_t>( vertex_count );
+
+	for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ )
+		sorted[ vertex ] = vertex;
+
+	std::sort( 
+		sorted.begin( ), sorted.end( ),
+		[ &positions ]( const uint32_t left, const uint32_t right ) {
+			auto& a = positions[ left ];
+			auto& b = positions[ right ];
+
+			if ( a.x != b.x )
+				return a.x < b.x;
+
+			if ( a.y != b.y )
+				return a.y < b.y;
+
+			return a.z < b.z;
+		}
+	);
+
+	seams.assign( vertex_count, false );
+
+	for ( auto index = (uint32_t)0; index < vertex_count; index++ ) {
+		auto vertex = sorted[ index ];
+
+		if ( index > 0 && positions[ vertex ] == positions[ sorted[ index - 1 ] ] ) {
+			canonical[ vertex ] = canonical[ sorted[ index - 1 ] ];
+
+			seams[ vertex ]              = true;
+			seams[ sorted[ index - 1 ] ] = true;
+		} else
+			canonical[ vertex ] = vertex;
+	}
+
+	auto edges = std::vector<uint64_t>( );
+
+	edges.reserve( indexes.size( ) );
+
+	for ( auto corner = (size_t)0; corner < indexes.size( ); corner++ ) {
+		auto a = canonical[ indexes[ corner ] ];
+		auto b = canonical[ indexes[ corner - corner % 3 + ( corner + 1 ) % 3 ] ];
+
+		edges.emplace_back( ( (uint64_t)std::min( a, b ) << 32 ) | std::max( a, b ) );
+	}
+
+	std::sort( edges.begin( ), edges.end( ) );
+
+	auto borders = std::vector<bool>( vertex_count, false );
+
+	for ( auto edge = (size_t)0; edge < edges.size( ); ) {
+		auto next = edge + 1;
+
+		while ( next < edges.size( ) && edges[ next ] == edges[ edge ] )
+			next += 1;
+
+		if ( next - edge == 1 ) {
+			borders[ (uint32_t)( edges[ edge ] >> 32 ) ] = true;
+			borders[ (uint32_t)edges[ edge ] ]           = true;
+		}
+
+		edge = next;
+	}
+
+	auto result = std::vector<bool>( vertex_count );
+
+	for ( auto vertex = (uint32_t)0; vertex < vertex_count; vertex++ )
+		result[ vertex ] = seams[ vertex ] || borders[ canonical[ vertex ] ];
+
+	return result;
+}
+
+bool GlwMeshSimplifier::GetIsFlipped(
+	const glm::vec3& a,
+	const glm::vec3& b,
+	const glm::vec3& c,
+	const uint32_t moved,
+	const glm::vec3& target
+) {
+	glm::vec3 corners[] = { a, b, c };
+
+	auto before = glm::cross( b - a, c - a );
+
+	corners[ moved ] = target;
+
+	auto after = glm::cross( corners[ 1 ] - corners[ 0 ], corners[ 2 ] - corners[ 0 ] );
+
+	return glm::dot( before, after ) <= 0.f;
+}
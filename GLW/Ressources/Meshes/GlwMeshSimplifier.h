@@ -0,0 +1,135 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwMeshQuadric.h"
+
+/**
+ * GlwMeshSimplifier final class
+ * @note : Quadric error metric simplifier, vertices are collapsed onto one 
+ *		   of their neighbours so every level of detail share the vertex 
+ *		   buffer and only differ by their indexes. Vertices on open borders
+ *		   and attribute seams are kept in place.
+ **/
+class GlwMeshSimplifier final {
+
+private:
+	static const uint32_t MaxPasses = 64;
+
+public:
+	/**
+	 * Build static function
+	 * @note : Append simplified levels of detail after full detail indexes, 
+	 *		   each level is simplified from full detail level.
+	 * @param specification : Query level of detail specification.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param position_offset : Query offset of 3 float position in vertex.
+	 * @param vertex_count : Query vertex count.
+	 * @param vertices : Query vertices.
+	 * @param indexes : Query full detail indexes, store all levels indexes.
+	 * @param lods : Store index range of each level, full detail first.
+	 * @return : True when at least one simplified level was generated.
+	 **/
+	static bool Build(
+		const GlwMeshLodSpecification& specification,
+		const uint32_t stride,
+		const uint32_t position_offset,
+		const uint32_t vertex_count,
+		const void* vertices,
+		std::vector<uint32_t>& indexes,
+		std::vector<GlwMeshLod>& lods
+	);
+
+	/**
+	 * Simplify static function
+	 * @note : Collapse edges by increasing error until target index count or
+	 *		   target error is reached.
+	 * @param stride : Query vertex stride in bytes.
+	 * @param position_offset : Query offset of 3 float position in vertex.
+	 * @param vertex_count : Query vertex count.
+	 * @param vertices : Query vertices.
+	 * @param indexes : Query triangle list indexes.
+	 * @param target_index_count : Query index count to reach.
+	 * @param target_error : Query maximum error relative to mesh diameter.
+	 * @param destination : Store simplified indexes.
+	 * @param error : Store reached error relative to mesh diameter.
+	 * @return : True when indexes are valid.
+	 **/
+	static bool Simplify(
+		const uint32_t stride,
+		const uint32_t position_offset,
+		const uint32_t vertex_count,
+		const void* vertices,
+		const std::vector<uint32_t>& indexes,
+		const uint32_t target_index_count,
+		const float target_error,
+		std::vector<uint32_t>& destination,
+		float& error
+	);
+
+private:
+	/**
+	 * GetLockedVertices static function
+	 * @note : Get vertices that can't be collapsed, vertices sharing their 
+	 *		   position with another vertex are attribute seams and vertices 
+	 *		   of edges used by a single triangle are open borders.
+	 * @param positions : Query vertex positions.
+	 * @param indexes : Query triangle list indexes.
+	 * @param seams : Store seam flag of each vertex.
+	 * @return : Return locked flag of each vertex.
+	 **/
+	static std::vector<bool> GetLockedVertices(
+		const std::vector<glm::vec3>& positions,
+		const std::vector<uint32_t>& indexes,
+		std::vector<bool>& seams
+	);
+
+	/**
+	 * GetIsFlipped static function
+	 * @note : Get if moving a triangle corner flip or collapse the triangle.
+	 * @param a : Query first corner.
+	 * @param b : Query second corner.
+	 * @param c : Query third corner.
+	 * @param moved : Query corner index that moves.
+	 * @param target : Query new position of moved corner.
+	 * @return : Return true when collapse must be rejected.
+	 **/
+	static bool GetIsFlipped(
+		const glm::vec3& a,
+		const glm::vec3& b,
+		const glm::vec3& c,
+		const uint32_t moved,
+		const glm::vec3& target
+	);
+
+};
@@ -36,8 +36,11 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 GlwMeshSpecification::GlwMeshSpecification( )
 	: UseIndex{ true },
+	UseInstance{ false },
+	IndexType{ GlwIndexTypes::Automatic },
 	Vertex{ },
 	Index{ },
+	Instance{ },
 	Attributes{ }
 { }
 
@@ -52,8 +55,11 @@ GlwMeshSpecification::GlwMeshSpecification(
 	const std::vector<GlwVertexAttribute>& attributes
 )
 	: UseIndex{ false },
+	UseInstance{ false },
+	IndexType{ GlwIndexTypes::Automatic },
 	Vertex{ vertex },
 	Index{ },
+	Instance{ },
 	Attributes{ attributes }
 { }
 
@@ -63,7 +69,40 @@ GlwMeshSpecification::GlwMeshSpecification(
 	const std::vector<GlwVertexAttribute>& attributes
 )
 	: UseIndex{ true },
+	UseInstance{ false },
+	IndexType{ GlwIndexTypes::Automatic },
 	Vertex{ vertex },
 	Index{ index },
+	Instance{ },
+	Attributes{ attributes }
+{ }
+
+GlwMeshSpecification::GlwMeshSpecification(
+	const GlwBufferSpecification& vertex,
+	const GlwBufferSpecification& index,
+	const GlwIndexTypes index_type,
+	const std::vector<GlwVertexAttribute>& attributes
+)
+	: UseIndex{ true },
+	UseInstance{ false },
+	IndexType{ index_type },
+	Vertex{ vertex },
+	Index{ index },
+	Instance{ },
+	Attributes{ attributes }
+{ }
+
+GlwMeshSpecification::GlwMeshSpecification(
+	const GlwBufferSpecification& vertex,
+	const GlwBufferSpecification& index,
+	const GlwBufferSpecification& instance,
+	const std::vector<GlwVertexAttribute>& attributes
+)
+	: UseIndex{ true },
+	UseInstance{ true },
+	IndexType{ GlwIndexTypes::Automatic },
+	Vertex{ vertex },
+	Index{ index },
+	Instance{ instance },
 	Attributes{ attributes }
 { }
@@ -31,13 +31,16 @@
 
 #pragma once
 
-#include "GlwVertexArray.h"
+#include "GlwIndexTypes.h"
 
 struct GlwMeshSpecification {
 
 	bool UseIndex;
+	bool UseInstance;
+	GlwIndexTypes IndexType;
 	GlwBufferSpecification Vertex;
 	GlwBufferSpecification Index;
+	GlwBufferSpecification Instance;
 	std::vector<GlwVertexAttribute> Attributes;
 
 	/**
@@ -75,4 +78,32 @@ struct GlwMeshSpecification {
 		const std::vector<GlwVertexAttribute>& attributes
 	);
 
+	/**
+	 * Constructor
+	 * @param vertex : Query vertex buffer specification.
+	 * @param index : Query index buffer specification.
+	 * @param index_type : Query preferred index type, widened when indexes do not fit.
+	 * @param attributes : Query mesh attributes specification.
+	 **/
+	GlwMeshSpecification(
+		const GlwBufferSpecification& vertex,
+		const GlwBufferSpecification& index,
+		const GlwIndexTypes index_type,
+		const std::vector<GlwVertexAttribute>& attributes
+	);
+
+	/**
+	 * Constructor
+	 * @param vertex : Query vertex buffer specification.
+	 * @param index : Query index buffer specification.
+	 * @param instance : Query instance buffer specification.
+	 * @param attributes : Query mesh attributes specification.
+	 **/
+	GlwMeshSpecification(
+		const GlwBufferSpecification& vertex,
+		const GlwBufferSpecification& index,
+		const GlwBufferSpecification& instance,
+		const std::vector<GlwVertexAttribute>& attributes
+	);
+
 };
@@ -31,14 +31,18 @@
 
 #pragma once
 
-#include "GlwMeshSpecification.h"
+#include "GlwMeshLodSpecification.h"
 
 template<typename VertexType>
 struct GlwMeshStaticSpecification {
 
 	std::vector<VertexType> Vertices;
 	std::vector<uint32_t> Indexes;
+	GlwIndexTypes IndexType;
 	std::vector<GlwVertexAttribute> Attributes;
+	GlwMeshOptimizerSpecification Optimizer;
+	GlwMeshLodSpecification Lod;
+	uint32_t PositionLocation;
 
 	/**
 	 * Constructor
@@ -71,18 +75,51 @@ struct GlwMeshStaticSpecification {
 
 	/**
 	 * Constructor
+	 * @note : For vertex types with a declared GlwVertexLayout.
 	 * @param vertices : Vertex list.
 	 * @param indexes : Index list.
+	 **/
+	GlwMeshStaticSpecification(
+		const std::vector<VertexType>& vertices,
+		const std::vector<uint32_t>& indexes
+	)
+		: GlwMeshStaticSpecification{ vertices, indexes, GlwIndexTypes::Automatic, { } }
+	{ };
+
+	/**
+	 * Constructor
+	 * @param vertices : Vertex list.
+	 * @param indexes : Index list.
+	 * @param attributes : Vertex attribute list.
+	 **/
+	GlwMeshStaticSpecification(
+		const std::vector<VertexType>& vertices,
+		const std::vector<uint32_t>& indexes,
+		const std::vector<GlwVertexAttribute>& attributes
+	)
+		: GlwMeshStaticSpecification{ vertices, indexes, GlwIndexTypes::Automatic, attributes }
+	{ };
+
+	/**
+	 * Constructor
+	 * @param vertices : Vertex list.
+	 * @param indexes : Index list.
+	 * @param index_type : Preferred index type, widened when indexes do not fit.
 	 * @param attributes : Vertex attribute list.
 	 **/
 	GlwMeshStaticSpecification(
 		const std::vector<VertexType>& vertices,
 		const std::vector<uint32_t>& indexes,
+		const GlwIndexTypes index_type,
 		const std::vector<GlwVertexAttribute>& attributes
 	)
 		: Vertices{ vertices },
 		Indexes{ indexes },
-		Attributes{ attributes } 
+		IndexType{ index_type },
+		Attributes{ attributes },
+		Optimizer{ },
+		Lod{ },
+		PositionLocation{ 0 }
 	{ };
 
 	/**
@@ -94,6 +131,7 @@ struct GlwMeshStaticSpecification {
 		auto specification = GlwMeshSpecification{ };
 
 		specification.UseIndex   = Indexes.size( ) > 0;
+		specification.IndexType  = IndexType;
 		specification.Vertex	 = { GlwBufferTypes::Vertex, GlwBufferModes::Static_Draw };
 		specification.Index		 = { GlwBufferTypes::Index, GlwBufferModes::Static_Draw };
 		specification.Attributes = Attributes;
@@ -39,28 +39,91 @@ GlwVertexArray::GlwVertexArray( )
 { }
 
 bool GlwVertexArray::Create( ) {
-	glGenVertexArrays( 1, &m_handle );
+	glCreateVertexArrays( 1, &m_handle );
 
-	auto result = glIsValid( m_handle );
+	return glIsValid( m_handle );
+}
 
-	if ( result )
-		glBindVertexArray( m_handle );
+void GlwVertexArray::Link(
+	const std::vector<GlwVertexAttribute>& attributes,
+	const GlwBuffer& vertex_buffer,
+	const GlwBuffer& index_buffer
+) {
+	Link( attributes, vertex_buffer, { }, index_buffer );
+}
 
-	return result;
+void GlwVertexArray::Link(
+	const std::vector<GlwVertexAttribute>& attributes,
+	const GlwBuffer& vertex_buffer,
+	const GlwBuffer& instance_buffer,
+	const GlwBuffer& index_buffer
+) {
+	LinkFormat( attributes );
+
+	for ( auto& attribute : attributes ) {
+		if ( attribute.Size == 0 || attribute.Size > 4 )
+			continue;
+
+		auto buffer = vertex_buffer.Get( );
+
+		if ( attribute.GetIsInstanced( ) && instance_buffer.GetIsValid( ) )
+			buffer = instance_buffer.Get( );
+
+		LinkBuffer( attribute.Binding, buffer, GetStride( attribute ) );
+	}
+
+	if ( index_buffer.GetIsValid( ) )
+		LinkIndex( index_buffer );
 }
 
-void GlwVertexArray::Link( const std::vector<GlwVertexAttribute>& attributes ) {
-	for ( auto attribute : attributes ) {
+void GlwVertexArray::Link(
+	const GlwVertexElement* elements,
+	const uint32_t count,
+	const uint32_t stride,
+	const GlwBuffer& vertex_buffer,
+	const GlwBuffer& index_buffer
+) {
+	LinkFormat( elements, count );
+	LinkBuffer( 0, vertex_buffer, stride );
+
+	if ( index_buffer.GetIsValid( ) )
+		LinkIndex( index_buffer );
+}
+
+void GlwVertexArray::LinkFormat( const std::vector<GlwVertexAttribute>& attributes ) {
+	for ( auto& attribute : attributes ) {
 		if ( attribute.Size == 0 || attribute.Size > 4 )
 			continue;
 
-		glEnableVertexAttribArray( attribute.Location );
-		glVertexAttribPointer( attribute.Location, attribute.Size, attribute.Type, GL_FALSE, attribute.Stride, NULL );
+		glEnableVertexArrayAttrib( m_handle, attribute.Location );
+		glVertexArrayBindingDivisor( m_handle, attribute.Binding, attribute.Divisor );
+		LinkAttribute( attribute.Location, attribute.Size, attribute.Type, attribute.Mode, attribute.Offset );
+		glVertexArrayAttribBinding( m_handle, attribute.Location, attribute.Binding );
 	}
 }
 
-void GlwVertexArray::Use( ) {
-	glBindVertexArray( m_handle );
+void GlwVertexArray::LinkFormat( const GlwVertexElement* elements, const uint32_t count ) {
+	glVertexArrayBindingDivisor( m_handle, 0, 0 );
+
+	for ( auto index = (uint32_t)0; index < count; index++ ) {
+		auto& element = elements[ index ];
+
+		glEnableVertexArrayAttrib( m_handle, element.Location );
+		LinkAttribute( element.Location, element.Size, element.Type, element.Mode, element.Offset );
+		glVertexArrayAttribBinding( m_handle, element.Location, 0 );
+	}
+}
+
+void GlwVertexArray::LinkBuffer( const uint32_t binding, const glBuffer buffer, const uint32_t stride ) {
+	glVertexArrayVertexBuffer( m_handle, binding, buffer, 0, stride );
+}
+
+void GlwVertexArray::LinkIndex( const glBuffer index_buffer ) {
+	glVertexArrayElementBuffer( m_handle, index_buffer );
+}
+
+void GlwVertexArray::Use( GlwStateTracker& state_tracker ) {
+	state_tracker.UseVertexArray( m_handle );
 }
 
 void GlwVertexArray::Destroy( ) {
@@ -71,6 +134,24 @@ void GlwVertexArray::Destroy( ) {
 	}
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void GlwVertexArray::LinkAttribute(
+	const uint32_t location,
+	const uint32_t size,
+	const uint32_t type,
+	const GlwVertexAttributeModes mode,
+	const uint32_t offset
+) {
+	switch ( mode ) {
+		case GlwVertexAttributeModes::Normalized : glVertexArrayAttribFormat( m_handle, location, size, type, GL_TRUE, offset ); break;
+		case GlwVertexAttributeModes::Integer	 : glVertexArrayAttribIFormat( m_handle, location, size, type, offset ); break;
+
+		default : glVertexArrayAttribFormat( m_handle, location, size, type, GL_FALSE, offset ); break;
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,6 +159,35 @@ const glVertexArray GlwVertexArray::Get( ) const {
 	return m_handle;
 }
 
+uint32_t GlwVertexArray::GetStride( const GlwVertexAttribute& attribute ) {
+	auto result = attribute.Stride;
+
+	if ( result == 0 )
+		result = attribute.GetIsPacked( ) ? 4 : attribute.Size * GetTypeSize( attribute.Type );
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t GlwVertexArray::GetTypeSize( const uint32_t type ) {
+	auto result = (uint32_t)4;
+
+	switch ( type ) {
+		case GL_BYTE		   :
+		case GL_UNSIGNED_BYTE  : result = 1; break;
+		case GL_SHORT		   :
+		case GL_UNSIGNED_SHORT :
+		case GL_HALF_FLOAT	   : result = 2; break;
+		case GL_DOUBLE		   : result = 8; break;
+
+		default : break;
+	}
+
+	return result;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	OPERATOR ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,7 +31,7 @@
 
 #pragma once
 
-#include "GlwVertexAttribute.h"
+#include "GlwVertexLayout.h"
 
 class GlwVertexArray final {
 
@@ -58,16 +58,92 @@ public:
 
 	/**
 	 * Link method
-	 * @note : Link query vertex attribute list.
+	 * @note : Link query vertex attribute list, each attribute read from its
+	 *		   binding slot of the vertex buffer.
 	 * @param attributes : Query attribute list.
+	 * @param vertex_buffer : Query vertex buffer.
+	 * @param index_buffer : Query index buffer, ignored when invalid.
 	 **/
-	void Link( const std::vector<GlwVertexAttribute>& attributes );
+	void Link( 
+		const std::vector<GlwVertexAttribute>& attributes,
+		const GlwBuffer& vertex_buffer,
+		const GlwBuffer& index_buffer
+	);
+
+	/**
+	 * Link method
+	 * @note : Link query vertex attribute list, instanced attributes read from
+	 *		   the instance buffer when it is valid.
+	 * @param attributes : Query attribute list.
+	 * @param vertex_buffer : Query vertex buffer.
+	 * @param instance_buffer : Query instance buffer.
+	 * @param index_buffer : Query index buffer, ignored when invalid.
+	 **/
+	void Link( 
+		const std::vector<GlwVertexAttribute>& attributes,
+		const GlwBuffer& vertex_buffer,
+		const GlwBuffer& instance_buffer,
+		const GlwBuffer& index_buffer
+	);
+
+	/**
+	 * Link method
+	 * @note : Link attributes from elements of a compile time layout, all
+	 *		   read from binding slot 0 with the vertex type stride.
+	 * @param elements : Query element array.
+	 * @param count : Query element count.
+	 * @param stride : Query vertex stride.
+	 * @param vertex_buffer : Query vertex buffer.
+	 * @param index_buffer : Query index buffer, ignored when invalid.
+	 **/
+	void Link(
+		const GlwVertexElement* elements,
+		const uint32_t count,
+		const uint32_t stride,
+		const GlwBuffer& vertex_buffer,
+		const GlwBuffer& index_buffer
+	);
+
+	/**
+	 * LinkFormat method
+	 * @note : Set attribute formats, binding slots and divisors only, buffers
+	 *		   are attached later with LinkBuffer so meshes of the same format 
+	 *		   can share the vertex array.
+	 * @param attributes : Query attribute list.
+	 **/
+	void LinkFormat( const std::vector<GlwVertexAttribute>& attributes );
+
+	/**
+	 * LinkFormat method
+	 * @note : Set attribute formats of compile time layout elements, all read
+	 *		   from binding slot 0.
+	 * @param elements : Query element array.
+	 * @param count : Query element count.
+	 **/
+	void LinkFormat( const GlwVertexElement* elements, const uint32_t count );
+
+	/**
+	 * LinkBuffer method
+	 * @note : Attach a buffer to a binding slot.
+	 * @param binding : Query binding slot.
+	 * @param buffer : Query OpenGL buffer.
+	 * @param stride : Query stride between two elements of the slot.
+	 **/
+	void LinkBuffer( const uint32_t binding, const glBuffer buffer, const uint32_t stride );
+
+	/**
+	 * LinkIndex method
+	 * @note : Attach index buffer.
+	 * @param index_buffer : Query OpenGL index buffer.
+	 **/
+	void LinkIndex( const glBuffer index_buffer );
 
 	/**
 	 * Use method
 	 * @note : Bind vertex array for usage.
+	 * @param state_tracker : Query current state tracker.
 	 **/
-	void Use( );
+	void Use( GlwStateTracker& state_tracker );
 
 	/**
 	 * Destroy method
@@ -75,6 +151,43 @@ public:
 	 **/
 	void Destroy( );
 
+private:
+	/**
+	 * LinkAttribute method
+	 * @note : Set attribute format according to attribute mode.
+	 * @param location : Query attribute location.
+	 * @param size : Query component count.
+	 * @param type : Query component type.
+	 * @param mode : Query attribute mode.
+	 * @param offset : Query attribute offset inside an element.
+	 **/
+	void LinkAttribute(
+		const uint32_t location,
+		const uint32_t size,
+		const uint32_t type,
+		const GlwVertexAttributeModes mode,
+		const uint32_t offset
+	);
+
+public:
+	/**
+	 * Link template method
+	 * @note : Link attributes from the declared layout of the vertex type,
+	 *		   layout is validated at compile time.
+	 * @template VertexType : Type of data used for vertex representation.
+	 * @param vertex_buffer : Query vertex buffer.
+	 * @param index_buffer : Query index buffer, ignored when invalid.
+	 **/
+	template<typename VertexType>
+		requires GlwVertexLayoutDeclared<VertexType>
+	void Link( const GlwBuffer& vertex_buffer, const GlwBuffer& index_buffer ) {
+		using Traits = GlwVertexLayoutTraits<VertexType>;
+
+		static_assert( Traits::GetIsValid( ), "Vertex layout element outside the vertex or location used twice." );
+
+		Link( GlwVertexLayout<VertexType>::Elements, Traits::Count, Traits::Stride, vertex_buffer, index_buffer );
+	};
+
 public:
 	/**
 	 * Get const function
@@ -83,6 +196,24 @@ public:
 	 **/
 	const glVertexArray Get( ) const;
 
+	/**
+	 * GetStride static function
+	 * @note : Get stride of the binding slot read by an attribute, attribute 
+	 *		   stride or its size when attribute stride is 0.
+	 * @param attribute : Query attribute.
+	 * @return : Return stride in bytes.
+	 **/
+	static uint32_t GetStride( const GlwVertexAttribute& attribute );
+
+private:
+	/**
+	 * GetTypeSize static function
+	 * @note : Get size in bytes of an OpenGL attribute component type.
+	 * @param type : Query OpenGL component type.
+	 * @return : Return component size in bytes.
+	 **/
+	static uint32_t GetTypeSize( const uint32_t type );
+
 public:
 	/**
 	 * Cast operator
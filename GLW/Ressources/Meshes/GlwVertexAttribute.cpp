@@ -51,9 +51,62 @@ GlwVertexAttribute::GlwVertexAttribute(
 	const uint32_t size,
 	const uint32_t type,
 	const uint32_t stride
+)
+	: GlwVertexAttribute{ location, size, type, stride, 0, location, 0 }
+{ }
+
+GlwVertexAttribute::GlwVertexAttribute(
+	const uint32_t location,
+	const uint32_t size,
+	const uint32_t type,
+	const GlwVertexAttributeModes mode,
+	const uint32_t stride,
+	const uint32_t offset
+)
+	: GlwVertexAttribute{ location, size, type, mode, stride, offset, location, 0 }
+{ }
+
+GlwVertexAttribute::GlwVertexAttribute(
+	const uint32_t location,
+	const uint32_t size,
+	const uint32_t type,
+	const uint32_t stride,
+	const uint32_t offset,
+	const uint32_t binding,
+	const uint32_t divisor
+)
+	: GlwVertexAttribute{ location, size, type, GlwVertexAttributeModes::Float, stride, offset, binding, divisor }
+{ }
+
+GlwVertexAttribute::GlwVertexAttribute(
+	const uint32_t location,
+	const uint32_t size,
+	const uint32_t type,
+	const GlwVertexAttributeModes mode,
+	const uint32_t stride,
+	const uint32_t offset,
+	const uint32_t binding,
+	const uint32_t divisor
 )
 	: Location{ location },
 	Size{ size },
 	Type{ type },
-	Stride{ stride }
+	Mode{ mode },
+	Stride{ stride },
+	Offset{ offset },
+	Binding{ binding },
+	Divisor{ divisor }
 { }
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwVertexAttribute::GetIsInstanced( ) const {
+	return Divisor > 0;
+}
+
+bool GlwVertexAttribute::GetIsPacked( ) const {
+	return  Type == GL_INT_2_10_10_10_REV		   ||
+			Type == GL_UNSIGNED_INT_2_10_10_10_REV ||
+			Type == GL_UNSIGNED_INT_10F_11F_11F_REV;
+}
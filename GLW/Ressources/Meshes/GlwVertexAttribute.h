@@ -31,14 +31,18 @@
 
 #pragma once
 
-#include "../Buffers/GlwBuffer.h"
+#include "GlwVertexAttributeModes.h"
 
 struct GlwVertexAttribute {
 
 	uint32_t Location;
 	uint32_t Size;
 	uint32_t Type;
+	GlwVertexAttributeModes Mode;
 	uint32_t Stride;
+	uint32_t Offset;
+	uint32_t Binding;
+	uint32_t Divisor;
 
 	/**
 	 * Constructor
@@ -71,4 +75,83 @@ struct GlwVertexAttribute {
 		const uint32_t stride
 	);
 
+	/**
+	 * Constructor
+	 * @note : Packed types as GL_INT_2_10_10_10_REV need a size of 4.
+	 * @param location : Vertrex attribute input location.
+	 * @param size : Components count of the attribute from 1 to 4.
+	 * @param type : Type of element store by the attribute.
+	 * @param mode : How integer elements reach the shader.
+	 * @param stride : Stride between two vertices.
+	 * @param offset : Offset of the attribute inside a vertex.
+	 **/
+	GlwVertexAttribute(
+		const uint32_t location,
+		const uint32_t size,
+		const uint32_t type,
+		const GlwVertexAttributeModes mode,
+		const uint32_t stride,
+		const uint32_t offset
+	);
+
+	/**
+	 * Constructor
+	 * @note : Attributes sharing a binding slot read the same buffer, they
+	 *		   must use the same stride and divisor.
+	 * @param location : Vertrex attribute input location.
+	 * @param size : Components count of the attribute from 1 to 4.
+	 * @param type : Type of element store by the attribute.
+	 * @param stride : Stride between two elements of the binding slot.
+	 * @param offset : Offset of the attribute inside an element.
+	 * @param binding : Binding slot the attribute read from.
+	 * @param divisor : Instance count between two elements, 0 to advance per vertex.
+	 **/
+	GlwVertexAttribute(
+		const uint32_t location,
+		const uint32_t size,
+		const uint32_t type,
+		const uint32_t stride,
+		const uint32_t offset,
+		const uint32_t binding,
+		const uint32_t divisor
+	);
+
+	/**
+	 * Constructor
+	 * @note : Attributes sharing a binding slot read the same buffer, they
+	 *		   must use the same stride and divisor.
+	 * @param location : Vertrex attribute input location.
+	 * @param size : Components count of the attribute from 1 to 4.
+	 * @param type : Type of element store by the attribute.
+	 * @param mode : How integer elements reach the shader.
+	 * @param stride : Stride between two elements of the binding slot.
+	 * @param offset : Offset of the attribute inside an element.
+	 * @param binding : Binding slot the attribute read from.
+	 * @param divisor : Instance count between two elements, 0 to advance per vertex.
+	 **/
+	GlwVertexAttribute(
+		const uint32_t location,
+		const uint32_t size,
+		const uint32_t type,
+		const GlwVertexAttributeModes mode,
+		const uint32_t stride,
+		const uint32_t offset,
+		const uint32_t binding,
+		const uint32_t divisor
+	);
+
+	/**
+	 * GetIsInstanced const function
+	 * @note : Get if attribute advance per instance.
+	 * @return : True when divisor is not 0.
+	 **/
+	bool GetIsInstanced( ) const;
+
+	/**
+	 * GetIsPacked const function
+	 * @note : Get if all components are packed in a single 32 bits element.
+	 * @return : True when type is a packed type.
+	 **/
+	bool GetIsPacked( ) const;
+
 };
@@ -0,0 +1,169 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwVertexQuantizer.h"
+
+/**
+ * GlwVertexElementTraits template struct
+ * @note : Component count and OpenGL type of a vertex member type.
+ * @template Type : Type of the vertex member.
+ **/
+template<typename Type>
+struct GlwVertexElementTraits;
+
+template<uint32_t ComponentCount, uint32_t ComponentType>
+struct GlwVertexElementTraitsBase {
+
+	static constexpr uint32_t Size = ComponentCount;
+	static constexpr uint32_t Type = ComponentType;
+
+};
+
+template<> struct GlwVertexElementTraits<float>        : GlwVertexElementTraitsBase<1, GL_FLOAT> { };
+template<> struct GlwVertexElementTraits<glm::vec2>    : GlwVertexElementTraitsBase<2, GL_FLOAT> { };
+template<> struct GlwVertexElementTraits<glm::vec3>    : GlwVertexElementTraitsBase<3, GL_FLOAT> { };
+template<> struct GlwVertexElementTraits<glm::vec4>    : GlwVertexElementTraitsBase<4, GL_FLOAT> { };
+template<> struct GlwVertexElementTraits<int32_t>      : GlwVertexElementTraitsBase<1, GL_INT> { };
+template<> struct GlwVertexElementTraits<glm::ivec2>   : GlwVertexElementTraitsBase<2, GL_INT> { };
+template<> struct GlwVertexElementTraits<glm::ivec3>   : GlwVertexElementTraitsBase<3, GL_INT> { };
+template<> struct GlwVertexElementTraits<glm::ivec4>   : GlwVertexElementTraitsBase<4, GL_INT> { };
+template<> struct GlwVertexElementTraits<uint32_t>     : GlwVertexElementTraitsBase<1, GL_UNSIGNED_INT> { };
+template<> struct GlwVertexElementTraits<glm::uvec2>   : GlwVertexElementTraitsBase<2, GL_UNSIGNED_INT> { };
+template<> struct GlwVertexElementTraits<glm::uvec3>   : GlwVertexElementTraitsBase<3, GL_UNSIGNED_INT> { };
+template<> struct GlwVertexElementTraits<glm::uvec4>   : GlwVertexElementTraitsBase<4, GL_UNSIGNED_INT> { };
+template<> struct GlwVertexElementTraits<glm::i8vec4>  : GlwVertexElementTraitsBase<4, GL_BYTE> { };
+template<> struct GlwVertexElementTraits<glm::u8vec4>  : GlwVertexElementTraitsBase<4, GL_UNSIGNED_BYTE> { };
+template<> struct GlwVertexElementTraits<glm::i16vec2> : GlwVertexElementTraitsBase<2, GL_SHORT> { };
+template<> struct GlwVertexElementTraits<glm::i16vec4> : GlwVertexElementTraitsBase<4, GL_SHORT> { };
+template<> struct GlwVertexElementTraits<glm::u16vec2> : GlwVertexElementTraitsBase<2, GL_UNSIGNED_SHORT> { };
+template<> struct GlwVertexElementTraits<glm::u16vec4> : GlwVertexElementTraitsBase<4, GL_UNSIGNED_SHORT> { };
+
+/**
+ * GlwVertexElement struct
+ * @note : Compile time description of a vertex attribute, see GlwVertexLayout.
+ **/
+struct GlwVertexElement {
+
+	uint32_t Location;
+	uint32_t Size;
+	uint32_t Type;
+	GlwVertexAttributeModes Mode;
+	uint32_t Offset;
+
+	/**
+	 * Constructor
+	 * @param location : Vertrex attribute input location.
+	 * @param size : Components count of the attribute from 1 to 4.
+	 * @param type : Type of element store by the attribute.
+	 * @param mode : How integer elements reach the shader.
+	 * @param offset : Offset of the attribute inside a vertex.
+	 **/
+	constexpr GlwVertexElement(
+		const uint32_t location,
+		const uint32_t size,
+		const uint32_t type,
+		const GlwVertexAttributeModes mode,
+		const uint32_t offset
+	)
+		: Location{ location },
+		Size{ size },
+		Type{ type },
+		Mode{ mode },
+		Offset{ offset }
+	{ };
+
+	/**
+	 * GetLength const function
+	 * @note : Get size of the attribute inside a vertex.
+	 * @return : Return attribute size in bytes.
+	 **/
+	constexpr uint32_t GetLength( ) const {
+		auto result = Size * (uint32_t)sizeof( float );
+
+		switch ( Type ) {
+			case GL_BYTE                         :
+			case GL_UNSIGNED_BYTE                : result = Size; break;
+			case GL_SHORT                        :
+			case GL_UNSIGNED_SHORT               :
+			case GL_HALF_FLOAT                   : result = Size * 2; break;
+			case GL_DOUBLE                       : result = Size * 8; break;
+			case GL_INT_2_10_10_10_REV           :
+			case GL_UNSIGNED_INT_2_10_10_10_REV  :
+			case GL_UNSIGNED_INT_10F_11F_11F_REV : result = 4; break;
+
+			default : break;
+		}
+
+		return result;
+	};
+
+public:
+	/**
+	 * Make template function
+	 * @note : Make element from vertex member type, float types are read as
+	 *		   float while integer types are read as integer.
+	 * @template Type : Type of the vertex member.
+	 * @param location : Vertrex attribute input location.
+	 * @param offset : Offset of the member, use offsetof.
+	 * @return : Return element value.
+	 **/
+	template<typename Type>
+	static constexpr GlwVertexElement Make( const uint32_t location, const uint32_t offset ) {
+		using Traits = GlwVertexElementTraits<Type>;
+
+		auto mode = ( Traits::Type == GL_FLOAT ) ? GlwVertexAttributeModes::Float : GlwVertexAttributeModes::Integer;
+
+		return { location, Traits::Size, Traits::Type, mode, offset };
+	};
+
+	/**
+	 * Make template function
+	 * @note : Make element from vertex member type.
+	 * @template Type : Type of the vertex member.
+	 * @param location : Vertrex attribute input location.
+	 * @param mode : How integer elements reach the shader.
+	 * @param offset : Offset of the member, use offsetof.
+	 * @return : Return element value.
+	 **/
+	template<typename Type>
+	static constexpr GlwVertexElement Make( 
+		const uint32_t location, 
+		const GlwVertexAttributeModes mode, 
+		const uint32_t offset 
+	) {
+		using Traits = GlwVertexElementTraits<Type>;
+
+		return { location, Traits::Size, Traits::Type, mode, offset };
+	};
+
+};
@@ -0,0 +1,112 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwVertexFormat::GlwVertexFormat( )
+	: m_vao{ },
+	m_buffers{ },
+	m_strides{ },
+	m_index{ GL_NULL }
+{ }
+
+bool GlwVertexFormat::Create( const std::vector<GlwVertexAttribute>& attributes ) {
+	auto result = m_vao.Create( );
+
+	if ( result )
+		m_vao.LinkFormat( attributes );
+
+	return result;
+}
+
+bool GlwVertexFormat::Create( const GlwVertexElement* elements, const uint32_t count ) {
+	auto result = m_vao.Create( );
+
+	if ( result )
+		m_vao.LinkFormat( elements, count );
+
+	return result;
+}
+
+void GlwVertexFormat::Bind( const uint32_t binding, const glBuffer buffer, const uint32_t stride ) {
+	if ( binding >= m_buffers.size( ) ) {
+		m_buffers.resize( binding + 1, GL_NULL );
+		m_strides.resize( binding + 1, 0 );
+	}
+
+	if ( m_buffers[ binding ] == buffer && m_strides[ binding ] == stride )
+		return;
+
+	m_buffers[ binding ] = buffer;
+	m_strides[ binding ] = stride;
+
+	m_vao.LinkBuffer( binding, buffer, stride );
+}
+
+void GlwVertexFormat::BindIndex( const glBuffer index_buffer ) {
+	if ( m_index != index_buffer ) {
+		m_index = index_buffer;
+
+		m_vao.LinkIndex( index_buffer );
+	}
+}
+
+void GlwVertexFormat::Use( GlwStateTracker& state_tracker ) {
+	m_vao.Use( state_tracker );
+}
+
+void GlwVertexFormat::Invalidate( ) {
+	m_buffers.clear( );
+	m_strides.clear( );
+
+	m_index = GL_NULL;
+}
+
+void GlwVertexFormat::Destroy( ) {
+	Invalidate( );
+
+	m_vao.Destroy( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwVertexFormat::GetIsValid( ) const {
+	return glIsValid( m_vao );
+}
+
+const GlwVertexArray& GlwVertexFormat::GetVAO( ) const {
+	return m_vao;
+}
@@ -0,0 +1,130 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwVertexBinding.h"
+
+/**
+ * GlwVertexFormat final class
+ * @note : Vertex array holding only attribute formats, shared between meshes
+ *		   of the same format. Buffers attached to each binding slot are cached
+ *		   so switching to a mesh only rebinds the buffers that differ.
+ **/
+class GlwVertexFormat final {
+
+private:
+	GlwVertexArray m_vao;
+	std::vector<glBuffer> m_buffers;
+	std::vector<uint32_t> m_strides;
+	glBuffer m_index;
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwVertexFormat( );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwVertexFormat( ) = default;
+
+	/**
+	 * Create function
+	 * @note : Create vertex format from attribute list.
+	 * @param attributes : Query attribute list.
+	 * @return : True when creation succeeded.
+	 **/
+	bool Create( const std::vector<GlwVertexAttribute>& attributes );
+
+	/**
+	 * Create function
+	 * @note : Create vertex format from compile time layout elements.
+	 * @param elements : Query element array.
+	 * @param count : Query element count.
+	 * @return : True when creation succeeded.
+	 **/
+	bool Create( const GlwVertexElement* elements, const uint32_t count );
+
+	/**
+	 * Bind method
+	 * @note : Attach buffer to binding slot, skipped when already attached.
+	 * @param binding : Query binding slot.
+	 * @param buffer : Query OpenGL buffer.
+	 * @param stride : Query stride between two elements of the slot.
+	 **/
+	void Bind( const uint32_t binding, const glBuffer buffer, const uint32_t stride );
+
+	/**
+	 * BindIndex method
+	 * @note : Attach index buffer, skipped when already attached.
+	 * @param index_buffer : Query OpenGL index buffer.
+	 **/
+	void BindIndex( const glBuffer index_buffer );
+
+	/**
+	 * Use method
+	 * @note : Bind vertex format for usage.
+	 * @param state_tracker : Query current state tracker.
+	 **/
+	void Use( GlwStateTracker& state_tracker );
+
+	/**
+	 * Invalidate method
+	 * @note : Forget attached buffers, must be called when buffers are deleted
+	 *		   as OpenGL can reuse their names.
+	 **/
+	void Invalidate( );
+
+	/**
+	 * Destroy method
+	 * @note : Destroy vertex format.
+	 **/
+	void Destroy( );
+
+public:
+	/**
+	 * GetIsValid const function
+	 * @note : Get vertex format validity.
+	 * @return : Return true when vertex array is valid.
+	 **/
+	bool GetIsValid( ) const;
+
+	/**
+	 * GetVAO const function
+	 * @note : Get shared vertex array instance.
+	 * @return : Constant reference to vertex array.
+	 **/
+	const GlwVertexArray& GetVAO( ) const;
+
+};
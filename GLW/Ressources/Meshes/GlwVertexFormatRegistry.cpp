@@ -0,0 +1,127 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+GlwVertexFormatRegistry::GlwVertexFormatRegistry( )
+	: m_formats{ }
+{ }
+
+bool GlwVertexFormatRegistry::Acquire(
+	const std::vector<GlwVertexAttribute>& attributes,
+	GlwVertexFormat*& format
+) {
+	auto key = std::string{ };
+
+	for ( auto& attribute : attributes ) {
+		if ( attribute.Size == 0 || attribute.Size > 4 )
+			continue;
+
+		Append( 
+			key, 
+			attribute.Location, attribute.Size, attribute.Type, attribute.Mode, attribute.Offset,
+			attribute.Binding, attribute.Divisor
+		);
+	}
+
+	auto result = Find( key, format );
+
+	if ( !result ) {
+		auto instance = GlwVertexFormat{ };
+
+		if ( result = instance.Create( attributes ) )
+			Store( key, instance, format );
+	}
+
+	return result;
+}
+
+void GlwVertexFormatRegistry::Invalidate( ) {
+	for ( auto& [ key, format ] : m_formats )
+		format.Invalidate( );
+}
+
+void GlwVertexFormatRegistry::Destroy( ) {
+	for ( auto& [ key, format ] : m_formats )
+		format.Destroy( );
+
+	m_formats.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool GlwVertexFormatRegistry::Find( const std::string& key, GlwVertexFormat*& format ) {
+	auto iterator = m_formats.find( key );
+	auto result   = iterator != m_formats.end( );
+
+	if ( result )
+		format = &iterator->second;
+
+	return result;
+}
+
+void GlwVertexFormatRegistry::Store(
+	const std::string& key,
+	const GlwVertexFormat& instance,
+	GlwVertexFormat*& format
+) {
+	auto& stored = m_formats[ key ];
+
+	stored = instance;
+	format = &stored;
+}
+
+void GlwVertexFormatRegistry::Append(
+	std::string& key,
+	const uint32_t location,
+	const uint32_t size,
+	const uint32_t type,
+	const GlwVertexAttributeModes mode,
+	const uint32_t offset,
+	const uint32_t binding,
+	const uint32_t divisor
+) {
+	const uint32_t values[] = { location, size, type, (uint32_t)mode, offset, binding, divisor };
+
+	key.append( (const char*)values, sizeof( values ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t GlwVertexFormatRegistry::GetCount( ) const {
+	return (uint32_t)m_formats.size( );
+}
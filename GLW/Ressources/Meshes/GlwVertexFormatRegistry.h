@@ -0,0 +1,157 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+
+#pragma once
+
+#include "GlwVertexFormat.h"
+
+/**
+ * GlwVertexFormatRegistry final class
+ * @note : Cache of vertex formats keyed by attribute formats, binding slots and
+ *		   divisors, meshes sharing a format share its vertex array.
+ **/
+class GlwVertexFormatRegistry final {
+
+private:
+	std::unordered_map<std::string, GlwVertexFormat> m_formats;
+
+public:
+	/**
+	 * Constructor
+	 **/
+	GlwVertexFormatRegistry( );
+
+	/**
+	 * Destructor
+	 **/
+	~GlwVertexFormatRegistry( ) = default;
+
+	/**
+	 * Acquire function
+	 * @note : Get vertex format matching attribute list, created on first use.
+	 * @param attributes : Query attribute list.
+	 * @param format : Store pointer to vertex format.
+	 * @return : True when operation succeeded.
+	 **/
+	bool Acquire( const std::vector<GlwVertexAttribute>& attributes, GlwVertexFormat*& format );
+
+	/**
+	 * Invalidate method
+	 * @note : Forget attached buffers of every vertex format.
+	 **/
+	void Invalidate( );
+
+	/**
+	 * Destroy method
+	 * @note : Destroy all vertex formats.
+	 **/
+	void Destroy( );
+
+private:
+	/**
+	 * Find function
+	 * @note : Find vertex format of key.
+	 * @param key : Query format key.
+	 * @param format : Store pointer to vertex format.
+	 * @return : True when vertex format exist.
+	 **/
+	bool Find( const std::string& key, GlwVertexFormat*& format );
+
+	/**
+	 * Store method
+	 * @note : Store created vertex format under key.
+	 * @param key : Query format key.
+	 * @param instance : Query created vertex format.
+	 * @param format : Store pointer to stored vertex format.
+	 **/
+	void Store( const std::string& key, const GlwVertexFormat& instance, GlwVertexFormat*& format );
+
+	/**
+	 * Append static method
+	 * @note : Append attribute format to key.
+	 * @param key : Query key to append to.
+	 * @param location : Query attribute location.
+	 * @param size : Query attribute component count.
+	 * @param type : Query attribute component type.
+	 * @param mode : Query attribute mode.
+	 * @param offset : Query attribute offset.
+	 * @param binding : Query attribute binding slot.
+	 * @param divisor : Query attribute divisor.
+	 **/
+	static void Append(
+		std::string& key,
+		const uint32_t location,
+		const uint32_t size,
+		const uint32_t type,
+		const GlwVertexAttributeModes mode,
+		const uint32_t offset,
+		const uint32_t binding,
+		const uint32_t divisor
+	);
+
+public:
+	/**
+	 * Acquire template function
+	 * @note : Get vertex format of vertex type declared GlwVertexLayout.
+	 * @template VertexType : Type of data used for vertex representation.
+	 * @param format : Store pointer to vertex format.
+	 * @return : True when operation succeeded.
+	 **/
+	template<typename VertexType>
+		requires GlwVertexLayoutDeclared<VertexType>
+	bool Acquire( GlwVertexFormat*& format ) {
+		auto key = std::string{ };
+
+		for ( auto& element : GlwVertexLayout<VertexType>::Elements )
+			Append( key, element.Location, element.Size, element.Type, element.Mode, element.Offset, 0, 0 );
+
+		auto result = Find( key, format );
+
+		if ( !result ) {
+			auto instance = GlwVertexFormat{ };
+
+			if ( result = instance.Create( GlwVertexLayout<VertexType>::Elements, GlwVertexLayoutTraits<VertexType>::Count ) )
+				Store( key, instance, format );
+		}
+
+		return result;
+	};
+
+public:
+	/**
+	 * GetCount const function
+	 * @note : Get vertex format count.
+	 * @return : Return vertex format count value.
+	 **/
+	uint32_t GetCount( ) const;
+
+};
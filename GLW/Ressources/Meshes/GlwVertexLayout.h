@@ -0,0 +1,98 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwVertexElement.h"
+
+/**
+ * GlwVertexLayout template struct
+ * @note : Specialize once per vertex type with a static constexpr array of
+ *		   GlwVertexElement named Elements :
+ *
+ *		   template<>
+ *		   struct GlwVertexLayout<MyVertex> {
+ *			   static constexpr GlwVertexElement Elements[] = {
+ *				   GlwVertexElement::Make<glm::vec3>( 0, offsetof( MyVertex, Position ) ),
+ *				   GlwVertexElement::Make<glm::vec2>( 1, offsetof( MyVertex, UV ) )
+ *			   };
+ *		   };
+ *
+ *		   Stride is sizeof( MyVertex ), the layout is checked at compile time.
+ * @template VertexType : Type of data used for vertex representation.
+ **/
+template<typename VertexType>
+struct GlwVertexLayout;
+
+/**
+ * GlwVertexLayoutDeclared concept
+ * @note : Satisfied when GlwVertexLayout is specialized for VertexType.
+ **/
+template<typename VertexType>
+concept GlwVertexLayoutDeclared = requires { GlwVertexLayout<VertexType>::Elements; };
+
+/**
+ * GlwVertexLayoutTraits template struct
+ * @note : Compile time values derived from a declared vertex layout.
+ * @template VertexType : Type of data used for vertex representation.
+ **/
+template<typename VertexType>
+	requires GlwVertexLayoutDeclared<VertexType>
+struct GlwVertexLayoutTraits {
+
+	static constexpr uint32_t Stride = (uint32_t)sizeof( VertexType );
+	static constexpr uint32_t Count  = (uint32_t)( sizeof( GlwVertexLayout<VertexType>::Elements ) / sizeof( GlwVertexElement ) );
+
+	/**
+	 * GetIsValid static function
+	 * @note : Get if each element fit inside the vertex with a valid size and
+	 *		   an unique location.
+	 * @return : True when layout is valid.
+	 **/
+	static consteval bool GetIsValid( ) {
+		auto& elements = GlwVertexLayout<VertexType>::Elements;
+
+		for ( auto index = (uint32_t)0; index < Count; index++ ) {
+			auto& element = elements[ index ];
+
+			if ( element.Size == 0 || element.Size > 4 || element.Offset + element.GetLength( ) > Stride )
+				return false;
+
+			for ( auto other = index + 1; other < Count; other++ ) {
+				if ( elements[ other ].Location == element.Location )
+					return false;
+			}
+		}
+
+		return Count > 0;
+	};
+
+};
@@ -0,0 +1,242 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#include "__glw_pch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void GlwVertexQuantizer::QuantizePositions(
+	const uint32_t count,
+	const glm::vec3* positions,
+	const glm::vec3& minimum,
+	const glm::vec3& maximum,
+	const uint32_t stride,
+	void* destination
+) {
+	auto* output = (uint8_t*)destination;
+	auto extent  = maximum - minimum;
+	auto scale   = glm::vec3{ 
+		( extent.x > 0.f ) ? 65535.f / extent.x : 0.f,
+		( extent.y > 0.f ) ? 65535.f / extent.y : 0.f,
+		( extent.z > 0.f ) ? 65535.f / extent.z : 0.f
+	};
+
+#	ifdef GLW_SSE2
+	auto sse_minimum = _mm_set_ps( 0.f, minimum.z, minimum.y, minimum.x );
+	auto sse_scale   = _mm_set_ps( 0.f, scale.z, scale.y, scale.x );
+	auto sse_w       = _mm_set_ps( 65535.f, 0.f, 0.f, 0.f );
+	auto sse_zero    = _mm_setzero_ps( );
+	auto sse_one     = _mm_set1_ps( 65535.f );
+	auto sse_bias    = _mm_set1_epi32( 32768 );
+	auto sse_sign    = _mm_set1_epi16( (short)0x8000 );
+
+	for ( auto vertex = (uint32_t)0; vertex < count; vertex++ ) {
+		auto& position = positions[ vertex ];
+		auto value     = _mm_set_ps( 0.f, position.z, position.y, position.x );
+
+		value = _mm_add_ps( _mm_mul_ps( _mm_sub_ps( value, sse_minimum ), sse_scale ), sse_w );
+		value = _mm_min_ps( _mm_max_ps( value, sse_zero ), sse_one );
+
+		// packs_epi32 saturate to signed range, bias to it then flip back the sign bit.
+		auto lanes  = _mm_sub_epi32( _mm_cvtps_epi32( value ), sse_bias );
+		auto packed = _mm_xor_si128( _mm_packs_epi32( lanes, lanes ), sse_sign );
+
+		_mm_storel_epi64( (__m128i*)( output + vertex * stride ), packed );
+	}
+#	else
+	for ( auto vertex = (uint32_t)0; vertex < count; vertex++ ) {
+		auto value  = glm::clamp( ( positions[ vertex ] - minimum ) * scale, 0.f, 65535.f );
+		auto packed = glm::u16vec4{ 
+			(uint16_t)std::nearbyint( value.x ), 
+			(uint16_t)std::nearbyint( value.y ), 
+			(uint16_t)std::nearbyint( value.z ), 
+			UINT16_MAX 
+		};
+
+		memcpy( output + vertex * stride, &packed, sizeof( glm::u16vec4 ) );
+	}
+#	endif
+}
+
+void GlwVertexQuantizer::QuantizeNormals(
+	const uint32_t count,
+	const glm::vec3* normals,
+	const uint32_t stride,
+	void* destination
+) {
+	auto* output = (uint8_t*)destination;
+
+	for ( auto vertex = (uint32_t)0; vertex < count; vertex++ ) {
+		auto& normal = normals[ vertex ];
+		auto packed  = Pack( normal.x, normal.y, normal.z, 0.f );
+
+		memcpy( output + vertex * stride, &packed, sizeof( uint32_t ) );
+	}
+}
+
+void GlwVertexQuantizer::QuantizeTangents(
+	const uint32_t count,
+	const glm::vec4* tangents,
+	const uint32_t stride,
+	void* destination
+) {
+	auto* output = (uint8_t*)destination;
+
+	for ( auto vertex = (uint32_t)0; vertex < count; vertex++ ) {
+		auto& tangent = tangents[ vertex ];
+		auto sign     = ( tangent.w < 0.f ) ? -1.f : 1.f;
+		auto packed   = Pack( tangent.x, tangent.y, tangent.z, sign );
+
+		memcpy( output + vertex * stride, &packed, sizeof( uint32_t ) );
+	}
+}
+
+void GlwVertexQuantizer::QuantizeUVs(
+	const uint32_t count,
+	const glm::vec2* uvs,
+	const uint32_t stride,
+	void* destination
+) {
+	auto* output = (uint8_t*)destination;
+	auto vertex  = (uint32_t)0;
+
+#	ifdef GLW_SSE2
+	for ( ; vertex + 2 <= count; vertex += 2 ) {
+		alignas( 16 ) uint32_t lanes[ 4 ];
+
+		_mm_store_si128( (__m128i*)lanes, ToHalf( _mm_loadu_ps( &uvs[ vertex ].x ) ) );
+
+		auto first  = ( lanes[ 0 ] & 0xFFFF ) | ( lanes[ 1 ] << 16 );
+		auto second = ( lanes[ 2 ] & 0xFFFF ) | ( lanes[ 3 ] << 16 );
+
+		memcpy( output + vertex * stride, &first, sizeof( uint32_t ) );
+		memcpy( output + ( vertex + 1 ) * stride, &second, sizeof( uint32_t ) );
+	}
+#	endif
+
+	for ( ; vertex < count; vertex++ ) {
+		auto packed = (uint32_t)ToHalf( uvs[ vertex ].x ) | ( (uint32_t)ToHalf( uvs[ vertex ].y ) << 16 );
+
+		memcpy( output + vertex * stride, &packed, sizeof( uint32_t ) );
+	}
+}
+
+uint16_t GlwVertexQuantizer::ToHalf( const float value ) {
+	auto bits   = (uint32_t)0;
+	auto result = (uint32_t)0;
+
+	memcpy( &bits, &value, sizeof( float ) );
+
+	auto sign = bits & 0x80000000u;
+
+	bits ^= sign;
+
+	if ( bits >= ( 127 + 16 ) << 23 )
+		result = ( bits > 0x7F800000u ) ? 0x7E00 : 0x7C00;
+	else if ( bits < ( 127 - 14 ) << 23 ) {
+		// Adding a magic float shift the mantissa in place, the FPU round it.
+		auto magic   = (uint32_t)( ( 127 - 15 ) + ( 23 - 10 ) + 1 ) << 23;
+		auto shifted = 0.f;
+		auto offset  = 0.f;
+		auto rounded = (uint32_t)0;
+
+		memcpy( &shifted, &bits, sizeof( float ) );
+		memcpy( &offset, &magic, sizeof( float ) );
+
+		shifted += offset;
+
+		memcpy( &rounded, &shifted, sizeof( float ) );
+
+		result = rounded - magic;
+	} else {
+		auto odd = ( bits >> 13 ) & 1;
+
+		result = ( bits + ( (uint32_t)( 15 - 127 ) << 23 ) + 0xFFF + odd ) >> 13;
+	}
+
+	return (uint16_t)( result | ( sign >> 16 ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t GlwVertexQuantizer::Pack( const float x, const float y, const float z, const float w ) {
+	alignas( 16 ) int32_t lanes[ 4 ];
+
+#	ifdef GLW_SSE2
+	auto value = _mm_set_ps( w, z, y, x );
+
+	value = _mm_min_ps( _mm_max_ps( value, _mm_set1_ps( -1.f ) ), _mm_set1_ps( 1.f ) );
+	value = _mm_mul_ps( value, _mm_set_ps( 1.f, 511.f, 511.f, 511.f ) );
+
+	_mm_store_si128( (__m128i*)lanes, _mm_cvtps_epi32( value ) );
+#	else
+	lanes[ 0 ] = (int32_t)std::nearbyint( glm::clamp( x, -1.f, 1.f ) * 511.f );
+	lanes[ 1 ] = (int32_t)std::nearbyint( glm::clamp( y, -1.f, 1.f ) * 511.f );
+	lanes[ 2 ] = (int32_t)std::nearbyint( glm::clamp( z, -1.f, 1.f ) * 511.f );
+	lanes[ 3 ] = (int32_t)std::nearbyint( glm::clamp( w, -1.f, 1.f ) );
+#	endif
+
+	return  ( (uint32_t)lanes[ 0 ] & 0x3FF )		 |
+			( ( (uint32_t)lanes[ 1 ] & 0x3FF ) << 10 ) |
+			( ( (uint32_t)lanes[ 2 ] & 0x3FF ) << 20 ) |
+			( ( (uint32_t)lanes[ 3 ] & 0x3 ) << 30 );
+}
+
+#ifdef GLW_SSE2
+__m128i GlwVertexQuantizer::ToHalf( const __m128 values ) {
+	auto sign_mask  = _mm_set1_ps( -0.f );
+	auto f16_max    = _mm_set1_epi32( ( 127 + 16 ) << 23 );
+	auto nan_bit    = _mm_set1_epi32( 0x200 );
+	auto infinity   = _mm_set1_epi32( 0x7C00 );
+	auto min_normal = _mm_set1_epi32( ( 127 - 14 ) << 23 );
+	auto magic      = _mm_set1_epi32( ( ( 127 - 15 ) + ( 23 - 10 ) + 1 ) << 23 );
+	auto bias       = _mm_set1_epi32( 0xFFF - ( ( 127 - 15 ) << 23 ) );
+
+	auto sign       = _mm_and_ps( sign_mask, values );
+	auto absolute   = _mm_andnot_ps( sign_mask, values );
+	auto bits       = _mm_castps_si128( absolute );
+	auto is_nan     = _mm_castps_si128( _mm_cmpunord_ps( absolute, absolute ) );
+	auto is_regular = _mm_cmpgt_epi32( f16_max, bits );
+	auto is_sub     = _mm_cmpgt_epi32( min_normal, bits );
+	auto special    = _mm_or_si128( _mm_and_si128( is_nan, nan_bit ), infinity );
+
+	auto subnormal  = _mm_sub_epi32( _mm_castps_si128( _mm_add_ps( absolute, _mm_castsi128_ps( magic ) ) ), magic );
+	auto odd        = _mm_srai_epi32( _mm_slli_epi32( bits, 31 - 13 ), 31 );
+	auto normal     = _mm_srli_epi32( _mm_sub_epi32( _mm_add_epi32( bits, bias ), odd ), 13 );
+
+	auto regular    = _mm_or_si128( _mm_and_si128( is_sub, subnormal ), _mm_andnot_si128( is_sub, normal ) );
+	auto result     = _mm_or_si128( _mm_and_si128( is_regular, regular ), _mm_andnot_si128( is_regular, special ) );
+
+	return _mm_or_si128( result, _mm_srai_epi32( _mm_castps_si128( sign ), 16 ) );
+}
+#endif
@@ -0,0 +1,142 @@
+/**
+ *
+ *  _____ __    _ _ _   
+ * |   __|  |  | | | |  
+ * |  |  |  |__| | | |  
+ * |_____|_____|_____| 
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Alves Quentin
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **/
+
+#pragma once
+
+#include "GlwVertexAttribute.h"
+
+/**
+ * GlwVertexQuantizer final class
+ * @note : Convert float vertex data to compact attribute formats, written 
+ *		   with query stride so several attributes can be interleaved in the
+ *		   same vertex. Use SSE2 when available.
+ **/
+class GlwVertexQuantizer final {
+
+public:
+	/**
+	 * QuantizePositions static method
+	 * @note : Write positions as 4 GL_UNSIGNED_SHORT normalized relative to
+	 *		   query bounds, w is 1. Shader restore position as
+	 *		   minimum + value.xyz * ( maximum - minimum ).
+	 * @param count : Query vertex count.
+	 * @param positions : Query positions.
+	 * @param minimum : Query bounds minimum.
+	 * @param maximum : Query bounds maximum.
+	 * @param stride : Query destination vertex stride in bytes.
+	 * @param destination : Query destination of the first vertex attribute, 8 bytes each.
+	 **/
+	static void QuantizePositions(
+		const uint32_t count,
+		const glm::vec3* positions,
+		const glm::vec3& minimum,
+		const glm::vec3& maximum,
+		const uint32_t stride,
+		void* destination
+	);
+
+	/**
+	 * QuantizeNormals static method
+	 * @note : Write normals as normalized GL_INT_2_10_10_10_REV, w is 0.
+	 * @param count : Query vertex count.
+	 * @param normals : Query unit normals.
+	 * @param stride : Query destination vertex stride in bytes.
+	 * @param destination : Query destination of the first vertex attribute, 4 bytes each.
+	 **/
+	static void QuantizeNormals(
+		const uint32_t count,
+		const glm::vec3* normals,
+		const uint32_t stride,
+		void* destination
+	);
+
+	/**
+	 * QuantizeTangents static method
+	 * @note : Write tangents as normalized GL_INT_2_10_10_10_REV, w keep the 
+	 *		   bitangent sign.
+	 * @param count : Query vertex count.
+	 * @param tangents : Query unit tangents with bitangent sign in w.
+	 * @param stride : Query destination vertex stride in bytes.
+	 * @param destination : Query destination of the first vertex attribute, 4 bytes each.
+	 **/
+	static void QuantizeTangents(
+		const uint32_t count,
+		const glm::vec4* tangents,
+		const uint32_t stride,
+		void* destination
+	);
+
+	/**
+	 * QuantizeUVs static method
+	 * @note : Write texture coordinates as 2 GL_HALF_FLOAT.
+	 * @param count : Query vertex count.
+	 * @param uvs : Query texture coordinates.
+	 * @param stride : Query destination vertex stride in bytes.
+	 * @param destination : Query destination of the first vertex attribute, 4 bytes each.
+	 **/
+	static void QuantizeUVs(
+		const uint32_t count,
+		const glm::vec2* uvs,
+		const uint32_t stride,
+		void* destination
+	);
+
+	/**
+	 * ToHalf static function
+	 * @note : Convert a float to half float, rounding to nearest even.
+	 * @param value : Query float value.
+	 * @return : Return half float bits.
+	 **/
+	static uint16_t ToHalf( const float value );
+
+private:
+	/**
+	 * Pack static function
+	 * @note : Pack snorm components to GL_INT_2_10_10_10_REV.
+	 * @param x : Query x component.
+	 * @param y : Query y component.
+	 * @param z : Query z component.
+	 * @param w : Query w component.
+	 * @return : Return packed value.
+	 **/
+	static uint32_t Pack( const float x, const float y, const float z, const float w );
+
+#	ifdef GLW_SSE2
+	/**
+	 * ToHalf static function
+	 * @note : Convert 4 floats to half floats, rounding to nearest even.
+	 * @param values : Query float values.
+	 * @return : Return half float bits in the low 16 bits of each lane.
+	 **/
+	static __m128i ToHalf( const __m128 values );
+#	endif
+
+};
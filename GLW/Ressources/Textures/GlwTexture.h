@@ -67,11 +67,8 @@ public:
         if ( specification.Format > GlwTextureFormats::None ) {
             CreateTexture( specification );
 
-            if ( GetIsValid( ) ) {
+            if ( GetIsValid( ) )
                 SetTextureParameters( specification );
-
-                glBindTexture( (uint32_t)m_type, GL_NULL );
-            }
         }
 
         return GetIsValid( );
@@ -86,14 +83,10 @@ public:
         if ( !GetIsValid( ) )
             return;
 
-        auto gl_type = (uint32_t)m_type;
-
-        glBindTexture( gl_type, m_texture );
-        glTextureParameteri( gl_type, GL_TEXTURE_MIN_LOD, specification.Min );
-        glTextureParameteri( gl_type, GL_TEXTURE_MAX_LOD, specification.Max );
-        glTextureParameterf( gl_type, GL_TEXTURE_LOD_BIAS, specification.Bias );
-        glGenerateMipmap( gl_type );
-        glBindTexture( gl_type, GL_NULL );
+        glTextureParameteri( m_texture, GL_TEXTURE_MIN_LOD, specification.Min );
+        glTextureParameteri( m_texture, GL_TEXTURE_MAX_LOD, specification.Max );
+        glTextureParameterf( m_texture, GL_TEXTURE_LOD_BIAS, specification.Bias );
+        glGenerateTextureMipmap( m_texture );
     };
 
     /**
@@ -105,13 +98,7 @@ public:
         if ( !GetIsValid( ) || specification.Width == 0 || specification.Height == 0 )
             return;
 
-        auto gl_type = (uint32_t)m_type;
-
-        glBindTexture( gl_type, m_texture );
-        
         FillTexture( specification );
-
-        glBindTexture( gl_type, GL_NULL );
     };
 
     /**
@@ -140,16 +127,10 @@ public:
         if ( !GetIsValid( ) )
             return;
 
-        auto gl_type = (uint32_t)m_type;
-
-        glBindTexture( gl_type, m_texture );
-
         if constexpr ( std::is_floating_point<Type>::value )
-            glTextureParameterf( gl_type, parameter, value );
+            glTextureParameterf( m_texture, parameter, value );
         else
-            glTextureParameteri( gl_type, parameter, value );
-
-        glBindTexture( gl_type, GL_NULL );
+            glTextureParameteri( m_texture, parameter, value );
     };
 
 protected:
@@ -184,6 +165,35 @@ protected:
      **/
     virtual void FillTexture( const GlwTextureFillSpecification& specification ) = 0;
 
+protected:
+    /**
+     * GetLevelCount static function
+     * @note : Get mip level count to allocate for immutable storage, a level
+     *         count of 0 allocate the full chain when min filter use mipmaps.
+     * @param specification : Query texture specification.
+     * @param min_filter : Query texture min filter.
+     * @return : Return mip level count value.
+     **/
+    static uint32_t GetLevelCount( 
+        const SpecificationType& specification, 
+        const uint32_t min_filter 
+    ) {
+        auto levels = specification.Levels;
+
+        if ( levels == 0 ) {
+            levels = 1;
+
+            if ( min_filter != GL_NEAREST && min_filter != GL_LINEAR ) {
+                auto size = std::max( specification.Width, specification.Height );
+
+                while ( size >>= 1 )
+                    levels += 1;
+            }
+        }
+
+        return levels;
+    };
+
 public:
     /**
      * GetIsValid const function
@@ -46,21 +46,24 @@ void GlwTexture2D::CreateTexture( const GlwTexture2DSpecification& specification
     glCreateTextures( GL_TEXTURE_2D, 1, &m_texture );
 
     if ( glIsValid( m_texture ) ) {
-        glBindTexture( GL_TEXTURE_2D, m_texture );
-        glTexImage2D( GL_TEXTURE_2D, specification.Levels, (uint32_t)specification.Layout, specification.Width, specification.Height, 0, (uint32_t)specification.Format, GL_UNSIGNED_BYTE, NULL );
+        auto levels = GetLevelCount( specification, specification.Filter.Min );
+
+        glTextureStorage2D( m_texture, levels, (uint32_t)specification.Layout, specification.Width, specification.Height );
+
+        m_specification = specification;
     }
 }
 
 void GlwTexture2D::SetTextureParameters( const GlwTexture2DSpecification& specification ) {
-    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, specification.Filter.Min );
-    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, specification.Filter.Mag );
-    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, specification.Wrap.R );
-    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, specification.Wrap.S );
-    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, specification.Wrap.T );
+    glTextureParameteri( m_texture, GL_TEXTURE_MIN_FILTER, specification.Filter.Min );
+    glTextureParameteri( m_texture, GL_TEXTURE_MAG_FILTER, specification.Filter.Mag );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_R, specification.Wrap.R );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_S, specification.Wrap.S );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_T, specification.Wrap.T );
 }
 
 void GlwTexture2D::FillTexture( const GlwTextureFillSpecification& specification ) {
-    glTexSubImage2D( GL_TEXTURE_2D, specification.Level, specification.X, specification.Y, specification.Width, specification.Height, (uint32_t)m_format, specification.Type, specification.Pixels );
+    glTextureSubImage2D( m_texture, specification.Level, specification.X, specification.Y, specification.Width, specification.Height, (uint32_t)m_format, specification.Type, specification.Pixels );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
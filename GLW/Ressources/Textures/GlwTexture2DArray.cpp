@@ -47,21 +47,22 @@ void GlwTexture2DArray::CreateTexture(
     glCreateTextures( GL_TEXTURE_2D_ARRAY, 1, &m_texture );
 
     if ( glIsValid( m_texture ) ) {
-        glBindTexture( GL_TEXTURE_2D_ARRAY, m_texture );
-        glTexImage3D( GL_TEXTURE_2D_ARRAY, specification.Levels, (uint32_t)specification.Layout, specification.Width, specification.Height, specification.Depth, 0, (uint32_t)specification.Format, GL_UNSIGNED_BYTE, NULL );
+        auto levels = GetLevelCount( specification, specification.Filter.Min );
+
+        glTextureStorage3D( m_texture, levels, (uint32_t)specification.Layout, specification.Width, specification.Height, specification.Depth );
     }
 }
 
 void GlwTexture2DArray::SetTextureParameters(
     const GlwTexture2DArraySpecification& specification
 ) {
-    glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, specification.Filter.Min );
-    glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, specification.Filter.Mag );
-    glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_R, specification.Wrap.R );
-    glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, specification.Wrap.S );
-    glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, specification.Wrap.T );
+    glTextureParameteri( m_texture, GL_TEXTURE_MIN_FILTER, specification.Filter.Min );
+    glTextureParameteri( m_texture, GL_TEXTURE_MAG_FILTER, specification.Filter.Mag );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_R, specification.Wrap.R );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_S, specification.Wrap.S );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_T, specification.Wrap.T );
 }
 
 void GlwTexture2DArray::FillTexture( const GlwTextureFillSpecification& specification ) {
-    glTexSubImage3D( GL_TEXTURE_2D_ARRAY, 0, specification.X, specification.Y, specification.Level, specification.Width, specification.Height, specification.Level, (uint32_t)m_format, specification.Type, specification.Pixels );
+    glTextureSubImage3D( m_texture, 0, specification.X, specification.Y, specification.Level, specification.Width, specification.Height, 1, (uint32_t)m_format, specification.Type, specification.Pixels );
 }
@@ -45,25 +45,22 @@ void GlwTextureCubemap::CreateTexture( const GlwTextureCubemapSpecification& spe
     glCreateTextures( GL_TEXTURE_CUBE_MAP, 1, &m_texture );
 
     if ( glIsValid( m_texture ) ) {
-        glBindTexture( GL_TEXTURE_CUBE_MAP, m_texture );
+        auto levels = GetLevelCount( specification, specification.Filter.Min );
 
-        auto face_id = 6;
-
-        while ( face_id-- > 0 )
-            glTexImage2D( GL_TEXTURE_CUBE_MAP_POSITIVE_X + face_id, 0, (uint32_t)specification.Layout, specification.Width, specification.Height, 0, (uint32_t)specification.Format, GL_UNSIGNED_BYTE, NULL );
+        glTextureStorage2D( m_texture, levels, (uint32_t)specification.Layout, specification.Width, specification.Height );
     }
 }
 
 void GlwTextureCubemap::SetTextureParameters( const GlwTextureCubemapSpecification& specification ) {
-    glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, specification.Filter.Min );
-    glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, specification.Filter.Mag );
-    glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, specification.Wrap.R );
-    glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, specification.Wrap.S );
-    glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, specification.Wrap.T );
+    glTextureParameteri( m_texture, GL_TEXTURE_MIN_FILTER, specification.Filter.Min );
+    glTextureParameteri( m_texture, GL_TEXTURE_MAG_FILTER, specification.Filter.Mag );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_R, specification.Wrap.R );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_S, specification.Wrap.S );
+    glTextureParameteri( m_texture, GL_TEXTURE_WRAP_T, specification.Wrap.T );
 }
 
 void GlwTextureCubemap::FillTexture( const GlwTextureFillSpecification& specification ) {
-    glTexSubImage2D( GL_TEXTURE_CUBE_MAP_POSITIVE_X + specification.Level, 0, specification.X, specification.Y, specification.Width, specification.Height, (uint32_t)m_format, specification.Type, specification.Pixels );
+    glTextureSubImage3D( m_texture, 0, specification.X, specification.Y, specification.Level, specification.Width, specification.Height, 1, (uint32_t)m_format, specification.Type, specification.Pixels );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -59,6 +59,6 @@ enum class GlwTextureLayouts : uint32_t {
 	// Stencil
 	S_08 = GL_STENCIL_INDEX8,
 
-	D24_S08  = GL_UNSIGNED_INT_24_8
+	D24_S08  = GL_DEPTH24_STENCIL8
 
 };
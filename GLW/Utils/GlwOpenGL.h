@@ -35,6 +35,19 @@ extern "C" {
 	#include <inttypes.h>
 };
 
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 // === GLEW Header ===
@@ -45,6 +58,16 @@ extern "C" {
 #   define GLW_DEBUG
 #endif
 
+#if defined( __SSE2__ ) || defined( _M_X64 ) || defined( _M_AMD64 )
+#   define GLW_SSE2
+#   include <emmintrin.h>
+#endif
+
+#if defined( __AVX2__ )
+#   define GLW_AVX2
+#   include <immintrin.h>
+#endif
+
 #define GL_NULL 0
 #define GL_SHADER_NULL ((glShader)GL_NULL)
 #define GL_TEXTURE_NULL ((glTexture)GL_NULL)